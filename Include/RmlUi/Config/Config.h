@@ -35,8 +35,17 @@
  * custom allocators. This file may be edited directly, or can be copied to an alternate location, modified, and
  * included by setting the CMake option CUSTOM_CONFIGURATION_FILE (RMLUI_CUSTOM_CONFIGURATION_FILE preprocessor 
  * define) to the path of that file.
+ *
+ * The allocator Rml::Allocator<T, Category> routes container allocations through the memory interface installed with
+ * Rml::SetMemoryInterface(), e.g. 'template<typename T> using Vector = std::vector<T, Rml::Allocator<T>>;'. The CMake
+ * option MEMORY_INTERFACE_CONTAINERS (RMLUI_MEMORY_INTERFACE_CONTAINERS preprocessor define) makes all the container
+ * and string types below use it. The third-party containers don't support custom allocators, so the standard library
+ * containers are used in that case. Some containers are static and release their memory at program exit, so the
+ * memory interface should then be installed before calling into RmlUi, and remain valid until the program exits.
  */
 
+#include "../Core/MemoryInterface.h"
+
 #ifdef RMLUI_CUSTOM_CONFIGURATION_FILE
 #include RMLUI_CUSTOM_CONFIGURATION_FILE
 #else
@@ -51,7 +60,8 @@
 #include <unordered_map>
 #include <memory>
 
-#ifdef RMLUI_NO_THIRDPARTY_CONTAINERS
+#if defined(RMLUI_NO_THIRDPARTY_CONTAINERS) || defined(RMLUI_MEMORY_INTERFACE_CONTAINERS)
+#include <deque>
 #include <set>
 #include <unordered_set>
 #else
@@ -74,6 +84,32 @@ namespace Rml {
 #define RMLUI_RELEASER_FINAL final
 
 // Containers types.
+#ifdef RMLUI_MEMORY_INTERFACE_CONTAINERS
+template<typename T>
+using Vector = std::vector<T, Allocator<T>>;
+template<typename T, size_t N = 1>
+using Array = std::array<T, N>;
+template<typename T>
+using Stack = std::stack<T, std::deque<T, Allocator<T>>>;
+template<typename T>
+using List = std::list<T, Allocator<T>>;
+template<typename T>
+using Queue = std::queue<T, std::deque<T, Allocator<T>>>;
+template<typename T1, typename T2>
+using Pair = std::pair<T1, T2>;
+template <typename Key, typename Value>
+using UnorderedMultimap = std::unordered_multimap< Key, Value, std::hash<Key>, std::equal_to<Key>, Allocator<std::pair<const Key, Value>> >;
+template <typename Key, typename Value>
+using UnorderedMap = std::unordered_map< Key, Value, std::hash<Key>, std::equal_to<Key>, Allocator<std::pair<const Key, Value>> >;
+template <typename Key, typename Value>
+using SmallUnorderedMap = UnorderedMap< Key, Value >;
+template <typename T>
+using UnorderedSet = std::unordered_set< T, std::hash<T>, std::equal_to<T>, Allocator<T> >;
+template <typename T>
+using SmallUnorderedSet = UnorderedSet< T >;
+template <typename T>
+using SmallOrderedSet = std::set< T, std::less<T>, Allocator<T> >;
+#else
 template<typename T>
 using Vector = std::vector<T>;
 template<typename T, size_t N = 1>
@@ -111,6 +147,7 @@ using SmallUnorderedSet = chobo::flat_set< T >;
 template <typename T>
 using SmallOrderedSet = chobo::flat_set< T >;
 #endif	// RMLUI_NO_THIRDPARTY_CONTAINERS
+#endif	// RMLUI_MEMORY_INTERFACE_CONTAINERS
 template<typename Iterator>
 inline std::move_iterator<Iterator> MakeMoveIterator(Iterator it) { return std::make_move_iterator(it); }
 
@@ -121,7 +158,11 @@ template<typename T>
 using Function = std::function<T>;
 
 // Strings.
+#ifdef RMLUI_MEMORY_INTERFACE_CONTAINERS
+using String = std::basic_string<char, std::char_traits<char>, Allocator<char>>;
+#else
 using String = std::string;
+#endif
 using StringList = Vector< String >;
 
 // Smart pointer types.
@@ -136,12 +177,29 @@ using SharedPtr = std::shared_ptr<T>;
 template<typename T>
 using WeakPtr = std::weak_ptr<T>;
 template<typename T, typename... Args>
-inline SharedPtr<T> MakeShared(Args&&... args) { return std::make_shared<T, Args...>(std::forward<Args>(args)...); }
+inline SharedPtr<T> MakeShared(Args&&... args) { return std::allocate_shared<T>(Allocator<T, MemoryCategoryOf<T>::value>(), std::forward<Args>(args)...); }
 template<typename T, typename... Args>
 inline UniquePtr<T> MakeUnique(Args&&... args) { return std::make_unique<T, Args...>(std::forward<Args>(args)...); }
 
 }
 
+#ifdef RMLUI_MEMORY_INTERFACE_CONTAINERS
+// The standard library only provides hashing for strings using the default allocator.
+namespace std {
+template <>
+struct hash<::Rml::String> {
+	size_t operator()(const ::Rml::String& string) const noexcept
+	{
+		// FNV-1a
+		size_t result = size_t(14695981039346656037ull);
+		for (char c : string)
+			result = (result ^ size_t((unsigned char)c)) * size_t(1099511628211ull);
+		return result;
+	}
+};
+} // namespace std
+#endif
+
 
 /***
 // The following defines should be used for inserting custom type cast operators for conversion of RmlUi types
@@ -62,11 +62,14 @@
 #include "Core/FontEffectInstancer.h"
 #include "Core/FontEngineInterface.h"
 #include "Core/FontGlyph.h"
+#include "Core/FrameStatistics.h"
 #include "Core/Geometry.h"
 #include "Core/GeometryUtilities.h"
 #include "Core/ID.h"
 #include "Core/Input.h"
+#include "Core/InputRecording.h"
 #include "Core/Log.h"
+#include "Core/MemoryInterface.h"
 #include "Core/Plugin.h"
 #include "Core/PropertiesIteratorView.h"
 #include "Core/Property.h"
@@ -82,6 +85,7 @@
 #include "Core/StyleSheetContainer.h"
 #include "Core/StyleSheetSpecification.h"
 #include "Core/SystemInterface.h"
+#include "Core/TaskInterface.h"
 #include "Core/Texture.h"
 #include "Core/Transform.h"
 #include "Core/TransformPrimitive.h"
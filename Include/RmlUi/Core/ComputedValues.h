@@ -121,6 +121,7 @@ enum class Drag : uint8_t { None, Drag, DragDrop, Block, Clone };
 enum class TabIndex : uint8_t { None, Auto };
 enum class Focus : uint8_t { None, Auto };
 enum class PointerEvents : uint8_t { None, Auto };
+enum class ScrollBehavior : uint8_t { Auto, Smooth };
 
 using PerspectiveOrigin = LengthPercentage;
 using TransformOrigin = LengthPercentage;
@@ -201,6 +202,7 @@ struct ComputedValues
 	Focus focus = Focus::Auto;
 	float scrollbar_margin = 0;
 	PointerEvents pointer_events = PointerEvents::Auto;
+	ScrollBehavior scroll_behavior = ScrollBehavior::Auto;
 
 	float perspective = 0;
 	PerspectiveOrigin perspective_origin_x = { PerspectiveOrigin::Percentage, 50.f };
@@ -34,6 +34,7 @@
 #include "Traits.h"
 #include "Input.h"
 #include "ScriptInterface.h"
+#include "FrameStatistics.h"
 
 namespace Rml {
 
@@ -45,10 +46,14 @@ class RenderInterface;
 class DataModel;
 class DataModelConstructor;
 class DataTypeRegister;
+class FrameStatisticsRecorder;
+class InputRecorder;
 enum class EventId : uint16_t;
 
 /**
-	A context for storing, rendering and processing RML documents. Multiple contexts can exist simultaneously.
+	A context for storing, rendering and processing RML documents. Multiple contexts can exist simultaneously, and may
+	be updated and rendered on different threads as long as each context is only used by one thread at a time. See the
+	threading notes in Core.h.
 
 	@author Peter Curry
  */
@@ -83,10 +88,46 @@ public:
 
 	/// Updates all elements in the context's documents. 
 	/// This must be called before Context::Render, but after any elements have been changed, added or removed.
+	/// Only elements which have changed, or have running animations, are updated. See NeedsUpdate().
 	bool Update();
 	/// Renders all visible elements in the context's documents.
 	bool Render();
 
+	/// Returns true if any element, document layout, or data model in the context has changed since the last update,
+	/// or if any element needs to be updated continuously such as during animations. Otherwise, calling Update() will
+	/// not do any work and may be skipped.
+	bool NeedsUpdate() const;
+	/// Returns true if the context has changed since it was last rendered. Otherwise, the output of Render() will be
+	/// the same as the previous frame and may be skipped if the application retains the previous output. Changes are
+	/// only reflected here after calling Update().
+	bool NeedsRender() const;
+
+	/// Returns the statistics of the most recent frame. A frame ends at the end of Render(), and covers the work done
+	/// by the context since the previous frame ended, including its update and any input processed.
+	/// @return The counts and timings of the frame.
+	const FrameStatistics& GetFrameStatistics() const;
+
+	/// Enables or disables recording of per-element statistics, such as which elements had their layout or geometry
+	/// recomputed and the time spent updating and rendering each element. Disabled by default as it adds overhead to
+	/// every element update and render.
+	/// @param[in] enable True to enable recording.
+	void SetElementStatisticsEnabled(bool enable);
+	/// Returns true if per-element statistics are recorded.
+	bool IsElementStatisticsEnabled() const;
+	/// Returns the per-element statistics of the most recent frame, empty unless recording is enabled.
+	/// @return The elements that had any work performed on them during the frame.
+	const ElementStatisticsList& GetElementStatistics() const;
+
+	/// Overrides the time seen by this context and its elements, such as for animations, transitions, scrolling and
+	/// double clicks, instead of the elapsed time of the system interface. Other contexts are not affected.
+	/// @param[in] time The time to use, in seconds.
+	void SetTimeOverride(double time);
+	/// Removes the time override, the context returns to the elapsed time of the system interface.
+	void ClearTimeOverride();
+	/// Returns the current time of the context, in seconds. This is the time override if set, otherwise the elapsed
+	/// time of the system interface.
+	double GetElapsedTime() const;
+
 	/// Creates a new, empty document and places it into this context.
 	/// @param[in] instancer_name The name of the instancer used to create the document.
 	/// @return The new document, or nullptr if no document could be created.
@@ -292,6 +333,10 @@ private:
 
 	// Root of the element tree.
 	ElementPtr root;
+	// Set when the context has changed since it was last rendered.
+	bool render_dirty = true;
+	// Elements which requested to be updated every frame, collected during the last update.
+	ElementList frame_update_elements;
 	// The element that currently has input focus.
 	Element* focus;
 	// The top-most element being hovered over.
@@ -341,8 +386,19 @@ private:
 
 	UniquePtr<DataTypeRegister> data_type_register;
 
+	UniquePtr<FrameStatisticsRecorder> frame_statistics_recorder;
+
+	// The time of the context when overridden, see SetTimeOverride().
+	bool use_time_override = false;
+	double time_override = 0;
+
+	// Records the input and updates of the context while set, see InputRecorder.
+	InputRecorder* input_recorder = nullptr;
+
 	// Internal callback for when an element is detached or removed from the hierarchy.
 	void OnElementDetach(Element* element);
+	// Internal callback for when an element, which should be updated every frame, has been updated.
+	void AddFrameUpdateElement(Element* element);
 	// Internal callback for when a new element gains focus.
 	bool OnFocusChange(Element* element);
 
@@ -376,6 +432,7 @@ private:
 	static void SendEvents(const ElementSet& old_items, const ElementSet& new_items, EventId id, const Dictionary& parameters);
 
 	friend class Rml::Element;
+	friend class Rml::InputRecorder;
 	friend RMLUICORE_API Context* CreateContext(const String&, Vector2i, RenderInterface*);
 };
 
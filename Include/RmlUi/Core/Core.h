@@ -33,6 +33,7 @@
 #include "Types.h"
 #include "Event.h"
 #include "ComputedValues.h"
+#include "MemoryStatistics.h"
 
 namespace Rml {
 
@@ -40,14 +41,27 @@ class Plugin;
 class Context;
 class FileInterface;
 class FontEngineInterface;
+class MemoryInterface;
 class RenderInterface;
 class SystemInterface;
+class TaskInterface;
 enum class DefaultActionPhase;
 
 
 /**
 	RmlUi library core API.
 
+	Threading: Independent contexts may be updated and rendered concurrently on different threads, as long as each
+	context, including its documents, elements and data models, is only accessed by one thread at a time. Resources
+	shared between contexts, such as style sheets, templates, textures, fonts and geometry, are guarded internally.
+
+	The following must not run concurrently with any other calls into the library: Initialise() and Shutdown(), setting
+	interfaces, registering instancers, plugins, fonts and event types, releasing textures and compiled geometry,
+	clearing the style sheet and template caches, and gathering memory statistics. The render, file, system and font
+	engine interfaces are called from every thread updating or rendering a context, thus they must either be thread-safe
+	or, in the case of render interfaces, be separate for each context. Plugins, such as the debugger and the Lua
+	plugin, are not thread-safe.
+
 	@author Peter Curry
  */
 
@@ -91,6 +105,23 @@ RMLUICORE_API FileInterface* GetFileInterface();
 RMLUICORE_API void SetFontEngineInterface(FontEngineInterface* font_interface);
 /// Returns RmlUi's font interface.
 RMLUICORE_API FontEngineInterface* GetFontEngineInterface();
+
+/// Sets the interface through which RmlUi allocates its memory. This is not required to be called, but if it is it
+/// must be called before Initialise(), and before any other RmlUi objects are created.
+/// @param[in] memory_interface A non-owning pointer to the application-specified memory interface.
+/// @lifetime The interface must be kept alive until all memory allocated through it has been returned, which is after
+///           the call to Rml::Shutdown and the destruction of all RmlUi objects owned by the application.
+RMLUICORE_API void SetMemoryInterface(MemoryInterface* memory_interface);
+/// Returns RmlUi's memory interface, or nullptr if memory is allocated from the global heap.
+RMLUICORE_API MemoryInterface* GetMemoryInterface();
+
+/// Sets the interface through which RmlUi schedules work to run in parallel. This is not required to be called, but if
+/// it is it must be called before Initialise(). If no task interface is specified, all work is run serially.
+/// @param[in] task_interface A non-owning pointer to the application-specified task interface.
+/// @lifetime The interface must be kept alive until after the call to Rml::Shutdown.
+RMLUICORE_API void SetTaskInterface(TaskInterface* task_interface);
+/// Returns RmlUi's task interface.
+RMLUICORE_API TaskInterface* GetTaskInterface();
 	
 /// Creates a new element context.
 /// @param[in] name The new name of the context. This must be unique.
@@ -152,6 +183,10 @@ RMLUICORE_API void ReleaseTextures();
 /// Forces all compiled geometry handles generated by RmlUi to be released.
 RMLUICORE_API void ReleaseCompiledGeometry();
 
+/// Returns the memory currently used by RmlUi, broken down by subsystem.
+/// @return The approximate memory usage, see MemoryStatistics.
+RMLUICORE_API MemoryStatistics GetMemoryStatistics();
+
 } // namespace Rml
 
 #endif
@@ -55,7 +55,7 @@ private:
 };
 
 
-class RMLUICORE_API DataTypeRegister final : NonCopyMoveable {
+class RMLUICORE_API DataTypeRegister final : NonCopyMoveable, public Allocated<MemoryCategory::DataBinding> {
 public:
 	DataTypeRegister();
 	~DataTypeRegister();
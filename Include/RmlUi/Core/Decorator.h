@@ -47,7 +47,7 @@ struct Texture;
 	@author Peter Curry
  */
 
-class RMLUICORE_API Decorator
+class RMLUICORE_API Decorator : public Allocated<MemoryCategory::Style>
 {
 public:
 	Decorator();
@@ -66,6 +66,14 @@ public:
 	/// @param[in] element_data The handle to the data generated by the decorator for the element.
 	virtual void RenderElement(Element* element, DecoratorDataHandle element_data) const = 0;
 
+	/// Called to determine if element data generated by this decorator can be shared between elements. Elements with
+	/// an equal context, box, dp-ratio, and computed 'opacity', 'image-color', 'font-size', and border radii will then
+	/// share the data generated for the first of them, instead of generating their own.
+	/// @note Only return true if the generated data depends on nothing else from the element, and does not refer to
+	///       the element itself, as it may outlive the element it was generated for.
+	/// @return True if element data may be shared, false otherwise (default).
+	virtual bool IsElementDataShareable() const;
+
 	/// Value specifying an invalid or non-existent Decorator data handle.
 	static const DecoratorDataHandle INVALID_DECORATORDATAHANDLE = 0;
 
@@ -51,7 +51,7 @@ class PropertyDefinition;
 	@author Peter Curry
  */
 
-class RMLUICORE_API DecoratorInstancer
+class RMLUICORE_API DecoratorInstancer : public Allocated<MemoryCategory::General>
 {
 public:
 	DecoratorInstancer();
@@ -71,7 +71,7 @@ struct StackingOrderedChild;
 	@author Peter Curry
  */
 
-class RMLUICORE_API Element : public ScriptInterface, public EnableObserverPtr<Element>
+class RMLUICORE_API Element : public ScriptInterface, public EnableObserverPtr<Element>, public Allocated<MemoryCategory::Element>
 {
 public:
 	RMLUI_RTTI_DefineWithParent(Element, ScriptInterface)
@@ -398,6 +398,10 @@ public:
 	/// Sets the top scroll offset of the element.
 	/// @param[in] scroll_top The element's new top scroll offset.
 	void SetScrollTop(float scroll_top);
+	/// Scrolls the element to the given offsets. The scroll is animated over the following updates if the element has
+	/// 'scroll-behavior: smooth', otherwise it is applied immediately.
+	/// @param[in] offset The element's new left and top scroll offsets.
+	void ScrollTo(Vector2f offset);
 	/// Gets the width of the scrollable content of the element; it includes the element padding but not its margin.
 	/// @return The width (in pixels) of the of the scrollable content of the element.
 	float GetScrollWidth();
@@ -444,6 +448,19 @@ public:
 	/// @return The number of children.
 	int GetNumChildren(bool include_non_dom_elements = false) const;
 
+	/// The one-based positions of an element among the DOM children of its parent, as used by structural selectors.
+	/// Text nodes and hidden siblings are not counted, and the 'of_type' positions only count siblings with the same tag.
+	/// All positions are zero for elements without a parent and for non-DOM children.
+	struct SiblingIndex {
+		int child = 0;
+		int last_child = 0;
+		int of_type = 0;
+		int last_of_type = 0;
+	};
+	/// Returns the position of this element among its siblings. The positions are cached by the parent, and only
+	/// recalculated after its structure changes.
+	const SiblingIndex& GetSiblingIndex() const;
+
 	/// Gets the markup and content of the element.
 	/// @param[out] content The content of the element.
 	virtual void GetInnerRML(String& content) const;
@@ -587,7 +604,18 @@ public:
 	/// Return the computed values of the element's properties. These values are updated as appropriate on every Context::Update.
 	const ComputedValues& GetComputedValues() const;
 
+	/// Requests that the element is updated during the next context update. Elements are only updated when they or
+	/// their descendants have changed, such as by new style or structure, or when they have running animations.
+	void RequestUpdate();
+	/// Enables or disables updating the element every frame. Elements that need to do work on every update, e.g. to
+	/// advance time-based state, should opt in here instead of requesting an update from every call to OnUpdate().
+	/// @param[in] enable True to update the element every frame while it is attached to a context.
+	void SetUpdateEveryFrame(bool enable);
+	/// Returns true if the element is updated every frame.
+	bool IsUpdatedEveryFrame() const;
+
 protected:
+	/// Updates the element and its descendants, skipping any subtrees which have not requested an update.
 	void Update(float dp_ratio, Vector2f vp_dimensions);
 	void Render();
 
@@ -597,7 +625,7 @@ protected:
 	/// Forces the element to generate a local stacking context, regardless of the value of its z-index property.
 	void ForceLocalStackingContext();
 
-	/// Called during the update loop after children are updated.
+	/// Called during the update loop before children are updated, when the element needs to be updated. See RequestUpdate() and SetUpdateEveryFrame().
 	virtual void OnUpdate();
 	/// Called during render after backgrounds, borders, decorators, but before children, are rendered.
 	virtual void OnRender();
@@ -652,20 +680,48 @@ protected:
 
 private:
 	void SetParent(Element* parent);
+
+	// Updates this element only, not its descendants.
+	void UpdateSelf(float dp_ratio, Vector2f vp_dimensions);
 	
 	void SetDataModel(DataModel* new_data_model);
 
 	void DirtyOffset();
 	void UpdateOffset();
+
+	// Returns the absolute offset of the border box, without the scroll offsets of the ancestors applied.
+	Vector2f GetUnscrolledOffset();
+	// Returns the sum of the scroll offsets of the ancestors that move this element.
+	Vector2f GetAncestorScrollOffset();
+	// Returns the scroll generation of this element, after bringing it up to date with the scroll offsets of its ancestors.
+	unsigned int GetScrollGeneration();
+	// Called when the scroll offset of this element changed, invalidates the ancestor scroll offsets of its descendants.
+	void DirtyScrollOffset();
+	// Invalidates the ancestor scroll offsets of this element and all its descendants.
+	void DirtyAncestorScrollOffset();
 	void SetBaseline(float baseline);
 
 	void BuildLocalStackingContext();
+	// Inserts the entries of the elements added to the local stacking context since it was last built.
+	void UpdateLocalStackingContext();
 	void BuildStackingContext(ElementList* stacking_context);
 	static void BuildStackingContextForTable(Vector<StackingOrderedChild>& ordered_children, Element* child);
 	void DirtyStackingContext();
+	// Returns the closest ancestor with a local stacking context, which contains this element's stacking context entry.
+	Element* GetStackingContextParent() const;
+	// Adds this element and its descendants to the stacking context of its stacking context parent.
+	void AddToStackingContext();
+	// Removes this element and its descendants from the stacking context of its stacking context parent.
+	void RemoveFromStackingContext();
 
 	void DirtyStructure();
 	void UpdateStructure();
+	// Recalculates the sibling index of the children if their structure changed, and dirties the definitions of the
+	// children whose new positions may be matched differently by the structural selectors in use.
+	void UpdateChildSiblingIndices();
+
+	// Marks the ancestors of this element as having descendants that need to be updated.
+	void DirtyUpdateAncestors();
 
 	void DirtyTransformState(bool perspective_dirty, bool transform_dirty);
 	void UpdateTransformState();
@@ -719,9 +775,19 @@ private:
 	Vector2f relative_offset_position;	// the offset of a relatively positioned element
 	bool offset_fixed;
 
+	// The absolute offset without scrolling, only recalculated on layout changes.
 	mutable Vector2f absolute_offset;
 	mutable bool offset_dirty;
 
+	// The scroll offsets applied on top of the absolute offset. They stay valid while the scroll generation of the
+	// nearest scroll container matches, thus scrolling only invalidates the offsets of the scrolled subtree.
+	Vector2f ancestor_scroll_offset;
+	Element* scroll_container = nullptr;
+	unsigned int scroll_container_generation = 0;
+	bool ancestor_scroll_dirty = true;
+	// Incremented whenever the scroll offset of this element, or the scroll offsets of its ancestors, change.
+	unsigned int scroll_generation = 1;
+
 	// The offset this element adds to its logical children due to scrolling content.
 	Vector2f scroll_offset;
 
@@ -755,9 +821,22 @@ private:
 
 	ElementList stacking_context;
 	bool stacking_context_dirty;
+	// Elements added to the stacking context since it was built, their entries are inserted before the next render.
+	ElementList stacking_context_added;
+	// Number of elements removed from the stacking context since the last render, many removals fall back to a rebuild.
+	int stacking_context_num_removed;
 
 	bool structure_dirty;
 
+	SiblingIndex sibling_index;
+	bool child_sibling_indices_dirty;
+
+	// Set when this element needs to be updated, and when any of its descendants do, respectively.
+	bool update_dirty;
+	bool update_descendants_dirty;
+	// Registers the element with its context on every update, see SetUpdateEveryFrame().
+	bool update_every_frame;
+
 	bool computed_values_are_default_initialized;
 
 	// Transform state
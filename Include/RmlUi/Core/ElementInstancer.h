@@ -54,7 +54,7 @@ class Element;
 	@author Lloyd Weehuizen
  */ 
 
-class RMLUICORE_API ElementInstancer : public NonCopyMoveable
+class RMLUICORE_API ElementInstancer : public NonCopyMoveable, public Allocated<MemoryCategory::General>
 {
 public:
 	virtual ~ElementInstancer();
@@ -55,7 +55,7 @@ public:
 	ElementScroll(Element* element);
 	~ElementScroll();
 
-	/// Updates the increment / decrement arrows.
+	/// Updates the increment / decrement arrows, and advances any running smooth scroll.
 	void Update();
 
 	/// Enables and sizes one of the scrollbars.
@@ -82,6 +82,16 @@ public:
 	/// Formats the enabled scrollbars based on the current size of the host element.
 	void FormatScrollbars();
 
+	/// Smoothly scrolls the host element towards the given scroll offset over the following updates. Any running smooth
+	/// scroll is retargeted while keeping its velocity. Setting the scroll offset directly cancels the smooth scroll.
+	/// @param[in] target The new left and top scroll offsets, clamped to the scrollable area.
+	void SmoothScrollTo(Vector2f target);
+	/// Smoothly scrolls the host element by the given distance, relative to the target of any running smooth scroll.
+	/// @param[in] delta The distance to scroll.
+	void SmoothScrollBy(Vector2f delta);
+	/// Returns true while a smooth scroll is in progress.
+	bool IsSmoothScrolling() const;
+
 private:
 	struct Scrollbar
 	{
@@ -91,6 +101,8 @@ private:
 		Element* element = nullptr;
 		UniquePtr<WidgetScroll> widget;
 		bool enabled = false;
+		// Whether the scrollbar element is currently shown, lags behind 'enabled' until the scrollbars are formatted.
+		bool visible = false;
 		float size = 0;
 	};
 
@@ -98,9 +110,24 @@ private:
 	bool CreateScrollbar(Orientation orientation);
 	// Creates the scrollbar corner.
 	bool CreateCorner();
+	// Moves the scroll offset of a running smooth scroll towards its target.
+	void UpdateSmoothScroll();
+
+	struct SmoothScroll
+	{
+		bool active = false;
+		Vector2f target;
+		Vector2f position;
+		Vector2f velocity;
+		// The scroll offset as last set by the smooth scroll, any other change to the offset cancels the scroll.
+		Vector2f applied;
+		double last_time = 0;
+	};
 
 	Element* element;
 
+	SmoothScroll smooth_scroll;
+
 	Scrollbar scrollbars[2];
 	Element* corner;
 };
@@ -32,6 +32,7 @@
 #include "Header.h"
 #include "Element.h"
 #include "Geometry.h"
+#include "Texture.h"
 
 namespace Rml {
 
@@ -75,6 +76,12 @@ public:
 	/// @param[in] line_position The position of this line, as an offset from the first line.
 	/// @param[in] line The contents of the line.
 	void AddLine(Vector2f line_position, const String& line);
+	/// Replaces a range of lines with new lines, the remaining lines keep their geometry.
+	/// @param[in] lines_begin The index of the first line to replace.
+	/// @param[in] lines_end The index one past the last line to replace.
+	/// @param[in] new_lines The positions and contents of the new lines, with positions as offsets from the first line.
+	/// @param[in] following_lines_offset The offset to move the lines after the replaced range by.
+	void ReplaceLines(int lines_begin, int lines_end, const Vector<Pair<Vector2f, String>>& new_lines, Vector2f following_lines_offset);
 
 	/// Prevents the element from dirtying its document's layout when its text is changed.
 	void SuppressAutoLayout();
@@ -90,19 +97,33 @@ private:
 	// Prepares the font effects this element uses for its font.
 	bool UpdateFontEffects();
 
+	// The range of vertices and indices generated for a line in one of the text geometries.
+	struct GeometrySlice
+	{
+		int vertex_begin, num_vertices;
+		int index_begin, num_indices;
+	};
+
 	// Used to store the position and length of each line we have geometry for.
 	struct Line
 	{
-		Line(const String& text, Vector2f position) : text(text), position(position), width(0) {}
+		Line(const String& text, Vector2f position) : text(text), position(position), geometry_position(position), width(-1) {}
 		String text;
 		Vector2f position;
+		// The position of the line when its geometry was generated, the line may have been moved since.
+		Vector2f geometry_position;
+		// The width of the line, or -1 if not yet measured.
 		int width;
+		// The location of the line's geometry in each of the text geometries, set when the geometry is generated.
+		Vector< GeometrySlice > geometry_slices;
 	};
 
-	// Clears and regenerates all of the text's geometry.
-	void GenerateGeometry(const FontFaceHandle font_face_handle);
+	// Clears and regenerates the text's geometry for the given range of lines, the remaining lines are left without geometry.
+	void GenerateGeometry(const FontFaceHandle font_face_handle, int lines_begin, int lines_end);
 	// Generates the geometry for a single line of text.
 	void GenerateGeometry(const FontFaceHandle font_face_handle, Line& line);
+	// Copies the geometry of a previously generated line into the text geometry, returns false if it cannot be reused.
+	bool ReuseGeometry(const Line& previous_line, GeometryList& previous_geometry, Line& line);
 	// Generates any geometry necessary for rendering decoration (underline, strike-through, etc).
 	void GenerateDecoration(const FontFaceHandle font_face_handle);
 
@@ -115,6 +136,21 @@ private:
 
 	GeometryList geometry;
 	bool geometry_dirty;
+	// Our references to the font textures used by the geometry, so that they stay valid if the font face handle
+	// regenerates its textures from another thread.
+	Vector< Texture > geometry_textures;
+
+	// The lines of the last generated geometry, kept after the lines are cleared so that the geometry of unchanged lines can be reused.
+	LineList previous_lines;
+	// The range of lines the current geometry was generated for, lines outside of it have no geometry. After the lines are
+	// cleared, this range refers to the previous lines.
+	int generated_lines_begin;
+	int generated_lines_end;
+	// The font configuration and colour the current geometry was generated with.
+	FontFaceHandle generated_font_face_handle;
+	FontEffectsHandle generated_font_effects_handle;
+	int generated_font_handle_version;
+	Colourb generated_colour;
 
 	Colourb colour;
 
@@ -56,6 +56,15 @@ public:
 	/// @param[in] data_source_name The name of the new data source.
 	void SetDataSource(const String& data_source_name);
 
+	/// Enables or disables the virtualized mode of the grid. In virtualized mode, rows are only fetched from the data
+	/// source and instanced for the part of the table visible in the grid, and row elements are recycled while
+	/// scrolling. The table is displayed flat, child data sources of rows are not expanded. All rows must have the
+	/// same height. Can also be enabled by setting the 'virtualize' attribute on the grid.
+	/// @param[in] virtualized True to enable virtualized mode.
+	void SetVirtualized(bool virtualized);
+	/// Returns true if the grid is in virtualized mode.
+	bool IsVirtualized() const;
+
 	/**
 		A column inside a table.
 
@@ -117,6 +126,7 @@ public:
 	int GetNumRows() const;
 	/// Returns the row at the given index in the table.
 	/// @param[in] index The index of the row, relative to the table.
+	/// @return The row, or nullptr if the row is not instanced in virtualized mode.
 	ElementDataGridRow* GetRow(int index) const;
 
 protected:
@@ -124,6 +134,14 @@ protected:
 
 	void OnResize() override;
 
+	void OnAttributeChange(const ElementAttributes& changed_attributes) override;
+
+	void OnDataSourceDestroy(DataSource* data_source) override;
+	void OnRowAdd(DataSource* data_source, const String& table, int first_row_added, int num_rows_added) override;
+	void OnRowRemove(DataSource* data_source, const String& table, int first_row_removed, int num_rows_removed) override;
+	void OnRowChange(DataSource* data_source, const String& table, int first_row_changed, int num_rows_changed) override;
+	void OnRowChange(DataSource* data_source, const String& table) override;
+
 	/// Gets the markup and content of the element.
 	/// @param content[out] The content of the element.
 	void GetInnerRML(String& content) const override;
@@ -147,6 +165,37 @@ private:
 
 	// The block element that contains all our rows. Only used for applying styles.
 	Element* body;
+
+	// The name of the current data source.
+	String data_source_name;
+
+	// Sets the data source of the virtualized table.
+	void SetVirtualDataSource(const String& data_source_name);
+	// Instances, recycles and loads the rows visible in the grid. Returns true if any rows were loaded.
+	bool UpdateVirtualRows();
+	// Marks the visible rows in the given range of the table as dirty, so that they are fetched again.
+	void DirtyVirtualRows(int first_row, int num_rows = -1);
+	// Removes all the row elements of the virtualized table.
+	void ReleaseVirtualRows();
+
+	bool virtualized = false;
+
+	DataSource* virtual_data_source = nullptr;
+	String virtual_data_table;
+	// The number of rows in the table.
+	int virtual_num_rows = 0;
+	// The height of each row, measured from the layout of the rows.
+	float virtual_row_height = 0;
+
+	// The instanced rows in document order, the first one displays the row at the given table index.
+	RowList virtual_rows;
+	int virtual_first_row = 0;
+
+	// Elements taking the place of the rows before and after the instanced rows.
+	Element* virtual_spacer_top = nullptr;
+	Element* virtual_spacer_bottom = nullptr;
+	float virtual_spacer_top_height = 0;
+	float virtual_spacer_bottom_height = 0;
 };
 
 } // namespace Rml
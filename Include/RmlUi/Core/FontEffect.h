@@ -37,7 +37,7 @@ namespace Rml {
 	@author Peter Curry
  */
 
-class RMLUICORE_API FontEffect
+class RMLUICORE_API FontEffect : public Allocated<MemoryCategory::Font>
 {
 public:
 	// Behind or in front of the main text.
@@ -48,7 +48,7 @@ class FontEffect;
 	@author Peter Curry
  */
 
-class RMLUICORE_API FontEffectInstancer
+class RMLUICORE_API FontEffectInstancer : public Allocated<MemoryCategory::General>
 {
 public:
 	FontEffectInstancer();
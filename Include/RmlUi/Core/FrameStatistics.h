@@ -0,0 +1,143 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMESTATISTICS_H
+#define RMLUI_CORE_FRAMESTATISTICS_H
+
+#include "Header.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+	Counts and timings of the work performed by a context during a single frame, see Context::GetFrameStatistics().
+
+	Only work performed during the context's update, render, and input processing calls is recorded. Times are
+	measured with a monotonic high-resolution clock, in seconds.
+ */
+
+struct RMLUICORE_API FrameStatistics
+{
+	// Time spent in Context::Update(), including the data model, style, and layout updates.
+	double update_time = 0;
+	// Time spent updating the views of data models.
+	double data_model_time = 0;
+	// Time spent formatting the layout of documents.
+	double layout_time = 0;
+	// Time spent in Context::Render().
+	double render_time = 0;
+	// Time spent running scripts, as reported by scripting plugins through RecordScriptTime().
+	double script_time = 0;
+
+	// Number of data models with any views updated.
+	int data_model_updates = 0;
+	// Number of elements updated, elements in subtrees without any changes are skipped.
+	int element_updates = 0;
+	// Number of element definitions fetched from the style sheet, due to changes in e.g. classes or pseudo classes.
+	int definition_updates = 0;
+	// Number of elements that had their computed values recalculated.
+	int computed_values_updates = 0;
+	// Number of documents that had their layout formatted.
+	int layout_passes = 0;
+	// Number of elements formatted during the layout passes.
+	int formatted_elements = 0;
+	// Number of geometries that were generated or changed since they were last submitted to the render interface.
+	int geometry_regenerations = 0;
+	// Number of geometries submitted to the render interface for rendering.
+	int draw_calls = 0;
+	// Number of vertices submitted to the render interface for rendering.
+	int vertices = 0;
+	// Number of draw calls using a different texture than the previous draw call.
+	int texture_binds = 0;
+	// Number of times the context looked up the element at a point, such as for mouse input.
+	int hit_tests = 0;
+	// Number of events dispatched.
+	int events_dispatched = 0;
+	// Number of calls into scripts, as reported by scripting plugins through RecordScriptTime().
+	int script_calls = 0;
+};
+
+/// Adds time spent running a script to the frame statistics of the context currently doing work on this thread, if
+/// any. Intended for scripting plugins, which should only report the outermost call when calls into scripts nest.
+/// @param[in] time The time spent in the script, in seconds.
+RMLUICORE_API void RecordScriptTime(double time);
+
+/**
+	The time spent in a single script handler, such as an event handler or a document script.
+ */
+
+struct ScriptHandlerStatistics {
+	String name;
+	int calls = 0;
+	double time = 0;
+};
+using ScriptHandlerStatisticsList = Vector<ScriptHandlerStatistics>;
+using ScriptHandlerStatisticsFunction = Function<ScriptHandlerStatisticsList()>;
+
+/// Sets the function returning the time spent in each script handler, which is ranked in the performance panel of the
+/// debugger. Intended for scripting plugins with a profiler.
+/// @param[in] function Returns the total time and calls of each handler since profiling started, or nullptr to clear.
+RMLUICORE_API void SetScriptHandlerStatisticsFunction(ScriptHandlerStatisticsFunction function);
+/// Returns the time spent in each script handler as reported by the scripting plugin, or an empty list if none is set.
+RMLUICORE_API ScriptHandlerStatisticsList GetScriptHandlerStatistics();
+
+/**
+	Work performed on a single element during a frame, see Context::SetElementStatisticsEnabled().
+
+	Times are exclusive, that is, they do not include the time spent updating or rendering the element's children.
+ */
+
+struct RMLUICORE_API ElementStatistics
+{
+	enum Flags {
+		// The element definition was fetched from the style sheet.
+		DefinitionUpdated = 1 << 0,
+		// The element was formatted during a layout pass.
+		Formatted = 1 << 1,
+		// Geometry was generated or changed while rendering the element.
+		GeometryRegenerated = 1 << 2,
+		// A data view attached to the element was updated.
+		DataViewUpdated = 1 << 3,
+		// The element requested a new layout of its document.
+		LayoutDirtied = 1 << 4,
+	};
+
+	// The element, becomes null if the element is destroyed.
+	ObserverPtr<Element> element;
+	// Combination of the above flags.
+	int flags = 0;
+	// Time spent in Element::Update(), excluding children.
+	double update_time = 0;
+	// Time spent in Element::Render(), excluding children in the element's stacking context.
+	double render_time = 0;
+};
+
+using ElementStatisticsList = Vector<ElementStatistics>;
+
+} // namespace Rml
+#endif
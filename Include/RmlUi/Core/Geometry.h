@@ -47,7 +47,7 @@ using GeometryDatabaseHandle = uint32_t;
 	@author Peter Curry
  */
 
-class RMLUICORE_API Geometry
+class RMLUICORE_API Geometry : public Allocated<MemoryCategory::Element>
 {
 public:
 	Geometry(Element* host_element = nullptr);
@@ -138,6 +138,7 @@ enum class PropertyId : uint8_t
 	Drag,
 	TabIndex,
 	ScrollbarMargin,
+	ScrollBehavior,
 
 	Perspective,
 	PerspectiveOriginX,
@@ -0,0 +1,135 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_INPUTRECORDING_H
+#define RMLUI_CORE_INPUTRECORDING_H
+
+#include "Header.h"
+#include "Input.h"
+#include "Traits.h"
+#include "Types.h"
+
+namespace Rml {
+
+class Context;
+
+/**
+	Records the input submitted to a context through its Process...() functions, its dimension changes and updates,
+	together with the context's time at each call, see Context::GetElapsedTime().
+
+	The recording is plain text, one entry per line. It can be stored by the application, e.g. to capture a user
+	session, and later be played back with an InputReplayer.
+ */
+
+class RMLUICORE_API InputRecorder : public NonCopyMoveable
+{
+public:
+	/// Starts recording the given context. Only one recorder can be attached to a context at a time.
+	/// @param[in] context The context to record.
+	InputRecorder(Context* context);
+	/// Stops recording.
+	~InputRecorder();
+
+	/// Returns the recording so far.
+	const String& GetRecording() const;
+
+private:
+	void RecordKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state);
+	void RecordKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state);
+	void RecordTextInput(const String& string);
+	void RecordMouseMove(int x, int y, int key_modifier_state);
+	void RecordMouseButtonDown(int button_index, int key_modifier_state);
+	void RecordMouseButtonUp(int button_index, int key_modifier_state);
+	void RecordMouseWheel(float wheel_delta, int key_modifier_state);
+	void RecordDimensions(Vector2i dimensions);
+	void RecordUpdate();
+
+	// Appends an entry stamped with the current time.
+	void Record(const char* type, const String& arguments);
+
+	Context* context;
+	String recording;
+
+	friend class Rml::Context;
+};
+
+/**
+	Plays back a recording made with an InputRecorder into a context.
+
+	While the replayer exists, the time of the context is overridden by the recorded time of the entry being played
+	back, so that time-dependent behavior such as animations and double clicks are reproduced. Only the replayed context
+	is affected, the system interface and any other contexts keep running on the application's time.
+ */
+
+class RMLUICORE_API InputReplayer : public NonCopyMoveable
+{
+public:
+	/// Parses the recording and overrides the time of the context.
+	/// @param[in] context The context to submit the recorded input to.
+	/// @param[in] recording A recording previously returned by InputRecorder::GetRecording().
+	InputReplayer(Context* context, const String& recording);
+	/// Clears the time override of the context.
+	~InputReplayer();
+
+	/// Returns false if the recording could not be parsed.
+	bool IsValid() const;
+
+	/// Submits the recorded input up to the next recorded update to the context, and advances the time to that update.
+	/// The caller should then update and render the context.
+	/// @return False if there are no more recorded updates, in which case any remaining input has been submitted.
+	bool NextFrame();
+
+	/// Returns the number of recorded updates.
+	int GetNumFrames() const;
+	/// Returns the current recorded time, in seconds.
+	double GetTime() const;
+
+private:
+	enum class Type { KeyDown, KeyUp, TextInput, MouseMove, MouseButtonDown, MouseButtonUp, MouseWheel, Dimensions, Update };
+
+	struct Entry {
+		double time;
+		Type type;
+		int values[3];
+		float wheel_delta;
+		String text;
+	};
+
+	// Parses a single line of the recording, returns false on error.
+	bool ParseEntry(const String& line, Entry& entry);
+
+	Context* context;
+	Vector<Entry> entries;
+	size_t next_entry = 0;
+	int num_frames = 0;
+	bool valid = false;
+	double time = 0;
+};
+
+} // namespace Rml
+#endif
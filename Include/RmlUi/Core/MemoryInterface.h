@@ -0,0 +1,163 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_MEMORYINTERFACE_H
+#define RMLUI_CORE_MEMORYINTERFACE_H
+
+#include "Header.h"
+#include <cstddef>
+#include <new>
+
+namespace Rml {
+
+/**
+	Tags passed along with each allocation to describe the part of RmlUi making it.
+ */
+enum class MemoryCategory
+{
+	General,     // Anything not covered below, including shared objects, streams, instancers and containers.
+	Element,     // Elements, including their meta data, computed values, widgets, geometry and decorator data.
+	Style,       // Style sheets, style sheet nodes, selectors, element definitions and decorators.
+	Layout,      // Layout boxes and line boxes allocated during formatting.
+	Font,        // Font faces, families, handles and layers of the default font engine, and font effects.
+	Texture,     // Texture resources.
+	DataBinding, // Data models and data views.
+};
+
+/**
+	The abstract base class for application-specific memory allocation.
+
+	By default, RmlUi allocates its memory from the global heap. An application which wants to place RmlUi on its own
+	heap, or attribute its memory in the application's allocator tracking, can derive from this class and install it
+	through Rml::SetMemoryInterface() before RmlUi is initialised.
+
+	All allocations made by RmlUi's memory pools, by the classes tagged with a memory category, by shared objects made
+	with Rml::MakeShared, and by containers configured to use Rml::Allocator are routed through this interface. The
+	tagged classes include the base classes of elements, decorators, font effects, their instancers, streams and data
+	variable definitions, so that objects of these types created with new or Rml::MakeUnique, such as by the factory
+	instancers, are routed too. The container types are configured to use Rml::Allocator by the CMake option
+	MEMORY_INTERFACE_CONTAINERS, see <RmlUi/Config/Config.h>.
+ */
+
+class RMLUICORE_API MemoryInterface
+{
+public:
+	MemoryInterface();
+	virtual ~MemoryInterface();
+
+	MemoryInterface(const MemoryInterface&) = delete;
+	MemoryInterface& operator=(const MemoryInterface&) = delete;
+
+	/// Allocates a block of memory.
+	/// @param[in] size The number of bytes to allocate.
+	/// @param[in] alignment The required alignment of the block, a power of two.
+	/// @param[in] category The part of the library making the allocation.
+	/// @return The allocated block. Must not return nullptr.
+	virtual void* Allocate(size_t size, size_t alignment, MemoryCategory category) = 0;
+	/// Frees a block of memory previously returned by Allocate().
+	/// @param[in] ptr The block to free.
+	/// @param[in] size The size of the block, as passed to Allocate().
+	/// @param[in] alignment The alignment of the block, as passed to Allocate().
+	/// @param[in] category The category of the block, as passed to Allocate().
+	virtual void Deallocate(void* ptr, size_t size, size_t alignment, MemoryCategory category) = 0;
+};
+
+namespace Memory {
+
+/// Allocates memory through the installed memory interface, or from the global heap if none is installed.
+RMLUICORE_API void* Allocate(size_t size, size_t alignment, MemoryCategory category);
+/// Frees memory previously allocated through Memory::Allocate().
+RMLUICORE_API void Deallocate(void* ptr, size_t size, size_t alignment, MemoryCategory category);
+
+} // namespace Memory
+
+/**
+	STL-compatible allocator routing its allocations through the memory interface. Can be used to configure the
+	container types in a custom configuration file, see <RmlUi/Config/Config.h>.
+ */
+template <typename T, MemoryCategory Category = MemoryCategory::General>
+class Allocator
+{
+public:
+	using value_type = T;
+
+	template <typename U>
+	struct rebind { using other = Allocator<U, Category>; };
+
+	Allocator() noexcept = default;
+	template <typename U>
+	Allocator(const Allocator<U, Category>&) noexcept {}
+
+	T* allocate(size_t n) { return static_cast<T*>(Memory::Allocate(n * sizeof(T), alignof(T), Category)); }
+	void deallocate(T* ptr, size_t n) noexcept { Memory::Deallocate(ptr, n * sizeof(T), alignof(T), Category); }
+
+	template <typename U>
+	bool operator==(const Allocator<U, Category>&) const noexcept { return true; }
+	template <typename U>
+	bool operator!=(const Allocator<U, Category>&) const noexcept { return false; }
+};
+
+/**
+	Base class routing new and delete of the derived classes through the memory interface, tagged with the given
+	category. Over-aligned classes pass their alignment when compiled with aligned new support (C++17), otherwise the
+	alignment of std::max_align_t is used.
+ */
+template <MemoryCategory Category>
+class Allocated
+{
+public:
+	static constexpr MemoryCategory memory_category = Category;
+
+	static void* operator new(size_t size) { return Memory::Allocate(size, alignof(std::max_align_t), Category); }
+	static void operator delete(void* ptr, size_t size) noexcept { Memory::Deallocate(ptr, size, alignof(std::max_align_t), Category); }
+#ifdef __cpp_aligned_new
+	static void* operator new(size_t size, std::align_val_t alignment) { return Memory::Allocate(size, size_t(alignment), Category); }
+	static void operator delete(void* ptr, size_t size, std::align_val_t alignment) noexcept { Memory::Deallocate(ptr, size, size_t(alignment), Category); }
+#endif
+
+	// Placement new is hidden by the above, restore it for objects constructed in memory pools.
+	static void* operator new(size_t, void* ptr) noexcept { return ptr; }
+	static void operator delete(void*, void*) noexcept {}
+};
+
+/// The memory category of the given type, as tagged by deriving from Allocated, otherwise the general category.
+template <typename T>
+struct MemoryCategoryOf
+{
+private:
+	template <typename U>
+	static constexpr MemoryCategory Get(decltype(U::memory_category)*) { return U::memory_category; }
+	template <typename U>
+	static constexpr MemoryCategory Get(...) { return MemoryCategory::General; }
+
+public:
+	static constexpr MemoryCategory value = Get<T>(nullptr);
+};
+
+} // namespace Rml
+#endif
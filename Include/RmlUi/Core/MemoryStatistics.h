@@ -0,0 +1,103 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_MEMORYSTATISTICS_H
+#define RMLUI_CORE_MEMORYSTATISTICS_H
+
+#include "Header.h"
+#include "ComputedValues.h"
+#include "Types.h"
+
+namespace Rml {
+
+/**
+	The memory used by RmlUi, broken down by subsystem, see Rml::GetMemoryStatistics().
+
+	Byte counts are approximate. They include the capacity reserved by pools and buffers where known, but generally
+	not the dynamic allocations owned by each object.
+ */
+
+struct RMLUICORE_API MemoryStatistics
+{
+	struct Usage {
+		// Number of live objects.
+		int count = 0;
+		// Approximate number of bytes used.
+		size_t bytes = 0;
+	};
+
+	// A texture atlas layer of a font face at a given size, only available with the default font engine.
+	struct FontAtlas {
+		// The font family name, in lower case.
+		String family;
+		Style::FontStyle style = Style::FontStyle::Normal;
+		Style::FontWeight weight = Style::FontWeight::Normal;
+		int size = 0;
+		// Index of the layer in the font face handle, the base layer comes first followed by the font effect layers.
+		int layer = 0;
+		int num_textures = 0;
+		// Bytes used by the texture data, at four bytes per pixel.
+		size_t bytes = 0;
+	};
+
+	// Loaded textures of the same dimensions.
+	struct TextureGroup {
+		Vector2i dimensions;
+		int count = 0;
+		// Bytes used by the texture data, at four bytes per pixel.
+		size_t bytes = 0;
+	};
+
+	// Elements of all types, in bytes of the base element.
+	Usage elements;
+	// The meta data allocated for every element, including their style and computed values.
+	Usage element_meta;
+	// The computed values of elements, a part of their meta data.
+	Usage computed_values;
+
+	Usage style_sheets;
+	Usage style_sheet_nodes;
+	// Element definitions cached by style sheets, including their properties.
+	Usage element_definitions;
+
+	// Geometry and their vertex and index buffers.
+	Usage geometry;
+
+	Vector<FontAtlas> font_atlases;
+	Vector<TextureGroup> textures;
+
+	Usage data_models;
+	// Data views of all types, in bytes of the base data view.
+	Usage data_views;
+
+	// Pooled chunks used during layout, the count is the number of chunks currently in use.
+	Usage layout_chunks;
+};
+
+} // namespace Rml
+#endif
@@ -33,6 +33,7 @@
 #include "PropertyDictionary.h"
 #include "Spritesheet.h"
 #include "StyleSheetTypes.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -56,7 +57,7 @@ struct Spritesheet;
 	@author Lloyd Weehuizen
  */
 
-class RMLUICORE_API StyleSheet final : public NonCopyMoveable
+class RMLUICORE_API StyleSheet final : public NonCopyMoveable, public Allocated<MemoryCategory::Style>
 {
 public:
 	~StyleSheet();
@@ -69,7 +70,7 @@ public:
 	/// Merges another style sheet into this.
 	void MergeStyleSheet(const StyleSheet& sheet);
 
-	/// Builds the node index for a combined style sheet.
+	/// Builds the node index for a combined style sheet. The index is only built once, unless the sheet is merged with another.
 	void BuildNodeIndex();
 
 	/// Returns the Keyframes of the given name, or null if it does not exist.
@@ -81,12 +82,18 @@ public:
 	const Sprite* GetSprite(const String& name) const;
 
 	/// Returns the compiled element definition for a given element and its hierarchy.
+	/// @note Thread-safe, a single style sheet may be shared by documents in contexts updated on different threads.
 	SharedPtr<ElementDefinition> GetElementDefinition(const Element* element) const;
 
+	/// Returns the sibling dependencies of all the structural selectors in this style sheet, see Element::SiblingIndex.
+	/// @note Only valid once the node index is built.
+	int GetSiblingDependencies() const;
+
 	/// Retrieve the hash key used to look-up applicable nodes in the node index.
 	static size_t NodeHash(const String& tag, const String& id);
 
 	/// Returns a list of instanced decorators from the declarations. The instances are cached for faster future retrieval.
+	/// @note Thread-safe, the returned list remains valid for the lifetime of the style sheet.
 	const Vector<SharedPtr<const Decorator>>& InstanceDecorators(const DecoratorDeclarationList& declaration_list, const PropertySource* decorator_source) const;
 
 private:
@@ -113,15 +120,21 @@ private:
 
 	// Map of all styled nodes, that is, they have one or more properties.
 	NodeIndex styled_node_index;
+	bool node_index_built = false;
+	// The combined sibling dependencies of the structural selectors in the node index.
+	int sibling_dependencies = 0;
 
 	// Index of node sets to element definitions.
 	using ElementDefinitionCache = UnorderedMap< size_t, SharedPtr<ElementDefinition> >;
 	mutable ElementDefinitionCache node_cache;
 
-	// Cached decorator instances.
-	using DecoratorCache = UnorderedMap< String, Vector<SharedPtr<const Decorator>> >;
+	// Cached decorator instances. Stored by pointer so that returned references survive later insertions.
+	using DecoratorCache = UnorderedMap< String, UniquePtr<const Vector<SharedPtr<const Decorator>>> >;
 	mutable DecoratorCache decorator_cache;
 
+	// Guards the node index and the caches above, which may be accessed by contexts on different threads.
+	mutable std::mutex cache_mutex;
+
 	friend Rml::StyleSheetParser;
 	friend Rml::StyleSheetContainer;
 };
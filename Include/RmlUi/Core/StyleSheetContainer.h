@@ -44,7 +44,7 @@ class StyleSheet;
 	@author Maximilian Stark
  */
 
-class RMLUICORE_API StyleSheetContainer : public NonCopyMoveable
+class RMLUICORE_API StyleSheetContainer : public NonCopyMoveable, public Allocated<MemoryCategory::Style>
 {
 public:
 	StyleSheetContainer();
@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_TASKINTERFACE_H
+#define RMLUI_CORE_TASKINTERFACE_H
+
+#include "Header.h"
+#include "Types.h"
+#include "Traits.h"
+
+namespace Rml {
+
+/**
+	The base class for scheduling work on the application's worker threads.
+
+	RmlUi uses this interface to split expensive, independent work into tasks that may run in parallel, such as
+	rasterizing font effects and vector images. By default, all tasks are run immediately on the calling thread. To let
+	RmlUi use the application's job system, derive from this class, implement GetConcurrency(), Submit() and Wait(),
+	and install it through Rml::SetTaskInterface() before initialising RmlUi.
+
+	Tasks only call into code that is safe to run concurrently with other tasks from the same call. Messages logged by
+	tasks are passed to the system interface on the calling thread once the tasks are done. However, the following
+	application callbacks may be called from several threads at once:
+	  - FontEffect::GenerateGlyphTexture() of custom font effects.
+	  - FontEffectInstancer::InstanceFontEffect() and DecoratorInstancer::InstanceDecorator() of custom instancers,
+	    while parsing style sheets.
+	  - PropertyParser::ParseValue() of custom parsers registered with StyleSheetSpecification, while parsing style
+	    sheets.
+ */
+
+class RMLUICORE_API TaskInterface : public NonCopyMoveable
+{
+public:
+	using TaskHandle = uintptr_t;
+
+	TaskInterface();
+	virtual ~TaskInterface();
+
+	/// Returns the number of tasks that can be run in parallel, including the calling thread.
+	/// The default implementation returns one, which makes RmlUi run all work serially.
+	virtual int GetConcurrency();
+
+	/// Submits a task for execution, possibly on another thread.
+	/// The default implementation runs the task immediately on the calling thread.
+	/// @param[in] task The task to run.
+	/// @return A handle to the task, which must be passed to Wait() exactly once.
+	virtual TaskHandle Submit(Function<void()> task);
+	/// Blocks until the given task has completed. The calling thread may run other tasks while waiting.
+	/// @param[in] handle A handle previously returned from Submit().
+	virtual void Wait(TaskHandle handle);
+
+	/// Calls the function on sub-ranges covering the range [begin, end), possibly in parallel, and returns once all
+	/// sub-ranges have been processed. The default implementation splits the range into chunks of at least the
+	/// grain size, one chunk for each task that can be run in parallel. All but one chunk are passed to Submit(),
+	/// while the last chunk is run on the calling thread.
+	/// @param[in] begin The first index of the range.
+	/// @param[in] end One past the last index of the range.
+	/// @param[in] grain_size The smallest number of indices worth running as a separate task.
+	/// @param[in] function The function to call with the beginning and end of each sub-range.
+	virtual void ParallelFor(int begin, int end, int grain_size, const Function<void(int, int)>& function);
+};
+
+} // namespace Rml
+#endif
@@ -34,5 +34,6 @@
 #include "Lua/IncludeLua.h"
 #include "Lua/LuaType.h"
 #include "Lua/Interpreter.h"
+#include "Lua/Profiler.h"
 
 #endif
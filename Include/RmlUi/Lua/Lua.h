@@ -47,6 +47,16 @@ RMLUILUA_API void Initialise();
  @remark The plugin registers the "body" tag to generate a LuaDocument rather than a ElementDocument. */
 RMLUILUA_API void Initialise(lua_State* L);
 
+/** Data models are opened from scripts with context:OpenDataModel(name, variables [, options]).
+ @remark Assigning to a variable of the model, such as 'model.list = list', dirties that variable. Assignments which
+   leave a non-table value unchanged are ignored, and model:batch(fn) defers dirtying until fn returns.
+ @remark By default, tables read from the model are the plain tables stored in it, so changes made to them in place are
+   not seen until the variable is reassigned. Passing the options { track_nested_writes = true } instead returns the
+   tables as proxies which dirty the variable on any nested write. Proxies support indexing, assignment and '#', while
+   'pairs' requires Lua 5.2 or later, and 'ipairs' and the 'table' library require Lua 5.3 or later.
+ @remark Dirtying is tracked per top-level variable. A write to a nested value, such as 'model.list[3].name', updates
+   all views bound to 'list', not only those bound to the exact path. */
+
 
 } // namespace Lua
 } // namespace Rml
@@ -121,7 +121,8 @@ public:
     @param obj[in] The object to push to the stack
     @param gc[in] If the obj should be deleted or decrease reference count upon the garbage collection
     metamethod being called from the object in Lua
-    @return Position on the stack where the userdata resides   */
+    @return Position on the stack where the userdata resides
+    @remark Objects which are not garbage collected reuse the userdata of any previous push that is still alive. */
     static inline int push(lua_State *L, T* obj, bool gc=false);
     /** Statically casts the item at the position on the Lua stack
     @param narg[in] Position of the item to cast on the Lua stack
@@ -163,6 +164,9 @@ private:
 namespace LuaTypeImpl {
 RMLUILUA_API int index(lua_State* L, const char* class_name);
 RMLUILUA_API int newindex(lua_State* L, const char* class_name);
+//counted by the profiler while it is enabled, see Profiler::SetEnabled()
+RMLUILUA_API void RecordBindingCall();
+RMLUILUA_API void RecordUserdataAllocation();
 }
 
 } // namespace Lua
@@ -42,6 +42,15 @@ void LuaType<T>::Register(lua_State* L)
     luaL_newmetatable(L, "DO NOT TRASH"); //[3] = metatable named "DO NOT TRASH"
     lua_pop(L,1); //remove the above metatable -> [-1 = 2]
 
+    //cache of the userdata pushed for C++ owned objects, keyed by the object pointer as light userdata
+    //the values are weak so that the userdata can still be garbage collected when Lua is no longer using it
+    lua_newtable(L); //[3] = cache table
+    lua_newtable(L); //[4] = metatable of the cache table
+    lua_pushstring(L, "v");
+    lua_setfield(L, -2, "__mode"); //[4].__mode = "v"
+    lua_setmetatable(L, -2); //[3]'s metatable = [4]; pop [4]
+    lua_setfield(L, metatable, "__cache"); //[metatable = 2].__cache = [3]; pop [3]
+
     //store method table in globals so that scripts can add functions written in Lua
     lua_pushvalue(L, methods); //[methods = 1] -> [3] = copy (reference) of methods table
     lua_setglobal(L, GetTClassName<T>()); // -> <ClassName> = [3 = 1], pop top [3]
@@ -81,39 +90,59 @@ int LuaType<T>::push(lua_State *L, T* obj, bool gc)
     luaL_getmetatable(L, GetTClassName<T>());  // lookup metatable in Lua registry ->[1] = metatable of <ClassName>
     if (lua_isnil(L, -1)) luaL_error(L, "%s missing metatable", GetTClassName<T>());
     int mt = lua_gettop(L); //mt = 1
-    T** ptrHold = (T**)lua_newuserdata(L,sizeof(T**)); //->[2] = empty userdata
-    int ud = lua_gettop(L); //ud = 2
+    lua_getfield(L, mt, "__cache"); //->[2] = cache table of <ClassName>
+    int cache = lua_gettop(L); //cache = 2
+    if(gc == false)
+    {
+        //objects owned by C++ reuse the userdata from any previous push that is still alive
+        lua_pushlightuserdata(L, (void*)obj); // ->[3] = key
+        lua_rawget(L, cache); //->[3] = cache[obj]
+        if(!lua_isnil(L, -1))
+        {
+            lua_replace(L, mt); //move [3] to pos [1], and pop previous [1]
+            lua_settop(L, mt); //remove everything above [1]
+            return mt;
+        }
+        lua_pop(L, 1); //pop [3]
+    }
+    T** ptrHold = (T**)lua_newuserdata(L,sizeof(T**)); //->[3] = empty userdata
+    LuaTypeImpl::RecordUserdataAllocation();
+    int ud = lua_gettop(L); //ud = 3
     if(ptrHold != nullptr)
     {
         *ptrHold = obj; 
-        lua_pushvalue(L, mt); // ->[3] = copy of [1]
-        lua_setmetatable(L, -2); //[-2 = 2] -> [2]'s metatable = [3]; pop [3]
-        char name[max_pointer_string_size];
-        tostring(name, max_pointer_string_size, obj);
-        lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[3] = value returned from function
-        if(lua_isnil(L,-1) ) //if [3] hasn't been created yet, then create it
+        lua_pushvalue(L, mt); // ->[4] = copy of [1]
+        lua_setmetatable(L, -2); //[-2 = 3] -> [3]'s metatable = [4]; pop [4]
+        lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[4] = value returned from function
+        if(lua_isnil(L,-1) ) //if [4] hasn't been created yet, then create it
         {
-            luaL_newmetatable(L,"DO NOT TRASH"); //[4] = the new metatable
             lua_pop(L,1); //pop [4]
+            luaL_newmetatable(L,"DO NOT TRASH"); //[4] = the new metatable
         }
-        lua_pop(L,1); //pop [3]
-        lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[3] = value returned from function
-        if(gc == false) //if we shouldn't garbage collect it, then put the name in to [3]
+        lua_pushlightuserdata(L, (void*)obj); // ->[5] = key
+        if(gc == false) //if we shouldn't garbage collect it, then put the pointer in to [4] and cache the userdata
         {
-            lua_pushboolean(L,1);// ->[4] = true
-            lua_setfield(L,-2,name); //represents t[k] = v, [-2 = 3] = t -> v = [4], k = <ClassName>; pop [4]
+            lua_pushboolean(L,1);// ->[6] = true
+            lua_rawset(L,-3); //represents t[k] = v, [-3 = 4] = t -> v = [6], k = [5]; pop [6] and [5]
+            lua_pushlightuserdata(L, (void*)obj); // ->[5] = key
+            lua_pushvalue(L, ud); // ->[6] = copy of [3]
+            lua_rawset(L, cache); //cache[obj] = [3]; pop [6] and [5]
         }
         else
         {
             //In case this is an address that has been pushed
             //to lua before, we need to set it to nil
-            lua_pushnil(L); // ->[4] = nil
-            lua_setfield(L,-2,name); //represents t[k] = v, [-2 = 3] = t -> v = [4], k = <ClassName>; pop [4]
+            lua_pushnil(L); // ->[6] = nil
+            lua_rawset(L,-3); //represents t[k] = v, [-3 = 4] = t -> v = [6], k = [5]; pop [6] and [5]
+            //and make sure a stale userdata is not reused for the new object
+            lua_pushlightuserdata(L, (void*)obj); // ->[5] = key
+            lua_pushnil(L); // ->[6] = nil
+            lua_rawset(L, cache); //cache[obj] = nil; pop [6] and [5]
         }
 
-        lua_pop(L,1); // -> pop [3]
+        lua_pop(L,1); // -> pop [4]
     }
-    lua_settop(L,ud); //[ud = 2] -> remove everything that is above 2, top = [2]
+    lua_settop(L,ud); //[ud = 3] -> remove everything that is above 3, top = [3]
     lua_replace(L, mt); //[mt = 1] -> move [2] to pos [1], and pop previous [1]
     lua_settop(L, mt); //remove everything above [1]
     return mt;  // index of userdata containing pointer to T object
@@ -140,6 +169,7 @@ int LuaType<T>::thunk(lua_State* L)
     lua_remove(L, 1);  // remove self so member function args start at index 1
     // get member function from upvalue
     RegType *l = static_cast<RegType*>(lua_touserdata(L, lua_upvalueindex(1)));
+    LuaTypeImpl::RecordBindingCall();
     //at the moment, there isn't a case where nullptr is acceptable to be used in the function, so check
     //for it here, rather than individually for each function
     if(obj == nullptr)
@@ -170,9 +200,8 @@ int LuaType<T>::gc_T(lua_State* L)
     lua_getfield(L,LUA_REGISTRYINDEX,"DO NOT TRASH"); //->[2] = return value from this
     if(lua_istable(L,-1) ) //[-1 = 2], if it is a table
     {
-        char name[max_pointer_string_size];
-        tostring(name, max_pointer_string_size, obj);
-        lua_getfield(L,-1,name); //[-1 = 2] -> [3] = the value returned from if <ClassName> exists in the table to not gc
+        lua_pushlightuserdata(L, (void*)obj); // ->[3] = key
+        lua_rawget(L,-2); //[-2 = 2] -> [3] = the value returned from if the pointer exists in the table to not gc
         if(lua_isnoneornil(L,-1) ) //[-1 = 3] if it doesn't exist, then we are free to garbage collect c++ side
 		{
 			delete obj;
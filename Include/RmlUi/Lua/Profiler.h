@@ -0,0 +1,95 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+ 
+ 
+#ifndef RMLUI_LUA_PROFILER_H
+#define RMLUI_LUA_PROFILER_H 
+
+#include "Header.h"
+#include <RmlUi/Core/Types.h>
+
+namespace Rml {
+namespace Lua {
+namespace Profiler {
+    /** The kinds of calls from C++ into Lua measured by the profiler. */
+    enum class Category { EventHandler, DocumentScript, DataModelCallback };
+
+    /** Totals measured by the profiler since it was enabled or last reset. Times are measured with a monotonic
+    high-resolution clock, in seconds. Times are exclusive, the time of a call nested inside another one only counts
+    towards the nested call. */
+    struct Statistics
+    {
+        // Time spent in Lua event listeners, including inline event handlers.
+        double event_handler_time = 0;
+        // Time spent running inline and external scripts of documents.
+        double document_script_time = 0;
+        // Time spent in event callbacks of Lua data models.
+        double data_model_time = 0;
+
+        // Number of calls into Lua event listeners.
+        int event_handler_calls = 0;
+        // Number of document scripts run.
+        int document_script_calls = 0;
+        // Number of calls into event callbacks of Lua data models.
+        int data_model_calls = 0;
+        // Number of calls from Lua into methods, getters and setters of the C++ bindings.
+        int binding_calls = 0;
+        // Number of userdata allocated to push C++ objects to Lua.
+        int userdata_allocations = 0;
+    };
+
+    /** The time spent in a single event handler, document script, or data model callback. */
+    struct Entry
+    {
+        Category category = Category::EventHandler;
+        // The code of inline event handlers, the source location of event listener functions, the path of document
+        // scripts, or the name of data model event callbacks.
+        String name;
+        int calls = 0;
+        double time = 0;
+    };
+    using EntryList = Vector<Entry>;
+
+    /** Enables or disables the profiler, it is disabled by default.
+    @remark While enabled, the time spent in Lua is also added to the script time of the frame statistics of the
+    context doing the work, see Context::GetFrameStatistics(). The entries are ranked in the performance panel of the
+    debugger, see Rml::GetScriptHandlerStatistics(). */
+    RMLUILUA_API void SetEnabled(bool enable);
+    /** @return True if the profiler is enabled. */
+    RMLUILUA_API bool IsEnabled();
+    /** @return The totals measured since the profiler was enabled or last reset. */
+    RMLUILUA_API const Statistics& GetStatistics();
+    /** @return The time spent in each event handler, document script, and data model callback, sorted from most to
+    least time spent. */
+    RMLUILUA_API EntryList GetEntries();
+    /** Clears all statistics and entries. */
+    RMLUILUA_API void Reset();
+}
+} // namespace Lua
+} // namespace Rml
+#endif
@@ -88,6 +88,8 @@ private:
 	Geometry geometry;
 
 	UniquePtr<lunasvg::Document> svg_document;
+	// The source of the document, for rendering parts of the image on other threads.
+	String svg_source;
 };
 
 } // namespace Rml
@@ -37,6 +37,9 @@
 ElementGame::ElementGame(const Rml::String& tag) : Rml::Element(tag)
 {
 	game = new Game();
+
+	// The game is animated, keep updating every frame.
+	SetUpdateEveryFrame(true);
 }
 
 ElementGame::~ElementGame()
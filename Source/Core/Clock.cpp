@@ -27,8 +27,10 @@
  */
 
 #include "Clock.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include <chrono>
 
 namespace Rml {
 
@@ -41,4 +43,17 @@ RMLUICORE_API double Clock::GetElapsedTime()
 		return 0;
 }
 
+RMLUICORE_API double Clock::GetElapsedTime(const Context* context)
+{
+	if (context != nullptr)
+		return context->GetElapsedTime();
+	return GetElapsedTime();
+}
+
+RMLUICORE_API double Clock::GetSteadyTime()
+{
+	using namespace std::chrono;
+	return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
 } // namespace Rml
@@ -33,6 +33,8 @@
 
 namespace Rml {
 
+class Context;
+
 /**
 	RmlUi's Interface to Time.
 
@@ -44,6 +46,15 @@ public:
 	/// Get the elapsed time since application startup
 	/// @return Seconds elapsed since application startup.
 	RMLUICORE_API static double GetElapsedTime();
+	/// Get the current time of the given context, which may be overridden by the context.
+	/// @param[in] context The context, or nullptr to use the elapsed time since application startup.
+	/// @return Seconds elapsed according to the context.
+	RMLUICORE_API static double GetElapsedTime(const Context* context);
+
+	/// Get the time from a monotonic high-resolution clock, independent of the application's clock.
+	/// Used for measuring how long work takes, only the difference between two times is meaningful.
+	/// @return Seconds elapsed since an unspecified point in time.
+	RMLUICORE_API static double GetSteadyTime();
 };
 
 } // namespace Rml
@@ -33,13 +33,16 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/InputRecording.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "Clock.h"
 #include "DataModel.h"
 #include "EventDispatcher.h"
+#include "FrameStatisticsRecorder.h"
 #include "PluginRegistry.h"
 #include "StreamFile.h"
 #include <algorithm>
@@ -58,6 +61,8 @@ Context::Context(const String& name) : name(name), dimensions(0, 0), density_ind
 	// Initialise this to nullptr; this will be set in Rml::CreateContext().
 	render_interface = nullptr;
 
+	frame_statistics_recorder = MakeUnique<FrameStatisticsRecorder>();
+
 	root = Factory::InstanceElement(nullptr, "*", "#root", XMLAttributes());
 	root->SetId(name);
 	root->SetOffset(Vector2f(0, 0), nullptr);
@@ -90,6 +95,9 @@ Context::~Context()
 {
 	PluginRegistry::NotifyContextDestroy(this);
 
+	if (input_recorder)
+		input_recorder->context = nullptr;
+
 	UnloadAllDocuments();
 
 	ReleaseUnloadedDocuments();
@@ -114,6 +122,9 @@ void Context::SetDimensions(const Vector2i _dimensions)
 {
 	if (dimensions != _dimensions)
 	{
+		if (input_recorder)
+			input_recorder->RecordDimensions(_dimensions);
+
 		dimensions = _dimensions;
 		root->SetBox(Box(Vector2f(dimensions)));
 		root->DirtyLayout();
@@ -132,6 +143,7 @@ void Context::SetDimensions(const Vector2i _dimensions)
 		}
 		
 		clip_dimensions = dimensions;
+		render_dirty = true;
 	}
 }
 
@@ -169,25 +181,90 @@ bool Context::Update()
 {
 	RMLUI_ZoneScoped;
 
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+	FrameStatisticsTimer update_timer(&FrameStatistics::update_time);
+
+	if (input_recorder)
+		input_recorder->RecordUpdate();
+
 	// Update all data models first
-	for (auto& data_model : data_models)
-		data_model.second->Update(true);
+	{
+		FrameStatisticsTimer data_model_timer(&FrameStatistics::data_model_time);
+		for (auto& data_model : data_models)
+		{
+			if (!data_model.second->IsDirty())
+				continue;
+
+			render_dirty = true;
+			if (data_model.second->Update(true))
+				frame_statistics_recorder->GetStatistics().data_model_updates += 1;
+		}
+	}
 
-	root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	// Elements updated every frame register themselves again during the element update below.
+	for (Element* element : frame_update_elements)
+		element->RequestUpdate();
+	frame_update_elements.clear();
+
+	// Clean subtrees are skipped by the elements themselves, here we only need to know if anything changed.
+	if (root->update_dirty || root->update_descendants_dirty)
+	{
+		render_dirty = true;
+		root->Update(density_independent_pixel_ratio, Vector2f(dimensions));
+	}
 
 	for (int i = 0; i < root->GetNumChildren(); ++i)
 		if (auto doc = root->GetChild(i)->GetOwnerDocument())
 		{
+			if (doc->layout_dirty || doc->position_dirty)
+				render_dirty = true;
+
 			doc->UpdateLayout();
 			doc->UpdatePosition();
 		}
 
 	// Release any documents that were unloaded during the update.
-	ReleaseUnloadedDocuments();
+	if (!unloaded_documents.empty())
+	{
+		render_dirty = true;
+		ReleaseUnloadedDocuments();
+	}
 
 	return true;
 }
 
+bool Context::NeedsUpdate() const
+{
+	if (root->update_dirty || root->update_descendants_dirty || !frame_update_elements.empty() || !unloaded_documents.empty())
+		return true;
+
+	for (int i = 0; i < root->GetNumChildren(); ++i)
+		if (auto doc = root->GetChild(i)->GetOwnerDocument())
+		{
+			if (doc->layout_dirty || doc->position_dirty)
+				return true;
+		}
+
+	for (auto& data_model : data_models)
+	{
+		if (data_model.second->IsDirty())
+			return true;
+	}
+
+	return false;
+}
+
+void Context::AddFrameUpdateElement(Element* element)
+{
+	if (std::find(frame_update_elements.begin(), frame_update_elements.end(), element) == frame_update_elements.end())
+		frame_update_elements.push_back(element);
+}
+
+bool Context::NeedsRender() const
+{
+	return render_dirty;
+}
+
 // Renders all visible elements in the element tree.
 bool Context::Render()
 {
@@ -197,6 +274,9 @@ bool Context::Render()
 	if (render_interface == nullptr)
 		return false;
 
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+	const double render_start_time = Clock::GetSteadyTime();
+
 	render_interface->context = this;
 	ElementUtilities::ApplyActiveClipRegion(this, render_interface);
 
@@ -215,10 +295,54 @@ bool Context::Render()
 	}
 
 	render_interface->context = nullptr;
+	render_dirty = false;
+
+	// Rendering ends the frame.
+	frame_statistics_recorder->GetStatistics().render_time += Clock::GetSteadyTime() - render_start_time;
+	frame_statistics_recorder->EndFrame();
 
 	return true;
 }
 
+const FrameStatistics& Context::GetFrameStatistics() const
+{
+	return frame_statistics_recorder->GetFrameStatistics();
+}
+
+void Context::SetElementStatisticsEnabled(bool enable)
+{
+	frame_statistics_recorder->SetElementStatisticsEnabled(enable);
+}
+
+bool Context::IsElementStatisticsEnabled() const
+{
+	return frame_statistics_recorder->IsElementStatisticsEnabled();
+}
+
+const ElementStatisticsList& Context::GetElementStatistics() const
+{
+	return frame_statistics_recorder->GetElementStatistics();
+}
+
+void Context::SetTimeOverride(double time)
+{
+	use_time_override = true;
+	time_override = time;
+}
+
+void Context::ClearTimeOverride()
+{
+	use_time_override = false;
+	time_override = 0;
+}
+
+double Context::GetElapsedTime() const
+{
+	if (use_time_override)
+		return time_override;
+	return Clock::GetElapsedTime();
+}
+
 // Creates a new, empty document and places it into this context. 
 ElementDocument* Context::CreateDocument(const String& instancer_name)
 {
@@ -469,6 +593,7 @@ void Context::PullDocumentToFront(ElementDocument* document)
 				root->children.insert(root->children.begin() + root->GetNumChildren(), std::move(element));
 
 				root->DirtyStackingContext();
+				render_dirty = true;
 			}
 		}
 	}
@@ -489,6 +614,7 @@ void Context::PushDocumentToBack(ElementDocument* document)
 				root->children.insert(root->children.begin(), std::move(element));
 
 				root->DirtyStackingContext();
+				render_dirty = true;
 			}
 		}
 	}
@@ -519,6 +645,11 @@ void Context::RemoveEventListener(const String& event, EventListener* listener,
 // Sends a key down event into RmlUi.
 bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordKeyDown(key_identifier, key_modifier_state);
+
 	// Generate the parameters for the key event.
 	Dictionary parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
@@ -533,6 +664,11 @@ bool Context::ProcessKeyDown(Input::KeyIdentifier key_identifier, int key_modifi
 // Sends a key up event into RmlUi.
 bool Context::ProcessKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordKeyUp(key_identifier, key_modifier_state);
+
 	// Generate the parameters for the key event.
 	Dictionary parameters;
 	GenerateKeyEventParameters(parameters, key_identifier);
@@ -563,6 +699,11 @@ bool Context::ProcessTextInput(Character character)
 // Sends a string of text as text input into RmlUi.
 bool Context::ProcessTextInput(const String& string)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordTextInput(string);
+
 	Element* target = (focus ? focus : root.get());
 
 	Dictionary parameters;
@@ -576,6 +717,11 @@ bool Context::ProcessTextInput(const String& string)
 // Sends a mouse movement event into RmlUi.
 bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordMouseMove(x, y, key_modifier_state);
+
 	// Check whether the mouse moved since the last event came through.
 	Vector2i old_mouse_position = mouse_position;
 	bool mouse_moved = (x != mouse_position.x) || (y != mouse_position.y);
@@ -602,6 +748,10 @@ bool Context::ProcessMouseMove(int x, int y, int key_modifier_state)
 	// Dispatch any 'onmousemove' events.
 	if (mouse_moved)
 	{
+		// The drag clone follows the mouse cursor.
+		if (drag_clone)
+			render_dirty = true;
+
 		if (hover)
 		{
 			hover->DispatchEvent(EventId::Mousemove, parameters);
@@ -632,6 +782,11 @@ static Element* FindFocusElement(Element* element)
 // Sends a mouse-button down event into RmlUi.
 bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordMouseButtonDown(button_index, key_modifier_state);
+
 	Dictionary parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
@@ -667,7 +822,7 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 			float mouse_distance_squared = float((mouse_position - last_click_mouse_position).SquaredMagnitude());
 			float max_mouse_distance = DOUBLE_CLICK_MAX_DIST * density_independent_pixel_ratio;
 
-			double click_time = GetSystemInterface()->GetElapsedTime();
+			double click_time = GetElapsedTime();
 
 			if (active == last_click_element &&
 				float(click_time - last_click_time) < DOUBLE_CLICK_TIME &&
@@ -722,6 +877,11 @@ bool Context::ProcessMouseButtonDown(int button_index, int key_modifier_state)
 // Sends a mouse-button up event into RmlUi.
 bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordMouseButtonUp(button_index, key_modifier_state);
+
 	Dictionary parameters;
 	GenerateMouseEventParameters(parameters, button_index);
 	GenerateKeyModifierEventParameters(parameters, key_modifier_state);
@@ -798,6 +958,11 @@ bool Context::ProcessMouseButtonUp(int button_index, int key_modifier_state)
 // Sends a mouse-wheel movement event into RmlUi.
 bool Context::ProcessMouseWheel(float wheel_delta, int key_modifier_state)
 {
+	FrameStatisticsScope statistics_scope(frame_statistics_recorder.get());
+
+	if (input_recorder)
+		input_recorder->RecordMouseWheel(wheel_delta, key_modifier_state);
+
 	if (hover)
 	{
 		Dictionary scroll_parameters;
@@ -944,6 +1109,9 @@ void Context::OnElementDetach(Element* element)
 	if (element == focus)
 		focus = nullptr;
 
+	if (element->update_every_frame)
+		frame_update_elements.erase(std::remove(frame_update_elements.begin(), frame_update_elements.end(), element), frame_update_elements.end());
+
 	// If the element is a document lower down in the hierarchy, we may need to remove it from the focus history.
 	if (element->GetOwnerDocument() == element)
 	{
@@ -1119,6 +1287,8 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 {
 	if (element == nullptr)
 	{
+		frame_statistics_recorder->GetStatistics().hit_tests += 1;
+
 		if (ignore_element == root.get())
 			return nullptr;
 
@@ -1146,6 +1316,8 @@ Element* Context::GetElementAtPoint(Vector2f point, const Element* ignore_elemen
 	{
 		if (element->stacking_context_dirty)
 			element->BuildLocalStackingContext();
+		else if (!element->stacking_context_added.empty())
+			element->UpdateLocalStackingContext();
 
 		for (int i = (int) element->stacking_context.size() - 1; i >= 0; --i)
 		{
@@ -1224,6 +1396,7 @@ void Context::CreateDragClone(Element* element)
 
 	// Append the clone to the cursor proxy element.
 	cursor_proxy->AppendChild(std::move(element_drag_clone));
+	render_dirty = true;
 
 	// Set all the required properties and pseudo-classes on the clone.
 	drag_clone->SetPseudoClass("drag", true);
@@ -1239,6 +1412,7 @@ void Context::ReleaseDragClone()
 	{
 		cursor_proxy->RemoveChild(drag_clone);
 		drag_clone = nullptr;
+		render_dirty = true;
 		static_cast<ElementDocument&>(*cursor_proxy).SetStyleSheetContainer(nullptr);
 	}
 }
@@ -1298,6 +1472,15 @@ void Context::ReleaseUnloadedDocuments()
 		OwnedElementList documents = std::move(unloaded_documents);
 		unloaded_documents.clear();
 
+		// Elements detached along with their document are not unregistered individually, remove them before they are released.
+		auto in_released_document = [&documents](Element* element) {
+			Element* top = element;
+			while (Element* parent = top->GetParentNode())
+				top = parent;
+			return std::any_of(documents.begin(), documents.end(), [top](const ElementPtr& document) { return document.get() == top; });
+		};
+		frame_update_elements.erase(std::remove_if(frame_update_elements.begin(), frame_update_elements.end(), in_released_document), frame_update_elements.end());
+
 		// Clear the deleted list.
 		for (size_t i = 0; i < documents.size(); ++i)
 			documents[i]->GetEventDispatcher()->DetachAllEvents();
@@ -1305,7 +1488,8 @@ void Context::ReleaseUnloadedDocuments()
 	}
 }
 
-using ElementObserverList = Vector< ObserverPtr<Element> >;
+// Elements paired with their depth in the hierarchy.
+using ElementObserverList = Vector< Pair< int, ObserverPtr<Element> > >;
 
 class ElementObserverListBackInserter {
 public:
@@ -1318,7 +1502,10 @@ public:
 
 	ElementObserverListBackInserter(ElementObserverList& elements) : elements(&elements) {}
 	ElementObserverListBackInserter& operator=(Element* element) {
-		elements->push_back(element->GetObserverPtr());
+		int depth = 0;
+		for (Element* ancestor = element->GetParentNode(); ancestor; ancestor = ancestor->GetParentNode())
+			depth++;
+		elements->emplace_back(depth, element->GetObserverPtr());
 		return *this;
 	}
 	ElementObserverListBackInserter& operator*() { return *this; }
@@ -1335,8 +1522,16 @@ void Context::SendEvents(const ElementSet& old_items, const ElementSet& new_item
 	// We put our elements in observer pointers in case some of them are deleted during dispatch.
 	ElementObserverList elements;
 	std::set_difference(old_items.begin(), old_items.end(), new_items.begin(), new_items.end(), ElementObserverListBackInserter(elements));
-	for (auto& element : elements)
+
+	// The sets are ordered by address. Each chain is a single path to the root, so dispatch from the innermost element
+	// outwards to make the order independent of where the elements were allocated.
+	std::stable_sort(elements.begin(), elements.end(), [](const ElementObserverList::value_type& lhs, const ElementObserverList::value_type& rhs) {
+		return lhs.first > rhs.first;
+	});
+
+	for (auto& entry : elements)
 	{
+		ObserverPtr<Element>& element = entry.second;
 		if (element)
 			element->DispatchEvent(id, parameters);
 	}
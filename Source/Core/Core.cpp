@@ -31,21 +31,27 @@
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/FontEngineInterface.h"
+#include "../../Include/RmlUi/Core/MemoryInterface.h"
 #include "../../Include/RmlUi/Core/Plugin.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "../../Include/RmlUi/Core/TaskInterface.h"
 #include "../../Include/RmlUi/Core/Types.h"
 
 #include "EventSpecification.h"
 #include "FileInterfaceDefault.h"
 #include "GeometryDatabase.h"
+#include "MemoryUsage.h"
 #include "PluginRegistry.h"
+#include "Pool.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetParser.h"
 #include "TemplateCache.h"
 #include "TextureDatabase.h"
 #include "EventSpecification.h"
+#include <mutex>
+#include <stdint.h>
 
 #ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
 #include "FontEngineDefault/FontEngineInterfaceDefault.h"
@@ -70,15 +76,22 @@ static SystemInterface* system_interface = nullptr;
 static FileInterface* file_interface = nullptr;
 // RmlUi's font engine interface.
 static FontEngineInterface* font_interface = nullptr;
+// RmlUi's memory interface, or nullptr to use the global heap.
+static MemoryInterface* memory_interface = nullptr;
+// RmlUi's task interface.
+static TaskInterface* task_interface = nullptr;
 
 // Default interfaces should be created and destroyed on Initialise and Shutdown, respectively.
 static UniquePtr<FileInterface> default_file_interface;
 static UniquePtr<FontEngineInterface> default_font_interface;
+static UniquePtr<TaskInterface> default_task_interface;
 
 static bool initialised = false;
 
 using ContextMap = UnorderedMap< String, ContextPtr >;
 static ContextMap contexts;
+// Guards the context map, so that contexts may be looked up while other contexts are being created or removed.
+static std::recursive_mutex contexts_mutex;
 
 #ifndef RMLUI_VERSION
 	#define RMLUI_VERSION "custom"
@@ -109,6 +122,13 @@ bool Initialise()
 #endif
 	}
 
+	if (!task_interface)
+	{
+		// The base task interface runs all tasks serially.
+		default_task_interface = MakeUnique<TaskInterface>();
+		task_interface = default_task_interface.get();
+	}
+
 	EventSpecificationInterface::Initialize();
 
 	TextureDatabase::Initialise();
@@ -169,13 +189,18 @@ void Shutdown()
 
 	TextureDatabase::Shutdown();
 
+	// Return the memory held by now empty pools to the memory interface.
+	PoolBase::ReleaseAllUnusedChunks();
+
 	initialised = false;
 
 	render_interface = nullptr;
 	file_interface = nullptr;
 	system_interface = nullptr;
+	task_interface = nullptr;
 
 	default_file_interface.reset();
+	default_task_interface.reset();
 
 	Log::Shutdown();
 }
@@ -234,6 +259,60 @@ FontEngineInterface* GetFontEngineInterface()
 	return font_interface;
 }
 
+// Sets the interface through which all memory is allocated.
+void SetMemoryInterface(MemoryInterface* _memory_interface)
+{
+	RMLUI_ASSERTMSG(!initialised, "The memory interface must be set before RmlUi is initialised.");
+	memory_interface = _memory_interface;
+}
+
+// Returns RmlUi's memory interface.
+MemoryInterface* GetMemoryInterface()
+{
+	return memory_interface;
+}
+
+// Sets the interface through which work is scheduled to run in parallel.
+void SetTaskInterface(TaskInterface* _task_interface)
+{
+	RMLUI_ASSERTMSG(!initialised, "The task interface must be set before RmlUi is initialised.");
+	task_interface = _task_interface;
+}
+
+// Returns RmlUi's task interface.
+TaskInterface* GetTaskInterface()
+{
+	return task_interface;
+}
+
+void* Memory::Allocate(size_t size, size_t alignment, MemoryCategory category)
+{
+	if (memory_interface)
+		return memory_interface->Allocate(size, alignment, category);
+
+	if (alignment <= alignof(std::max_align_t))
+		return ::operator new(size);
+
+	// Over-aligned allocation, store the address of the underlying allocation just before the returned block.
+	void* data = ::operator new(size + alignment + sizeof(void*));
+	uintptr_t aligned = (reinterpret_cast<uintptr_t>(data) + sizeof(void*) + alignment - 1) & ~(uintptr_t)(alignment - 1);
+	reinterpret_cast<void**>(aligned)[-1] = data;
+	return reinterpret_cast<void*>(aligned);
+}
+
+void Memory::Deallocate(void* ptr, size_t size, size_t alignment, MemoryCategory category)
+{
+	if (!ptr)
+		return;
+
+	if (memory_interface)
+		memory_interface->Deallocate(ptr, size, alignment, category);
+	else if (alignment <= alignof(std::max_align_t))
+		::operator delete(ptr);
+	else
+		::operator delete(reinterpret_cast<void**>(ptr)[-1]);
+}
+
 // Creates a new element context.
 Context* CreateContext(const String& name, const Vector2i dimensions, RenderInterface* custom_render_interface)
 {
@@ -268,7 +347,14 @@ Context* CreateContext(const String& name, const Vector2i dimensions, RenderInte
 	new_context->SetDimensions(dimensions);
 
 	Context* new_context_raw = new_context.get();
-	contexts[name] = std::move(new_context);
+	{
+		std::lock_guard<std::recursive_mutex> lock(contexts_mutex);
+		if (!contexts.emplace(name, std::move(new_context)).second)
+		{
+			Log::Message(Log::LT_WARNING, "Failed to create context '%s', context already exists.", name.c_str());
+			return nullptr;
+		}
+	}
 
 	PluginRegistry::NotifyContextCreate(new_context_raw);
 
@@ -277,18 +363,26 @@ Context* CreateContext(const String& name, const Vector2i dimensions, RenderInte
 
 bool RemoveContext(const String& name)
 {
-	auto it = contexts.find(name);
-	if (it != contexts.end())
+	ContextPtr context;
 	{
+		std::lock_guard<std::recursive_mutex> lock(contexts_mutex);
+		auto it = contexts.find(name);
+		if (it == contexts.end())
+			return false;
+
+		context = std::move(it->second);
 		contexts.erase(it);
-		return true;
 	}
-	return false;
+
+	// Destroy the context outside the lock, as its destruction may call back into the context functions.
+	context.reset();
+	return true;
 }
 
 // Fetches a previously constructed context by name.
 Context* GetContext(const String& name)
 {
+	std::lock_guard<std::recursive_mutex> lock(contexts_mutex);
 	ContextMap::iterator i = contexts.find(name);
 	if (i == contexts.end())
 		return nullptr;
@@ -299,6 +393,7 @@ Context* GetContext(const String& name)
 // Fetches a context by index.
 Context* GetContext(int index)
 {
+	std::lock_guard<std::recursive_mutex> lock(contexts_mutex);
 	ContextMap::iterator i = contexts.begin();
 	int count = 0;
 	
@@ -320,6 +415,7 @@ Context* GetContext(int index)
 // Returns the number of active contexts.
 int GetNumContexts()
 {
+	std::lock_guard<std::recursive_mutex> lock(contexts_mutex);
 	return (int) contexts.size();
 }
 
@@ -371,4 +467,24 @@ void ReleaseCompiledGeometry()
 	return GeometryDatabase::ReleaseAll();
 }
 
+MemoryStatistics GetMemoryStatistics()
+{
+	MemoryStatistics statistics;
+
+	MemoryUsage::AddElements(statistics);
+	MemoryUsage::AddStyleSheets(statistics);
+	MemoryUsage::AddStyleSheetNodes(statistics);
+	MemoryUsage::AddElementDefinitions(statistics);
+	MemoryUsage::AddGeometry(statistics);
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	MemoryUsage::AddFontAtlases(statistics);
+#endif
+	MemoryUsage::AddTextures(statistics);
+	MemoryUsage::AddDataModels(statistics);
+	MemoryUsage::AddDataViews(statistics);
+	MemoryUsage::AddLayoutChunks(statistics);
+
+	return statistics;
+}
+
 } // namespace Rml
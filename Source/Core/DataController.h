@@ -100,7 +100,7 @@ private:
 };
 
 
-class DataControllers : NonCopyMoveable {
+class DataControllers : NonCopyMoveable, public Allocated<MemoryCategory::DataBinding> {
 public:
     DataControllers();
     ~DataControllers();
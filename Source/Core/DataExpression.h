@@ -59,7 +59,7 @@ private:
 };
 
 
-class DataExpression {
+class DataExpression : public Allocated<MemoryCategory::DataBinding> {
 public:
     DataExpression(String expression);
     ~DataExpression();
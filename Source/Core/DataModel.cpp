@@ -31,6 +31,8 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "DataController.h"
 #include "DataView.h"
+#include "MemoryUsage.h"
+#include <atomic>
 
 namespace Rml {
 
@@ -120,15 +122,19 @@ static String DataAddressToString(const DataAddress& address)
 	return result;
 }
 
+static std::atomic<int> num_data_models{0};
+
 DataModel::DataModel(const TransformFuncRegister* transform_register) : transform_register(transform_register)
 {
 	views = MakeUnique<DataViews>();
 	controllers = MakeUnique<DataControllers>();
+	num_data_models += 1;
 }
 
 DataModel::~DataModel()
 {
 	RMLUI_ASSERT(attached_elements.empty());
+	num_data_models -= 1;
 }
 
 void DataModel::AddView(DataViewPtr view) {
@@ -376,4 +382,16 @@ bool DataModel::Update(bool clear_dirty_variables)
 	return result;
 }
 
+bool DataModel::IsDirty() const
+{
+	return !dirty_variables.empty() || views->IsDirty();
+}
+
+void MemoryUsage::AddDataModels(MemoryStatistics& statistics)
+{
+	const int count = num_data_models;
+	statistics.data_models.count += count;
+	statistics.data_models.bytes += count * (sizeof(DataModel) + sizeof(DataViews) + sizeof(DataControllers));
+}
+
 } // namespace Rml
@@ -44,7 +44,7 @@ class Element;
 class FuncDefinition;
 
 
-class DataModel : NonCopyMoveable {
+class DataModel : NonCopyMoveable, public Allocated<MemoryCategory::DataBinding> {
 public:
 	DataModel(const TransformFuncRegister* transform_register = nullptr);
 	~DataModel();
@@ -79,6 +79,9 @@ public:
 
 	bool Update(bool clear_dirty_variables);
 
+	// Returns true if there are any dirty variables or views to be updated.
+	bool IsDirty() const;
+
 private:
 	UniquePtr<DataViews> views;
 	UniquePtr<DataControllers> controllers;
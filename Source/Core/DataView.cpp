@@ -28,12 +28,19 @@
 
 #include "DataView.h"
 #include "../../Include/RmlUi/Core/Element.h"
+#include "FrameStatisticsRecorder.h"
+#include "MemoryUsage.h"
 #include <algorithm>
+#include <atomic>
 
 namespace Rml {
 
+static std::atomic<int> num_data_views{0};
+
 DataView::~DataView()
-{}
+{
+	num_data_views -= 1;
+}
 
 Element* DataView::GetElement() const
 {
@@ -53,6 +60,7 @@ bool DataView::IsValid() const {
 
 DataView::DataView(Element* element, int bias) : attached_element(element->GetObserverPtr()), sort_order(bias + 1000) {
 	RMLUI_ASSERT(bias >= -1000 && bias <= 999);
+	num_data_views += 1;
 
 	if (element)
 	{
@@ -131,6 +139,8 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 		// Eg. the 'data-for' view will remove children if any of its data variable array size is reduced.
 		std::sort(dirty_views.begin(), dirty_views.end(), [](auto&& left, auto&& right) { return left->GetSortOrder() < right->GetSortOrder(); });
 
+		FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive();
+
 		for (DataView* view : dirty_views)
 		{
 			RMLUI_ASSERT(view);
@@ -138,7 +148,14 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 				continue;
 
 			if (view->IsValid())
-				result |= view->Update(model);
+			{
+				if (view->Update(model))
+				{
+					result = true;
+					if (recorder && view->GetElement())
+						recorder->RecordElementFlags(view->GetElement(), ElementStatistics::DataViewUpdated);
+				}
+			}
 		}
 
 		// Destroy views marked for destruction
@@ -163,4 +180,16 @@ bool DataViews::Update(DataModel& model, const DirtyVariables& dirty_variables)
 	return result;
 }
 
+bool DataViews::IsDirty() const
+{
+	return !views_to_add.empty() || !views_to_remove.empty();
+}
+
+void MemoryUsage::AddDataViews(MemoryStatistics& statistics)
+{
+	const int count = num_data_views;
+	statistics.data_views.count += count;
+	statistics.data_views.bytes += count * sizeof(DataView);
+}
+
 } // namespace Rml
@@ -66,7 +66,7 @@ public:
 	The modifier may or may not be required depending on the data view.
  */
 
-class DataView : public Releasable {
+class DataView : public Releasable, public Allocated<MemoryCategory::DataBinding> {
 public:
 	virtual ~DataView();
 
@@ -108,7 +108,7 @@ private:
 
 
 
-class DataViews : NonCopyMoveable {
+class DataViews : NonCopyMoveable, public Allocated<MemoryCategory::DataBinding> {
 public:
 	DataViews();
 	~DataViews();
@@ -119,6 +119,9 @@ public:
 
 	bool Update(DataModel& model, const DirtyVariables& dirty_variables);
 
+	// Returns true if any views are waiting to be added or removed.
+	bool IsDirty() const;
+
 private:
 	using DataViewList = Vector<DataViewPtr>;
 
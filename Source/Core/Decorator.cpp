@@ -42,6 +42,11 @@ Decorator::~Decorator()
 {
 }
 
+bool Decorator::IsElementDataShareable() const
+{
+	return false;
+}
+
 int Decorator::AddTexture(const Texture& texture)
 {
 	if (!texture)
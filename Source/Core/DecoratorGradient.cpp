@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorGradient.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
@@ -66,7 +67,7 @@ bool DecoratorGradient::Initialise(const Direction dir_, const Colourb start_, c
 
 DecoratorDataHandle DecoratorGradient::GenerateElementData(Element* element) const
 {
-	Geometry* geometry = new Geometry(element);
+	Geometry* geometry = new Geometry(element->GetContext());
 	const Box& box = element->GetBox();
 
 	const ComputedValues& computed = element->GetComputedValues();
@@ -122,6 +123,11 @@ void DecoratorGradient::RenderElement(Element* element, DecoratorDataHandle elem
 	data->Render(element->GetAbsoluteOffset(Box::BORDER));
 }
 
+bool DecoratorGradient::IsElementDataShareable() const
+{
+	return true;
+}
+
 //=======================================================
 
 DecoratorGradientInstancer::DecoratorGradientInstancer()
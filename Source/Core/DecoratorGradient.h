@@ -50,6 +50,8 @@ public:
 
 	void RenderElement(Element* element, DecoratorDataHandle element_data) const override;
 
+	bool IsElementDataShareable() const override;
+
 private:
 	Direction dir;
 	Colourb start, stop;
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorNinePatch.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
@@ -61,7 +62,7 @@ DecoratorDataHandle DecoratorNinePatch::GenerateElementData(Element* element) co
 	RenderInterface* render_interface = element->GetRenderInterface();
 	const auto& computed = element->GetComputedValues();
 
-	Geometry* data = new Geometry(element);
+	Geometry* data = new Geometry(element->GetContext());
 
 	const Texture* texture = GetTexture();
 	data->SetTexture(texture);
@@ -182,6 +183,20 @@ void DecoratorNinePatch::RenderElement(Element* element, DecoratorDataHandle ele
 	data->Render(element->GetAbsoluteOffset(Box::PADDING));
 }
 
+bool DecoratorNinePatch::IsElementDataShareable() const
+{
+	// Edges relative to the root font size or the viewport may resolve differently for elements that are otherwise equal.
+	if (edges)
+	{
+		for (const Property& edge : *edges)
+		{
+			if (edge.unit & (Property::REM | Property::VW | Property::VH))
+				return false;
+		}
+	}
+	return true;
+}
+
 
 
 DecoratorNinePatchInstancer::DecoratorNinePatchInstancer()
@@ -49,6 +49,8 @@ public:
 
 	void RenderElement(Element* element, DecoratorDataHandle element_data) const override;
 
+	bool IsElementDataShareable() const override;
+
 private:
 	Rectangle rect_outer, rect_inner;
 	float display_scale = 1;
@@ -44,6 +44,11 @@ DecoratorTiled::~DecoratorTiled()
 {
 }
 
+bool DecoratorTiled::IsElementDataShareable() const
+{
+	return true;
+}
+
 static const Vector2f oriented_texcoords[4][2] = {
 	{Vector2f(0, 0), Vector2f(1, 1)},   // ORIENTATION_NONE
 	{Vector2f(1, 0), Vector2f(0, 1)},   // FLIP_HORIZONTAL
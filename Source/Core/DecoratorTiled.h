@@ -49,6 +49,9 @@ public:
 	DecoratorTiled();
 	virtual ~DecoratorTiled();
 
+	/// Tiled decorators only depend on the element's box and shared values, their element data can be shared.
+	bool IsElementDataShareable() const override;
+
 	/**
 		Stores the orientation of a tile.
 	 */
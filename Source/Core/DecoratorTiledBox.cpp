@@ -27,27 +27,23 @@
  */
 
 #include "DecoratorTiledBox.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 
 namespace Rml {
 
-struct DecoratorTiledBoxData
+struct DecoratorTiledBoxData : public Allocated<MemoryCategory::Element>
 {
-	DecoratorTiledBoxData(Element* host_element, int num_textures) : num_textures(num_textures)
+	DecoratorTiledBoxData(Context* host_context, int num_textures) : num_textures(num_textures)
 	{
-		geometry = new Geometry[num_textures];
+		geometry.reserve(num_textures);
 		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledBoxData()
-	{
-		delete[] geometry;
+			geometry.emplace_back(host_context);
 	}
 
 	const int num_textures;
-	Geometry* geometry;
+	GeometryList geometry;
 };
 
 DecoratorTiledBox::DecoratorTiledBox()
@@ -207,7 +203,7 @@ DecoratorDataHandle DecoratorTiledBox::GenerateElementData(Element* element) con
 	}
 
 	const int num_textures = GetNumTextures();
-	DecoratorTiledBoxData* data = new DecoratorTiledBoxData(element, num_textures);
+	DecoratorTiledBoxData* data = new DecoratorTiledBoxData(element->GetContext(), num_textures);
 
 	// Generate the geometry for the top-left tile.
 	tiles[TOP_LEFT_CORNER].GenerateGeometry(data->geometry[tiles[TOP_LEFT_CORNER].texture_index].GetVertices(),
@@ -27,28 +27,24 @@
  */
 
 #include "DecoratorTiledHorizontal.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/Texture.h"
 
 namespace Rml {
 
-struct DecoratorTiledHorizontalData
+struct DecoratorTiledHorizontalData : public Allocated<MemoryCategory::Element>
 {
-	DecoratorTiledHorizontalData(Element* host_element, int num_textures) : num_textures(num_textures)
+	DecoratorTiledHorizontalData(Context* host_context, int num_textures) : num_textures(num_textures)
 	{
-		geometry = new Geometry[num_textures];
+		geometry.reserve(num_textures);
 		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledHorizontalData()
-	{
-		delete[] geometry;
+			geometry.emplace_back(host_context);
 	}
 
 	const int num_textures;
-	Geometry* geometry;
+	GeometryList geometry;
 };
 
 DecoratorTiledHorizontal::DecoratorTiledHorizontal()
@@ -97,7 +93,7 @@ DecoratorDataHandle DecoratorTiledHorizontal::GenerateElementData(Element* eleme
 		tiles[i].CalculateDimensions(element, *(GetTexture(tiles[i].texture_index)));
 
 	const int num_textures = GetNumTextures();
-	DecoratorTiledHorizontalData* data = new DecoratorTiledHorizontalData(element, num_textures);
+	DecoratorTiledHorizontalData* data = new DecoratorTiledHorizontalData(element->GetContext(), num_textures);
 
 	Vector2f padded_size = element->GetBox().GetSize(Box::PADDING);
 
@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledImage.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -54,7 +55,7 @@ DecoratorDataHandle DecoratorTiledImage::GenerateElementData(Element* element) c
 	// Calculate the tile's dimensions for this element.
 	tile.CalculateDimensions(element, *GetTexture(tile.texture_index));
 
-	Geometry* data = new Geometry(element);
+	Geometry* data = new Geometry(element->GetContext());
 	data->SetTexture(GetTexture());
 
 	// Generate the geometry for the tile.
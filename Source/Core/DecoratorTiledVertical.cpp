@@ -27,6 +27,7 @@
  */
 
 #include "DecoratorTiledVertical.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
@@ -34,22 +35,17 @@
 
 namespace Rml {
 
-struct DecoratorTiledVerticalData
+struct DecoratorTiledVerticalData : public Allocated<MemoryCategory::Element>
 {
-	DecoratorTiledVerticalData(Element* host_element, int num_textures) : num_textures(num_textures)
+	DecoratorTiledVerticalData(Context* host_context, int num_textures) : num_textures(num_textures)
 	{
-		geometry = new Geometry[num_textures];
+		geometry.reserve(num_textures);
 		for (int i = 0; i < num_textures; i++)
-			geometry[i].SetHostElement(host_element);
-	}
-
-	~DecoratorTiledVerticalData()
-	{
-		delete[] geometry;
+			geometry.emplace_back(host_context);
 	}
 
 	const int num_textures;
-	Geometry* geometry;
+	GeometryList geometry;
 };
 
 DecoratorTiledVertical::DecoratorTiledVertical()
@@ -98,7 +94,7 @@ DecoratorDataHandle DecoratorTiledVertical::GenerateElementData(Element* element
 		tiles[i].CalculateDimensions(element, *GetTexture(tiles[i].texture_index));
 
 	const int num_textures = GetNumTextures();
-	DecoratorTiledVerticalData* data = new DecoratorTiledVerticalData(element, num_textures);
+	DecoratorTiledVerticalData* data = new DecoratorTiledVerticalData(element->GetContext(), num_textures);
 
 	Vector2f padded_size = element->GetBox().GetSize(Box::PADDING);
 
@@ -33,6 +33,7 @@
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/ElementInstancer.h"
 #include "../../Include/RmlUi/Core/ElementScroll.h"
+#include "../../Include/RmlUi/Core/ElementText.h"
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Dictionary.h"
@@ -51,13 +52,16 @@
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
 #include "EventSpecification.h"
+#include "FrameStatisticsRecorder.h"
 #include "ElementDecoration.h"
 #include "LayoutEngine.h"
 #include "PluginRegistry.h"
 #include "PropertiesIterator.h"
 #include "Pool.h"
 #include "StyleSheetParser.h"
+#include "MemoryUsage.h"
 #include "StyleSheetNode.h"
+#include "StyleSheetNodeSelector.h"
 #include "TransformState.h"
 #include "TransformUtilities.h"
 #include "XMLParseTools.h"
@@ -83,7 +87,20 @@ struct ElementMeta
 };
 
 
-static Pool< ElementMeta > element_meta_chunk_pool(200, true);
+static Pool< ElementMeta > element_meta_chunk_pool(200, true, MemoryCategory::Element);
+
+void MemoryUsage::AddElements(MemoryStatistics& statistics)
+{
+	// Every element allocates its meta data from the pool.
+	const int num_elements = element_meta_chunk_pool.GetNumAllocatedObjects();
+
+	statistics.elements.count += num_elements;
+	statistics.elements.bytes += num_elements * sizeof(Element);
+	statistics.element_meta.count += num_elements;
+	statistics.element_meta.bytes += element_meta_chunk_pool.GetSize() * sizeof(ElementMeta);
+	statistics.computed_values.count += num_elements;
+	statistics.computed_values.bytes += num_elements * sizeof(Style::ComputedValues);
+}
 
 
 /// Constructs a new RmlUi element.
@@ -113,8 +130,14 @@ transform_state(), dirty_transform(false), dirty_perspective(false), dirty_anima
 	local_stacking_context = false;
 	local_stacking_context_forced = false;
 	stacking_context_dirty = false;
+	stacking_context_num_removed = 0;
 
 	structure_dirty = false;
+	child_sibling_indices_dirty = true;
+
+	update_dirty = true;
+	update_descendants_dirty = false;
+	update_every_frame = false;
 
 	computed_values_are_default_initialized = true;
 
@@ -145,6 +168,40 @@ Element::~Element()
 }
 
 void Element::Update(float dp_ratio, Vector2f vp_dimensions)
+{
+	// Skip clean subtrees entirely.
+	if (!update_dirty && !update_descendants_dirty)
+		return;
+
+	if (update_dirty)
+	{
+		// Cleared first so that any requests made during the update are kept for the next one.
+		update_dirty = false;
+		UpdateSelf(dp_ratio, vp_dimensions);
+	}
+
+	if (update_descendants_dirty)
+	{
+		update_descendants_dirty = false;
+
+		for (size_t i = 0; i < children.size(); i++)
+			children[i]->Update(dp_ratio, vp_dimensions);
+
+		// Requests made during the update may have marked us even though they were handled in the same pass, or they
+		// may target children we already visited. Only keep the flag if any children actually remain dirty.
+		update_descendants_dirty = false;
+		for (const ElementPtr& child : children)
+		{
+			if (child->update_dirty || child->update_descendants_dirty)
+			{
+				update_descendants_dirty = true;
+				break;
+			}
+		}
+	}
+}
+
+void Element::UpdateSelf(float dp_ratio, Vector2f vp_dimensions)
 {
 #ifdef RMLUI_ENABLE_PROFILING
 	auto name = GetAddress(false, false);
@@ -152,8 +209,23 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	ElementStatisticsTimer statistics_timer(this, &ElementStatistics::update_time);
+	if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+		recorder->GetStatistics().element_updates += 1;
+
 	OnUpdate();
 
+	if (update_every_frame)
+	{
+		// The document may have been closed during this update, in which case it is no longer attached to the context.
+		ElementDocument* document = GetOwnerDocument();
+		if (document && document->GetParentNode())
+		{
+			if (Context* context = document->GetContext())
+				context->AddFrameUpdateElement(this);
+		}
+	}
+
 	UpdateStructure();
 
 	HandleTransitionProperty();
@@ -174,8 +246,31 @@ void Element::Update(float dp_ratio, Vector2f vp_dimensions)
 
 	meta->decoration.InstanceDecorators();
 
-	for (size_t i = 0; i < children.size(); i++)
-		children[i]->Update(dp_ratio, vp_dimensions);
+	// Running animations, changed transitions, and smooth scrolls need to be handled in the following updates as well.
+	if (!animations.empty() || dirty_transition || meta->scroll.IsSmoothScrolling())
+		RequestUpdate();
+}
+
+void Element::RequestUpdate()
+{
+	update_dirty = true;
+	DirtyUpdateAncestors();
+}
+
+void Element::SetUpdateEveryFrame(bool enable)
+{
+	if (update_every_frame == enable)
+		return;
+
+	update_every_frame = enable;
+
+	if (enable)
+		RequestUpdate();
+}
+
+bool Element::IsUpdatedEveryFrame() const
+{
+	return update_every_frame;
 }
 
 void Element::UpdateProperties(const float dp_ratio, const Vector2f vp_dimensions)
@@ -207,14 +302,19 @@ void Element::Render()
 	RMLUI_ZoneText(name.c_str(), name.size());
 #endif
 
+	ElementStatisticsTimer statistics_timer(this, &ElementStatistics::render_time);
+
 	// TODO: This is a work-around for the dirty offset not being properly updated when used by (stacking context?) children. This results
 	// in scrolling not working properly. We don't care about the return value, the call is only used to force the absolute offset to update.
 	if (offset_dirty)
 		GetAbsoluteOffset(Box::BORDER);
 
-	// Rebuild our stacking context if necessary.
+	// Rebuild our stacking context if necessary, or insert any elements added to it.
 	if (stacking_context_dirty)
 		BuildLocalStackingContext();
+	else if (!stacking_context_added.empty())
+		UpdateLocalStackingContext();
+	stacking_context_num_removed = 0;
 
 	UpdateTransformState();
 
@@ -385,32 +485,108 @@ Vector2f Element::GetRelativeOffset(Box::Area area)
 
 // Returns the position of the top-left corner of one of the areas of this element's primary box.
 Vector2f Element::GetAbsoluteOffset(Box::Area area)
+{
+	const Vector2f unscrolled_offset = GetUnscrolledOffset();
+	return unscrolled_offset - GetAncestorScrollOffset() + GetBox().GetPosition(area);
+}
+
+Vector2f Element::GetUnscrolledOffset()
 {
 	if (offset_dirty)
 	{
 		offset_dirty = false;
+		ancestor_scroll_dirty = true;
 
 		if (offset_parent != nullptr)
-			absolute_offset = offset_parent->GetAbsoluteOffset(Box::BORDER) + relative_offset_base + relative_offset_position;
+			absolute_offset = offset_parent->GetUnscrolledOffset() + relative_offset_base + relative_offset_position;
 		else
 			absolute_offset = relative_offset_base + relative_offset_position;
 
-		// Add any parent scrolling onto our position as well. Could cache this if required.
 		if (!offset_fixed)
 		{
-			Element* scroll_parent = parent;
-			while (scroll_parent != nullptr)
+			for (Element* scroll_parent = parent; scroll_parent != nullptr; scroll_parent = scroll_parent->parent)
 			{
-				absolute_offset -= (scroll_parent->scroll_offset + scroll_parent->content_offset);
+				absolute_offset -= scroll_parent->content_offset;
 				if (scroll_parent == offset_parent)
 					break;
-				else
-					scroll_parent = scroll_parent->parent;
 			}
 		}
 	}
 
-	return absolute_offset + GetBox().GetPosition(area);
+	return absolute_offset;
+}
+
+Vector2f Element::GetAncestorScrollOffset()
+{
+	// The offset is unchanged until our scroll container, or one of its own scroll containers, is scrolled.
+	if (!offset_dirty && !ancestor_scroll_dirty && (!scroll_container || scroll_container->GetScrollGeneration() == scroll_container_generation))
+		return ancestor_scroll_offset;
+
+	Vector2f new_offset(0, 0);
+	Element* new_scroll_container = nullptr;
+	if (offset_parent)
+	{
+		new_offset = offset_parent->GetAncestorScrollOffset();
+		new_scroll_container = offset_parent->scroll_container;
+	}
+
+	// Add any parent scrolling onto our position as well.
+	if (!offset_fixed)
+	{
+		Element* nearest_scroll_container = nullptr;
+		for (Element* scroll_parent = parent; scroll_parent != nullptr; scroll_parent = scroll_parent->parent)
+		{
+			new_offset += scroll_parent->scroll_offset;
+			if (!nearest_scroll_container && scroll_parent->IsClippingEnabled())
+				nearest_scroll_container = scroll_parent;
+			if (scroll_parent == offset_parent)
+				break;
+		}
+
+		if (nearest_scroll_container)
+			new_scroll_container = nearest_scroll_container;
+	}
+
+	// Elements using us as their scroll container need to see any change to our position.
+	if (new_offset != ancestor_scroll_offset)
+	{
+		ancestor_scroll_offset = new_offset;
+		scroll_generation += 1;
+	}
+
+	scroll_container = new_scroll_container;
+	scroll_container_generation = (scroll_container ? scroll_container->scroll_generation : 0);
+	ancestor_scroll_dirty = false;
+
+	return ancestor_scroll_offset;
+}
+
+unsigned int Element::GetScrollGeneration()
+{
+	GetAncestorScrollOffset();
+	return scroll_generation;
+}
+
+void Element::DirtyScrollOffset()
+{
+	// Descendants only compare against the scroll generation of their nearest scroll container, that is the nearest
+	// ancestor clipping its content. Other elements are rarely scrolled, for those we invalidate the descendants directly.
+	if (IsClippingEnabled())
+	{
+		scroll_generation += 1;
+	}
+	else
+	{
+		for (ElementPtr& child : children)
+			child->DirtyAncestorScrollOffset();
+	}
+}
+
+void Element::DirtyAncestorScrollOffset()
+{
+	ancestor_scroll_dirty = true;
+	for (ElementPtr& child : children)
+		child->DirtyAncestorScrollOffset();
 }
 
 // Sets an alternate area to use as the client area.
@@ -453,6 +629,7 @@ void Element::SetBox(const Box& box)
 		additional_boxes.clear();
 
 		OnResize();
+		DirtyTransformState(true, true);
 
 		meta->background_border.DirtyBackground();
 		meta->background_border.DirtyBorder();
@@ -954,7 +1131,8 @@ void Element::SetScrollLeft(float scroll_left)
 	{
 		scroll_offset.x = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::HORIZONTAL);
-		DirtyOffset();
+		DirtyScrollOffset();
+		RequestUpdate();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
@@ -974,12 +1152,27 @@ void Element::SetScrollTop(float scroll_top)
 	{
 		scroll_offset.y = new_offset;
 		meta->scroll.UpdateScrollbar(ElementScroll::VERTICAL);
-		DirtyOffset();
+		DirtyScrollOffset();
+		RequestUpdate();
 
 		DispatchEvent(EventId::Scroll, Dictionary());
 	}
 }
 
+// Scrolls the element to the given offsets, smoothly if enabled by the element's style.
+void Element::ScrollTo(Vector2f offset)
+{
+	if (meta->computed_values.scroll_behavior == Style::ScrollBehavior::Smooth)
+	{
+		meta->scroll.SmoothScrollTo(offset);
+	}
+	else
+	{
+		SetScrollLeft(offset.x);
+		SetScrollTop(offset.y);
+	}
+}
+
 // Gets the width of the scrollable content of the element; it includes the element padding but not its margin.
 float Element::GetScrollWidth()
 {
@@ -1308,7 +1501,7 @@ Element* Element::AppendChild(ElementPtr child, bool dom_element)
 	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
 		ancestor->OnChildAdd(child_ptr);
 
-	DirtyStackingContext();
+	child_ptr->AddToStackingContext();
 	DirtyStructure();
 
 	if (dom_element)
@@ -1357,7 +1550,7 @@ Element* Element::InsertBefore(ElementPtr child, Element* adjacent_element)
 		for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
 			ancestor->OnChildAdd(child_ptr);
 
-		DirtyStackingContext();
+		child_ptr->AddToStackingContext();
 		DirtyStructure();
 	}
 	else
@@ -1390,6 +1583,7 @@ ElementPtr Element::ReplaceChild(ElementPtr inserted_element, Element* replaced_
 	inserted_element_ptr->SetParent(this);
 
 	ElementPtr result = RemoveChild(replaced_element);
+	inserted_element_ptr->AddToStackingContext();
 
 	Element* ancestor = inserted_element_ptr;
 	for (int i = 0; i <= ChildNotifyLevels && ancestor; i++, ancestor = ancestor->GetParentNode())
@@ -1441,10 +1635,10 @@ ElementPtr Element::RemoveChild(Element* child)
 				}
 			}
 
+			detached_child->RemoveFromStackingContext();
 			detached_child->SetParent(nullptr);
 
 			DirtyLayout();
-			DirtyStackingContext();
 			DirtyStructure();
 
 			return detached_child;
@@ -1757,11 +1951,22 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 			visible = new_visibility;
 
 			if (parent != nullptr)
-				parent->DirtyStackingContext();
+			{
+				if (visible)
+					AddToStackingContext();
+				else
+					RemoveFromStackingContext();
+			}
 
 			if (!visible)
 				Blur();
 		}
+		else if (visible && parent != nullptr && changed_properties.Contains(PropertyId::Display))
+		{
+			// The render order may have changed, reposition the element within its stacking context.
+			RemoveFromStackingContext();
+			AddToStackingContext();
+		}
 
 		if (changed_properties.Contains(PropertyId::Display))
 		{
@@ -1773,6 +1978,12 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		}
 	}
 
+	if (visible && parent != nullptr && (changed_properties.Contains(PropertyId::Position) || changed_properties.Contains(PropertyId::Float)))
+	{
+		RemoveFromStackingContext();
+		AddToStackingContext();
+	}
+
 	// Update the position.
 	if (changed_properties.Contains(PropertyId::Left) ||
 		changed_properties.Contains(PropertyId::Right) ||
@@ -1784,6 +1995,13 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		DirtyOffset();
 	}
 
+	// Descendants find their scroll container by the overflow property.
+	if (changed_properties.Contains(PropertyId::OverflowX) || changed_properties.Contains(PropertyId::OverflowY))
+	{
+		for (ElementPtr& child : children)
+			child->DirtyAncestorScrollOffset();
+	}
+
 	// Update the z-index.
 	if (changed_properties.Contains(PropertyId::ZIndex))
 	{
@@ -1794,11 +2012,14 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 			if (local_stacking_context &&
 				!local_stacking_context_forced)
 			{
-				// We're no longer acting as a stacking context.
+				// We're no longer acting as a stacking context, our descendants are moved into our parent's stacking context.
 				local_stacking_context = false;
 
 				stacking_context_dirty = false;
 				stacking_context.clear();
+				stacking_context_added.clear();
+
+				DirtyStackingContext();
 			}
 
 			// If our old z-index was not zero, then we must dirty our stacking context so we'll be re-indexed.
@@ -1812,19 +2033,28 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		{
 			float new_z_index = z_index_property.value;
 
-			if (new_z_index != z_index)
+			if (!local_stacking_context)
 			{
+				// Our descendants are moved from our parent's stacking context into our new local stacking context.
 				z_index = new_z_index;
 
 				if (parent != nullptr)
 					parent->DirtyStackingContext();
-			}
 
-			if (!local_stacking_context)
-			{
 				local_stacking_context = true;
 				stacking_context_dirty = true;
 			}
+			else if (new_z_index != z_index)
+			{
+				// Only our own entry is moved in our parent's stacking context.
+				if (parent != nullptr)
+					RemoveFromStackingContext();
+
+				z_index = new_z_index;
+
+				if (parent != nullptr)
+					AddToStackingContext();
+			}
 		}
 	}
 
@@ -1874,11 +2104,12 @@ void Element::OnPropertyChange(const PropertyIdSet& changed_properties)
 		DirtyTransformState(true, false);
 	}
 
-	// Check for `transform' and `transform-origin' changes
+	// Check for `transform' and `transform-origin' changes, the transform may also be relative to the font size
 	if (changed_properties.Contains(PropertyId::Transform) ||
 		changed_properties.Contains(PropertyId::TransformOriginX) ||
 		changed_properties.Contains(PropertyId::TransformOriginY) ||
-		changed_properties.Contains(PropertyId::TransformOriginZ))
+		changed_properties.Contains(PropertyId::TransformOriginZ) ||
+		changed_properties.Contains(PropertyId::FontSize))
 	{
 		DirtyTransformState(false, true);
 	}
@@ -1914,7 +2145,12 @@ void Element::DirtyLayout()
 {
 	Element* document = GetOwnerDocument();
 	if (document != nullptr)
+	{
+		if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+			recorder->RecordElementFlags(this, ElementStatistics::LayoutDirtied);
+
 		document->DirtyLayout();
+	}
 }
 
 // Forces a re-layout of this element, and any other children required.
@@ -1959,7 +2195,11 @@ void Element::ProcessDefaultAction(Event& event)
 					if (const Context* context = GetContext())
 						default_scroll_length *= context->GetDensityIndependentPixelRatio();
 
-					SetScrollTop(GetScrollTop() + wheel_delta * default_scroll_length);
+					const float scroll_length = wheel_delta * default_scroll_length;
+					if (meta->computed_values.scroll_behavior == Style::ScrollBehavior::Smooth)
+						meta->scroll.SmoothScrollBy(Vector2f(0.f, scroll_length));
+					else
+						SetScrollTop(GetScrollTop() + scroll_length);
 				}
 			}
 		}
@@ -2078,17 +2318,24 @@ void Element::SetParent(Element* _parent)
 
 	parent = _parent;
 
+	// Our position is calculated by the new parent when needed.
+	sibling_index = SiblingIndex();
+
 	if (parent)
 	{
 		// We need to update our definition and make sure we inherit the properties of our new parent.
 		meta->style.DirtyDefinition();
 		meta->style.DirtyInheritedProperties();
+		RequestUpdate();
 	}
 
 	// The transform state may require recalculation.
 	if (transform_state || (parent && parent->transform_state))
 		DirtyTransformState(true, true);
 
+	// Our scroll containers are found again among our new ancestors.
+	DirtyAncestorScrollOffset();
+
 	SetOwnerDocument(parent ? parent->GetOwnerDocument() : nullptr);
 
 	if (!parent)
@@ -2210,6 +2457,7 @@ void Element::BuildLocalStackingContext()
 {
 	stacking_context_dirty = false;
 	stacking_context.clear();
+	stacking_context_added.clear();
 
 	BuildStackingContext(&stacking_context);
 	std::stable_sort(stacking_context.begin(), stacking_context.end(), [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); });
@@ -2222,6 +2470,145 @@ struct StackingOrderedChild {
 	bool include_children;
 };
 
+// Returns the render order of a child outside of tables.
+static RenderOrder GetRenderOrder(Element* child)
+{
+	const Style::Display child_display = child->GetDisplay();
+
+	if (child->GetPosition() != Style::Position::Static)
+		return RenderOrder::Positioned;
+	else if (child->GetFloat() != Style::Float::None)
+		return RenderOrder::Floating;
+	else if (child_display == Style::Display::Block || child_display == Style::Display::Table)
+		return RenderOrder::Block;
+
+	return RenderOrder::Inline;
+}
+
+void Element::UpdateLocalStackingContext()
+{
+	RMLUI_ZoneScoped;
+
+	ElementList added_elements;
+	added_elements.swap(stacking_context_added);
+
+	// Collect the entries of each added element in stacking order. The elements may have been hidden or moved into
+	// another stacking context since they were added, then they are skipped here.
+	Vector<ElementList> added_entries;
+	size_t num_added_entries = 0;
+
+	for (Element* added : added_elements)
+	{
+		bool skip = !added->IsVisible();
+
+		for (Element* ancestor = added->parent; ancestor != this; ancestor = ancestor->parent)
+		{
+			if (!ancestor || !ancestor->IsVisible() || ancestor->local_stacking_context)
+			{
+				skip = true;
+				break;
+			}
+			else if (ancestor->GetDisplay() == Style::Display::Table)
+			{
+				// Table children are ordered across their levels, simply rebuild the stacking context.
+				BuildLocalStackingContext();
+				return;
+			}
+		}
+
+		if (skip)
+			continue;
+
+		added_entries.emplace_back();
+		ElementList& entries = added_entries.back();
+		entries.push_back(added);
+
+		if (!added->local_stacking_context)
+			added->BuildStackingContext(&entries);
+
+		std::stable_sort(entries.begin(), entries.end(), [](const Element* lhs, const Element* rhs) { return lhs->GetZIndex() < rhs->GetZIndex(); });
+		num_added_entries += entries.size();
+	}
+
+	// Inserting the entries one by one becomes slower than rebuilding the stacking context when many are added.
+	if (GetDisplay() == Style::Display::Table || num_added_entries > 16 + stacking_context.size() / 8)
+	{
+		BuildLocalStackingContext();
+		return;
+	}
+
+	auto GetDepth = [this](const Element* element) {
+		int depth = 0;
+		for (; element != this; element = element->parent)
+			depth++;
+		return depth;
+	};
+
+	// Positions of elements among their siblings, the children of a parent are indexed the first time two of them are compared.
+	UnorderedMap<const Element*, int> child_positions;
+	auto GetChildPosition = [&child_positions](const Element* element) {
+		auto it = child_positions.find(element);
+		if (it != child_positions.end())
+			return it->second;
+
+		const OwnedElementList& siblings = element->parent->children;
+		for (int i = 0; i < (int)siblings.size(); i++)
+			child_positions[siblings[i].get()] = i;
+		return child_positions[element];
+	};
+
+	// Returns true if the entry 'lhs' is ordered before 'rhs', as they would be by BuildLocalStackingContext(). That is,
+	// ordered by z-index, then by the render order of their ancestors below the lowest common one, then by tree order.
+	auto StackingOrderLess = [&GetDepth, &GetChildPosition](Element* lhs, Element* rhs) {
+		if (lhs->z_index != rhs->z_index)
+			return lhs->z_index < rhs->z_index;
+
+		int lhs_depth = GetDepth(lhs);
+		int rhs_depth = GetDepth(rhs);
+
+		// Ancestors are placed before their descendants.
+		for (; lhs_depth > rhs_depth; lhs_depth--)
+		{
+			if (lhs->parent == rhs)
+				return false;
+			lhs = lhs->parent;
+		}
+		for (; rhs_depth > lhs_depth; rhs_depth--)
+		{
+			if (rhs->parent == lhs)
+				return true;
+			rhs = rhs->parent;
+		}
+		if (lhs == rhs)
+			return false;
+
+		while (lhs->parent != rhs->parent)
+		{
+			lhs = lhs->parent;
+			rhs = rhs->parent;
+		}
+
+		const RenderOrder lhs_order = GetRenderOrder(lhs);
+		const RenderOrder rhs_order = GetRenderOrder(rhs);
+		if (lhs_order != rhs_order)
+			return lhs_order < rhs_order;
+
+		return GetChildPosition(lhs) < GetChildPosition(rhs);
+	};
+
+	for (const ElementList& entries : added_entries)
+	{
+		// The entries of each element are already ordered, so each one is inserted after the previous one. Then they are
+		// only compared to existing entries, which are never descendants of the added element.
+		auto it_insert = stacking_context.begin();
+		for (Element* entry : entries)
+		{
+			it_insert = std::upper_bound(it_insert, stacking_context.end(), entry, StackingOrderLess);
+			it_insert = stacking_context.insert(it_insert, entry) + 1;
+		}
+	}
+}
+
 void Element::BuildStackingContext(ElementList* new_stacking_context)
 {
 	RMLUI_ZoneScoped;
@@ -2341,12 +2728,111 @@ void Element::DirtyStackingContext()
 	}
 
 	if (stacking_context_parent)
+	{
 		stacking_context_parent->stacking_context_dirty = true;
+		stacking_context_parent->stacking_context_added.clear();
+	}
+}
+
+// Returns true if the element is the given ancestor or one of its descendants, both must be within the stacking context.
+static bool IsSelfOrDescendantInStackingContext(const Element* element, const Element* ancestor, const Element* stacking_context_parent)
+{
+	for (; element != stacking_context_parent; element = element->GetParentNode())
+	{
+		if (element == ancestor)
+			return true;
+	}
+	return false;
+}
+
+Element* Element::GetStackingContextParent() const
+{
+	Element* stacking_context_parent = parent;
+	while (stacking_context_parent && !stacking_context_parent->local_stacking_context)
+		stacking_context_parent = stacking_context_parent->parent;
+
+	return stacking_context_parent;
+}
+
+void Element::AddToStackingContext()
+{
+	Element* stacking_context_parent = GetStackingContextParent();
+	if (!stacking_context_parent || stacking_context_parent->stacking_context_dirty)
+		return;
+
+	ElementList& added = stacking_context_parent->stacking_context_added;
+
+	// Nothing to do if we or any of our ancestors are already waiting to be added.
+	for (const Element* ancestor = this; ancestor != stacking_context_parent; ancestor = ancestor->parent)
+	{
+		if (std::find(added.begin(), added.end(), ancestor) != added.end())
+			return;
+	}
+
+	// Fall back to rebuilding the stacking context when many elements are added separately, such as during construction.
+	if (added.size() >= 32)
+	{
+		stacking_context_parent->DirtyStackingContext();
+		return;
+	}
+
+	// Our descendants waiting to be added are now included in our own entries.
+	auto IsDescendant = [this, stacking_context_parent](const Element* element) {
+		return IsSelfOrDescendantInStackingContext(element, this, stacking_context_parent);
+	};
+	added.erase(std::remove_if(added.begin(), added.end(), IsDescendant), added.end());
+
+	added.push_back(this);
+}
+
+void Element::RemoveFromStackingContext()
+{
+	Element* stacking_context_parent = GetStackingContextParent();
+	if (!stacking_context_parent || stacking_context_parent->stacking_context_dirty)
+		return;
+
+	ElementList& added = stacking_context_parent->stacking_context_added;
+
+	// If we or any of our ancestors are waiting to be added, our entries are not yet part of the stacking context.
+	for (const Element* ancestor = this; ancestor != stacking_context_parent; ancestor = ancestor->parent)
+	{
+		auto it = std::find(added.begin(), added.end(), ancestor);
+		if (it != added.end())
+		{
+			if (ancestor == this)
+				added.erase(it);
+			return;
+		}
+	}
+
+	// Each removal below scans the whole stacking context, fall back to rebuilding it when many elements are removed
+	// before the next render, such as when clearing a long list.
+	if (stacking_context_parent->stacking_context_num_removed >= 8)
+	{
+		stacking_context_parent->DirtyStackingContext();
+		return;
+	}
+	stacking_context_parent->stacking_context_num_removed += 1;
+
+	auto IsSelfOrDescendant = [this, stacking_context_parent](const Element* element) {
+		return IsSelfOrDescendantInStackingContext(element, this, stacking_context_parent);
+	};
+
+	// Our descendants may be waiting to be added, and we may be about to be detached.
+	added.erase(std::remove_if(added.begin(), added.end(), IsSelfOrDescendant), added.end());
+
+	ElementList& entries = stacking_context_parent->stacking_context;
+	if (local_stacking_context)
+		entries.erase(std::remove(entries.begin(), entries.end(), this), entries.end());
+	else
+		entries.erase(std::remove_if(entries.begin(), entries.end(), IsSelfOrDescendant), entries.end());
 }
 
 void Element::DirtyStructure()
 {
 	structure_dirty = true;
+	child_sibling_indices_dirty = true;
+	RequestUpdate();
 }
 
 void Element::UpdateStructure()
@@ -2355,11 +2841,103 @@ void Element::UpdateStructure()
 	{
 		structure_dirty = false;
 
-		// If this element or its children depend on structured selectors, they may need to be updated.
-		GetStyle()->DirtyDefinition();
+		// Only the ':empty' selector depends on our own children, the structural selectors of our children are
+		// resolved from their sibling indices below.
+		const StyleSheet* style_sheet = GetStyleSheet();
+		if (style_sheet && (style_sheet->GetSiblingDependencies() & StyleSheetNodeSelector::DependsOnChildren))
+			GetStyle()->DirtyDefinition();
+
+		UpdateChildSiblingIndices();
 	}
 }
 
+void Element::UpdateChildSiblingIndices()
+{
+	if (!child_sibling_indices_dirty)
+		return;
+
+	child_sibling_indices_dirty = false;
+
+	const StyleSheet* style_sheet = GetStyleSheet();
+	const int dependencies = (style_sheet ? style_sheet->GetSiblingDependencies() : 0);
+
+	const int num_children = GetNumChildren();
+	const int num_children_total = GetNumChildren(true);
+
+	static thread_local Vector<SiblingIndex> new_indices;
+	static thread_local UnorderedMap<String, int> type_counts;
+	new_indices.assign(num_children_total, SiblingIndex());
+
+	auto IsCounted = [](Element* child) {
+		return child->GetDisplay() != Style::Display::None;
+	};
+	auto IsCountedChild = [](Element* child) {
+		return child->GetDisplay() != Style::Display::None && rmlui_dynamic_cast<ElementText*>(child) == nullptr;
+	};
+
+	int count = 0;
+	type_counts.clear();
+	for (int i = 0; i < num_children; i++)
+	{
+		Element* child = children[i].get();
+		int& type_count = type_counts[child->GetTagName()];
+		new_indices[i].child = count + 1;
+		new_indices[i].of_type = type_count + 1;
+		count += int(IsCountedChild(child));
+		type_count += int(IsCounted(child));
+	}
+
+	count = 0;
+	type_counts.clear();
+	for (int i = num_children - 1; i >= 0; i--)
+	{
+		Element* child = children[i].get();
+		int& type_count = type_counts[child->GetTagName()];
+		new_indices[i].last_child = count + 1;
+		new_indices[i].last_of_type = type_count + 1;
+		count += int(IsCountedChild(child));
+		type_count += int(IsCounted(child));
+	}
+
+	for (int i = 0; i < num_children_total; i++)
+	{
+		Element* child = children[i].get();
+		const SiblingIndex& old_index = child->sibling_index;
+		const SiblingIndex& new_index = new_indices[i];
+
+		int changed = 0;
+		if (old_index.child != new_index.child)
+			changed |= StyleSheetNodeSelector::DependsOnChild;
+		if (old_index.last_child != new_index.last_child)
+			changed |= StyleSheetNodeSelector::DependsOnLastChild;
+		if (old_index.of_type != new_index.of_type)
+			changed |= StyleSheetNodeSelector::DependsOnOfType;
+		if (old_index.last_of_type != new_index.last_of_type)
+			changed |= StyleSheetNodeSelector::DependsOnLastOfType;
+
+		child->sibling_index = new_index;
+
+		// Re-match the child and its descendants only if a selector in use depends on the changed positions.
+		if (changed & dependencies)
+			child->GetStyle()->DirtyDefinition();
+	}
+}
+
+const Element::SiblingIndex& Element::GetSiblingIndex() const
+{
+	if (parent)
+		parent->UpdateChildSiblingIndices();
+
+	return sibling_index;
+}
+
+void Element::DirtyUpdateAncestors()
+{
+	// Ancestors already marked are guaranteed to have their own ancestors marked, or to be visited later during the current update.
+	for (Element* ancestor = parent; ancestor && !ancestor->update_descendants_dirty; ancestor = ancestor->parent)
+		ancestor->update_descendants_dirty = true;
+}
+
 
 bool Element::Animate(const String & property_name, const Property & target_value, float duration, Tween tween, int num_iterations, bool alternate_direction, float delay, const Property* start_value)
 {
@@ -2430,7 +3008,7 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 	if (value.definition)
 	{
 		ElementAnimationOrigin origin = (initiated_by_animation_property ? ElementAnimationOrigin::Animation : ElementAnimationOrigin::User);
-		double start_time = Clock::GetElapsedTime() + (double)delay;
+		double start_time = Clock::GetElapsedTime(GetContext()) + (double)delay;
 		*it = ElementAnimation{ property_id, origin, value, *this, start_time, 0.0f, num_iterations, alternate_direction };
 	}
 	
@@ -2439,6 +3017,10 @@ ElementAnimationList::iterator Element::StartAnimation(PropertyId property_id, c
 		animations.erase(it);
 		it = animations.end();
 	}
+	else
+	{
+		RequestUpdate();
+	}
 
 	return it;
 }
@@ -2475,7 +3057,7 @@ bool Element::StartTransition(const Transition & transition, const Property& sta
 		return false;
 
 	float duration = transition.duration;
-	double start_time = Clock::GetElapsedTime() + (double)transition.delay;
+	double start_time = Clock::GetElapsedTime(GetContext()) + (double)transition.delay;
 
 	if (it == animations.end())
 	{
@@ -2498,7 +3080,10 @@ bool Element::StartTransition(const Transition & transition, const Property& sta
 	bool result = it->AddKey(duration, target_value, *this, transition.tween, true);
 
 	if (result)
+	{
 		SetProperty(transition.id, start_value);
+		RequestUpdate();
+	}
 	else
 		animations.erase(it);
 
@@ -2623,7 +3208,7 @@ void Element::AdvanceAnimations()
 {
 	if (!animations.empty())
 	{
-		double time = Clock::GetElapsedTime();
+		double time = Clock::GetElapsedTime(GetContext());
 
 		for (auto& animation : animations)
 		{
@@ -2674,7 +3259,14 @@ void Element::DirtyTransformState(bool perspective_dirty, bool transform_dirty)
 void Element::UpdateTransformState()
 {
 	if (!dirty_perspective && !dirty_transform)
-		return;
+	{
+		// Scrolling an ancestor moves the element without dirtying its transform, which is relative to the absolute offset.
+		if (!transform_state || transform_state->GetOffset() == GetAbsoluteOffset(Box::BORDER))
+			return;
+
+		dirty_perspective = true;
+		dirty_transform = true;
+	}
 
 	const ComputedValues& computed = meta->computed_values;
 
@@ -2809,6 +3401,8 @@ void Element::UpdateTransformState()
 			transform_state->SetTransform(nullptr);
 
 		perspective_or_transform_changed |= (had_transform != have_transform);
+
+		dirty_transform = false;
 	}
 
 	// A change in perspective or transform will require an update to children transforms as well.
@@ -2823,11 +3417,15 @@ void Element::UpdateTransformState()
 	{
 		transform_state.reset();
 	}
+
+	if (transform_state)
+		transform_state->SetOffset(pos);
 }
 
 void Element::OnStyleSheetChangeRecursive()
 {
 	GetElementDecoration()->DirtyDecorators();
+	RequestUpdate();
 
 	OnStyleSheetChange();
 
@@ -2840,7 +3438,9 @@ void Element::OnStyleSheetChangeRecursive()
 void Element::OnDpRatioChangeRecursive()
 {
 	GetElementDecoration()->DirtyDecorators();
+	RequestUpdate();
 	GetStyle()->DirtyPropertiesWithUnits(Property::DP);
+	DirtyTransformState(false, true);
 
 	OnDpRatioChange();
 
@@ -27,15 +27,87 @@
  */
 
 #include "ElementDecoration.h"
+#include "../../Include/RmlUi/Core/ComputedValues.h"
 #include "../../Include/RmlUi/Core/Decorator.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/DecoratorInstancer.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
+#include "Utilities.h"
+#include <mutex>
 
 namespace Rml {
 
+namespace {
+	// All the values the element data of shareable decorators may depend on.
+	struct SharedDecoratorDataKey {
+		const Decorator* decorator;
+		Context* context;
+		float dp_ratio;
+		Box box;
+		float opacity;
+		Colourb image_color;
+		float font_size;
+		Vector4f border_radius;
+
+		bool operator==(const SharedDecoratorDataKey& other) const
+		{
+			return decorator == other.decorator && context == other.context && dp_ratio == other.dp_ratio && box == other.box &&
+				opacity == other.opacity && image_color == other.image_color && font_size == other.font_size && border_radius == other.border_radius;
+		}
+	};
+
+	size_t HashSharedDecoratorDataKey(const SharedDecoratorDataKey& key)
+	{
+		size_t seed = 0;
+		Utilities::HashCombine(seed, key.decorator);
+		Utilities::HashCombine(seed, key.context);
+		Utilities::HashCombine(seed, key.box.GetSize(Box::BORDER).x);
+		Utilities::HashCombine(seed, key.box.GetSize(Box::BORDER).y);
+		Utilities::HashCombine(seed, key.opacity);
+		return seed;
+	}
+}
+
+struct SharedDecoratorData : NonCopyMoveable {
+	SharedDecoratorData(const SharedDecoratorDataKey& key, size_t hash, DecoratorDataHandle handle) : key(key), hash(hash), handle(handle) {}
+	~SharedDecoratorData();
+
+	SharedDecoratorDataKey key;
+	size_t hash;
+	DecoratorDataHandle handle;
+};
+
+// Shared data indexed by the hash of its key. Data is only kept while at least one element refers to it.
+// The context is stored next to the data, so that the data of contexts updated on other threads is never locked.
+struct SharedDecoratorDataEntry {
+	Context* context;
+	WeakPtr<SharedDecoratorData> data;
+};
+using SharedDecoratorDataMap = UnorderedMultimap<size_t, SharedDecoratorDataEntry>;
+static SharedDecoratorDataMap shared_decorator_data_map;
+static std::mutex shared_decorator_data_mutex;
+
+SharedDecoratorData::~SharedDecoratorData()
+{
+	key.decorator->ReleaseElementData(handle);
+
+	std::lock_guard<std::mutex> lock(shared_decorator_data_mutex);
+
+	// Our own entry is the only one in our context that can be expired at this point.
+	auto range = shared_decorator_data_map.equal_range(hash);
+	for (auto it = range.first; it != range.second; ++it)
+	{
+		if (it->second.context == key.context && it->second.data.expired())
+		{
+			shared_decorator_data_map.erase(it);
+			break;
+		}
+	}
+}
+
 ElementDecoration::ElementDecoration(Element* _element) : element(_element)
 {}
 
@@ -113,22 +185,86 @@ void ElementDecoration::ReloadDecoratorsData()
 
 		for (DecoratorHandle& decorator : decorators)
 		{
-			if (decorator.decorator_data)
-				decorator.decorator->ReleaseElementData(decorator.decorator_data);
+			ReleaseDecoratorData(decorator);
+			GenerateDecoratorData(decorator);
+		}
+	}
+}
+
+void ElementDecoration::GenerateDecoratorData(DecoratorHandle& decorator)
+{
+	if (!decorator.decorator->IsElementDataShareable())
+	{
+		decorator.decorator_data = decorator.decorator->GenerateElementData(element);
+		return;
+	}
+
+	const ComputedValues& computed = element->GetComputedValues();
+
+	SharedDecoratorDataKey key;
+	key.decorator = decorator.decorator.get();
+	key.context = element->GetContext();
+	key.dp_ratio = ElementUtilities::GetDensityIndependentPixelRatio(element);
+	key.box = element->GetBox();
+	key.opacity = computed.opacity;
+	key.image_color = computed.image_color;
+	key.font_size = computed.font_size;
+	key.border_radius = Vector4f(computed.border_top_left_radius, computed.border_top_right_radius, computed.border_bottom_right_radius,
+		computed.border_bottom_left_radius);
+
+	const size_t hash = HashSharedDecoratorDataKey(key);
+	SharedPtr<SharedDecoratorData> shared_data;
+
+	{
+		std::lock_guard<std::mutex> lock(shared_decorator_data_mutex);
+		auto range = shared_decorator_data_map.equal_range(hash);
+		for (auto it = range.first; it != range.second; ++it)
+		{
+			if (it->second.context != key.context)
+				continue;
 
-			decorator.decorator_data = decorator.decorator->GenerateElementData(element);
+			SharedPtr<SharedDecoratorData> candidate = it->second.data.lock();
+			if (candidate && candidate->key == key)
+			{
+				shared_data = std::move(candidate);
+				break;
+			}
 		}
 	}
+
+	if (!shared_data)
+	{
+		const DecoratorDataHandle handle = decorator.decorator->GenerateElementData(element);
+		if (!handle)
+		{
+			decorator.decorator_data = handle;
+			return;
+		}
+
+		shared_data = MakeShared<SharedDecoratorData>(key, hash, handle);
+		std::lock_guard<std::mutex> lock(shared_decorator_data_mutex);
+		shared_decorator_data_map.emplace(hash, SharedDecoratorDataEntry{ key.context, shared_data });
+	}
+
+	decorator.decorator_data = shared_data->handle;
+	decorator.shared_data = std::move(shared_data);
+}
+
+void ElementDecoration::ReleaseDecoratorData(DecoratorHandle& decorator)
+{
+	if (decorator.shared_data)
+		decorator.shared_data.reset();
+	else if (decorator.decorator_data)
+		decorator.decorator->ReleaseElementData(decorator.decorator_data);
+
+	decorator.decorator_data = 0;
 }
 
 // Releases all existing decorators and frees their data.
 void ElementDecoration::ReleaseDecorators()
 {
 	for (DecoratorHandle& decorator : decorators)
-	{
-		if (decorator.decorator_data)
-			decorator.decorator->ReleaseElementData(decorator.decorator_data);
-	}
+		ReleaseDecoratorData(decorator);
 
 	decorators.clear();
 }
@@ -35,6 +35,7 @@ namespace Rml {
 
 class Decorator;
 class Element;
+struct SharedDecoratorData;
 
 /**
 	Manages an elements decorator state
@@ -73,10 +74,17 @@ private:
 	{
 		SharedPtr<const Decorator> decorator;
 		DecoratorDataHandle decorator_data;
+		// Set if the element data is shared with other elements, see Decorator::IsElementDataShareable().
+		SharedPtr<SharedDecoratorData> shared_data;
 	};
 
 	using DecoratorHandleList = Vector< DecoratorHandle >;
 
+	// Generates the element data of the given decorator, or shares existing data from another element if possible.
+	void GenerateDecoratorData(DecoratorHandle& decorator);
+	// Releases the element data of the given decorator.
+	void ReleaseDecoratorData(DecoratorHandle& decorator);
+
 	// The element this decorator belongs to
 	Element* element;
 
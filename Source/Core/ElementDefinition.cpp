@@ -27,11 +27,24 @@
  */
 
 #include "ElementDefinition.h"
+#include "MemoryUsage.h"
 #include "StyleSheetNode.h"
+#include "../../Include/RmlUi/Core/Math.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
+#include <atomic>
 
 namespace Rml {
 
+// Definitions are created and destroyed by contexts which may be updated on different threads.
+static std::atomic<int> element_definitions_count{0};
+static std::atomic<size_t> element_definitions_bytes{0};
+
+// Approximate size of an element definition, its properties never change after construction.
+static size_t GetDefinitionSize(const PropertyDictionary& properties)
+{
+	return sizeof(ElementDefinition) + properties.GetNumProperties() * (sizeof(PropertyId) + sizeof(Property));
+}
+
 ElementDefinition::ElementDefinition(const Vector< const StyleSheetNode* >& style_sheet_nodes)
 {
 	// Initialises the element definition from the list of style sheet nodes.
@@ -40,6 +53,15 @@ ElementDefinition::ElementDefinition(const Vector< const StyleSheetNode* >& styl
 
 	for (auto& property : properties.GetProperties())
 		property_ids.Insert(property.first);
+
+	element_definitions_count += 1;
+	element_definitions_bytes += GetDefinitionSize(properties);
+}
+
+ElementDefinition::~ElementDefinition()
+{
+	element_definitions_count -= 1;
+	element_definitions_bytes -= GetDefinitionSize(properties);
 }
 
 const Property* ElementDefinition::GetProperty(PropertyId id) const
@@ -52,4 +74,87 @@ const PropertyIdSet& ElementDefinition::GetPropertyIds() const
 	return property_ids;
 }
 
+SharedPtr<const ElementDefinition::Change> ElementDefinition::GetChange(const SharedPtr<ElementDefinition>& new_definition) const
+{
+	RMLUI_ASSERT(new_definition);
+
+	std::lock_guard<std::mutex> lock(change_cache_mutex);
+
+	// The cache is keyed by address, make sure the entry still refers to the same definition and not a new one at a reused address.
+	auto it = change_cache.find(new_definition.get());
+	if (it != change_cache.end() && it->second.new_definition.lock() == new_definition)
+		return it->second.change;
+
+	// Definitions come and go as style sheets and classes change, drop the entries of destroyed ones before the cache grows.
+	if (it == change_cache.end() && change_cache.size() >= change_cache_prune_size)
+	{
+		ChangeCache live_entries;
+		for (auto& entry : change_cache)
+		{
+			if (!entry.second.new_definition.expired())
+				live_entries.emplace(entry.first, std::move(entry.second));
+		}
+		change_cache = std::move(live_entries);
+		change_cache_prune_size = Math::Max(change_cache_prune_size, 2 * change_cache.size());
+	}
+
+	auto change_ptr = MakeShared<Change>();
+	Change& change = *change_ptr;
+
+	change.changed_properties = property_ids | new_definition->property_ids;
+
+	// Remove properties that compare equal from the changed list.
+	for (PropertyId id : (property_ids & new_definition->property_ids))
+	{
+		const Property* p0 = GetProperty(id);
+		const Property* p1 = new_definition->GetProperty(id);
+		if (p0 && p1 && *p0 == *p1)
+			change.changed_properties.Erase(id);
+	}
+
+	const Property* transition_property = new_definition->GetProperty(PropertyId::Transition);
+	if (transition_property && transition_property->value.GetType() == Variant::TRANSITIONLIST)
+	{
+		const TransitionList& transition_list = transition_property->value.GetReference<TransitionList>();
+		if (!transition_list.none)
+		{
+			if (transition_list.all)
+			{
+				Transition transition = transition_list.transitions[0];
+				for (PropertyId id : change.changed_properties)
+				{
+					transition.id = id;
+					change.transitions.push_back(transition);
+				}
+			}
+			else
+			{
+				for (const Transition& transition : transition_list.transitions)
+				{
+					if (change.changed_properties.Contains(transition.id))
+						change.transitions.push_back(transition);
+				}
+			}
+		}
+	}
+
+	CachedChange& cached = change_cache[new_definition.get()];
+	cached.new_definition = new_definition;
+	cached.change = change_ptr;
+
+	return change_ptr;
+}
+
+size_t ElementDefinition::GetNumCachedChanges() const
+{
+	std::lock_guard<std::mutex> lock(change_cache_mutex);
+	return change_cache.size();
+}
+
+void MemoryUsage::AddElementDefinitions(MemoryStatistics& statistics)
+{
+	statistics.element_definitions.count += element_definitions_count;
+	statistics.element_definitions.bytes += element_definitions_bytes;
+}
+
 } // namespace Rml
@@ -29,9 +29,11 @@
 #ifndef RMLUI_CORE_ELEMENTDEFINITION_H
 #define RMLUI_CORE_ELEMENTDEFINITION_H
 
+#include "../../Include/RmlUi/Core/Animation.h"
 #include "../../Include/RmlUi/Core/PropertyDictionary.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/Traits.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -44,10 +46,20 @@ class ElementDefinitionIterator;
 	@author Peter Curry
  */
 
-class ElementDefinition : public NonCopyMoveable
+class ElementDefinition : public NonCopyMoveable, public Allocated<MemoryCategory::Style>
 {
 public:
+	/// The difference between two definitions, as applied when an element switches from one definition to another.
+	struct Change {
+		// Properties defined by either definition, except those which compare equal in both.
+		PropertyIdSet changed_properties;
+		// Transitions of the new definition applicable to the changed properties, each with a resolved property id.
+		Vector<Transition> transitions;
+	};
+
+
 	ElementDefinition(const Vector< const StyleSheetNode* >& style_sheet_nodes);
+	~ElementDefinition();
 
 	/// Returns a specific property from the element definition.
 	/// @param[in] id The id of the property to return.
@@ -59,9 +71,30 @@ public:
 
 	const PropertyDictionary& GetProperties() const { return properties; }
 
+	/// Returns the changes when switching from this definition to the given one. The result is cached, as elements
+	/// typically switch back and forth between the same definitions, such as when hovered. Definitions are shared
+	/// between contexts, thus the cache is guarded and the result is returned as a shared pointer.
+	/// @param[in] new_definition The definition to switch to.
+	/// @return The changed properties and the transitions they would start, regardless of any inline properties.
+	SharedPtr<const Change> GetChange(const SharedPtr<ElementDefinition>& new_definition) const;
+	/// Returns the number of entries in the change cache, including those of definitions destroyed since they were added.
+	size_t GetNumCachedChanges() const;
+
 private:
+	struct CachedChange {
+		WeakPtr<ElementDefinition> new_definition;
+		SharedPtr<const Change> change;
+	};
+	using ChangeCache = SmallUnorderedMap<const ElementDefinition*, CachedChange>;
+
 	PropertyDictionary properties;
 	PropertyIdSet property_ids;
+
+	mutable ChangeCache change_cache;
+	// Expired entries are pruned when the cache grows to this size, which is then adjusted to the number of entries kept.
+	mutable size_t change_cache_prune_size = 16;
+	// Guards the change cache, which may be accessed by contexts on different threads.
+	mutable std::mutex change_cache_mutex;
 };
 
 } // namespace Rml
@@ -37,6 +37,7 @@
 #include "DocumentHeader.h"
 #include "ElementStyle.h"
 #include "EventDispatcher.h"
+#include "FrameStatisticsRecorder.h"
 #include "LayoutEngine.h"
 #include "StreamFile.h"
 #include "StyleSheetFactory.h"
@@ -97,6 +98,15 @@ void ElementDocument::ProcessHeader(const DocumentHeader* document_header)
 	// on the element; all of its children will inherit it by default.
 	SharedPtr<StyleSheetContainer> new_style_sheet;
 
+	// Load the external sheets up front, so that they can be parsed in parallel.
+	StringList external_sheet_names;
+	for (const DocumentHeader::Resource& rcss : header.rcss)
+	{
+		if (!rcss.is_inline)
+			external_sheet_names.push_back(rcss.path);
+	}
+	StyleSheetFactory::PreloadStyleSheetContainers(external_sheet_names);
+
 	// Combine any inline sheets.
 	for (const DocumentHeader::Resource& rcss : header.rcss)
 	{
@@ -425,6 +435,10 @@ void ElementDocument::UpdateLayout()
 		RMLUI_ZoneScoped;
 		RMLUI_ZoneText(source_url.c_str(), source_url.size());
 
+		FrameStatisticsTimer layout_timer(&FrameStatistics::layout_time);
+		if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+			recorder->GetStatistics().layout_passes += 1;
+
 		Vector2f containing_block(0, 0);
 		if (GetParentNode() != nullptr)
 			containing_block = GetParentNode()->GetBox().GetSize();
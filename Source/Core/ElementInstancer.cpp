@@ -37,8 +37,8 @@ ElementInstancer::~ElementInstancer()
 {
 }
 
-static Pool< Element > pool_element(200, true);
-static Pool< ElementText > pool_text_default(200, true);
+static Pool< Element > pool_element(200, true, MemoryCategory::Element);
+static Pool< ElementText > pool_text_default(200, true, MemoryCategory::Element);
 
 
 ElementPtr ElementInstancerElement::InstanceElement(Element* /*parent*/, const String& tag, const XMLAttributes& /*attributes*/)
@@ -27,6 +27,7 @@
  */
 
 #include "../../Include/RmlUi/Core/ElementScroll.h"
+#include "Clock.h"
 #include "LayoutDetails.h"
 #include "WidgetScroll.h"
 #include "../../Include/RmlUi/Core/Context.h"
@@ -34,9 +35,16 @@
 #include "../../Include/RmlUi/Core/ElementUtilities.h"
 #include "../../Include/RmlUi/Core/Event.h"
 #include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/Math.h"
 
 namespace Rml {
 
+// The angular frequency of the critically damped spring moving smooth scrolls to their target, in radians per second.
+static constexpr float SMOOTH_SCROLL_FREQUENCY = 20.f;
+// Smooth scrolls end once they are this close to their target, in pixels, and slower than the given speed, in pixels per second.
+static constexpr float SMOOTH_SCROLL_END_DISTANCE = 0.5f;
+static constexpr float SMOOTH_SCROLL_END_SPEED = 10.f;
+
 ElementScroll::ElementScroll(Element* _element)
 {
 	element = _element;
@@ -54,6 +62,8 @@ void ElementScroll::Update()
 		if (scrollbars[i].widget != nullptr)
 			scrollbars[i].widget->Update();
 	}
+
+	UpdateSmoothScroll();
 }
 
 // Enables and sizes one of the scrollbars.
@@ -62,7 +72,6 @@ void ElementScroll::EnableScrollbar(Orientation orientation, float element_width
 	if (!scrollbars[orientation].enabled)
 	{
 		CreateScrollbar(orientation);
-		scrollbars[orientation].element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
 		scrollbars[orientation].enabled = true;
 	}
 
@@ -86,11 +95,7 @@ void ElementScroll::EnableScrollbar(Orientation orientation, float element_width
 // Disables and hides one of the scrollbars.
 void ElementScroll::DisableScrollbar(Orientation orientation)
 {
-	if (scrollbars[orientation].enabled)
-	{
-		scrollbars[orientation].element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
-		scrollbars[orientation].enabled = false;
-	}
+	scrollbars[orientation].enabled = false;
 }
 
 // Updates the position of the scrollbar.
@@ -146,6 +151,13 @@ void ElementScroll::FormatScrollbars()
 
 	for (int i = 0; i < 2; i++)
 	{
+		// Scrollbars are often disabled and enabled again while formatting, only show or hide them once the final state is known.
+		if (scrollbars[i].element && scrollbars[i].visible != scrollbars[i].enabled)
+		{
+			scrollbars[i].element->SetProperty(PropertyId::Visibility, Property(scrollbars[i].enabled ? Style::Visibility::Visible : Style::Visibility::Hidden));
+			scrollbars[i].visible = scrollbars[i].enabled;
+		}
+
 		if (!scrollbars[i].enabled)
 			continue;
 
@@ -220,6 +232,7 @@ bool ElementScroll::CreateScrollbar(Orientation orientation)
 	ElementPtr scrollbar_element = Factory::InstanceElement(element, "*", orientation == VERTICAL ? "scrollbarvertical" : "scrollbarhorizontal", XMLAttributes());
 	scrollbars[orientation].element = scrollbar_element.get();
 	scrollbars[orientation].element->SetProperty(PropertyId::Clip, Property(1, Property::NUMBER));
+	scrollbars[orientation].element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
 
 	scrollbars[orientation].widget = MakeUnique<WidgetScroll>(scrollbars[orientation].element);
 	scrollbars[orientation].widget->Initialise(orientation == VERTICAL ? WidgetScroll::VERTICAL : WidgetScroll::HORIZONTAL);
@@ -255,4 +268,82 @@ ElementScroll::Scrollbar::Scrollbar()
 ElementScroll::Scrollbar::~Scrollbar()
 {}
 
+// Smoothly scrolls the host element towards the given scroll offset.
+void ElementScroll::SmoothScrollTo(Vector2f target)
+{
+	const Vector2f max_offset(element->GetScrollWidth() - element->GetClientWidth(), element->GetScrollHeight() - element->GetClientHeight());
+	target.x = Math::Clamp(target.x, 0.f, Math::Max(max_offset.x, 0.f));
+	target.y = Math::Clamp(target.y, 0.f, Math::Max(max_offset.y, 0.f));
+
+	const Vector2f current(element->GetScrollLeft(), element->GetScrollTop());
+
+	// Start from rest unless a running smooth scroll is retargeted, then its velocity is kept to avoid sudden jerks.
+	if (!IsSmoothScrolling())
+	{
+		smooth_scroll.position = current;
+		smooth_scroll.velocity = Vector2f(0.f);
+		smooth_scroll.applied = current;
+		smooth_scroll.last_time = Clock::GetElapsedTime(element->GetContext());
+	}
+
+	smooth_scroll.target = target;
+	smooth_scroll.active = true;
+
+	element->RequestUpdate();
+}
+
+// Smoothly scrolls the host element by the given distance.
+void ElementScroll::SmoothScrollBy(Vector2f delta)
+{
+	const Vector2f origin = (IsSmoothScrolling() ? smooth_scroll.target : Vector2f(element->GetScrollLeft(), element->GetScrollTop()));
+	SmoothScrollTo(origin + delta);
+}
+
+// Returns true while a smooth scroll is in progress.
+bool ElementScroll::IsSmoothScrolling() const
+{
+	// The scroll is no longer ours to animate if the offset has been changed by other means since the last step.
+	return smooth_scroll.active && smooth_scroll.applied == Vector2f(element->GetScrollLeft(), element->GetScrollTop());
+}
+
+void ElementScroll::UpdateSmoothScroll()
+{
+	if (!smooth_scroll.active)
+		return;
+
+	if (!IsSmoothScrolling())
+	{
+		smooth_scroll = SmoothScroll();
+		return;
+	}
+
+	const double time = Clock::GetElapsedTime(element->GetContext());
+	const float dt = Math::Max(float(time - smooth_scroll.last_time), 0.f);
+	smooth_scroll.last_time = time;
+
+	// Take the exact step of a critically damped spring, so that the motion is independent of the frame rate.
+	const float omega = SMOOTH_SCROLL_FREQUENCY;
+	const float decay = Math::Exp(-omega * dt);
+	const Vector2f displacement = smooth_scroll.position - smooth_scroll.target;
+	const Vector2f impulse = (smooth_scroll.velocity + displacement * omega) * dt;
+
+	smooth_scroll.velocity = (smooth_scroll.velocity - impulse * omega) * decay;
+	smooth_scroll.position = smooth_scroll.target + (displacement + impulse) * decay;
+
+	const Vector2f remaining = smooth_scroll.target - smooth_scroll.position;
+	if (Math::AbsoluteValue(remaining.x) < SMOOTH_SCROLL_END_DISTANCE && Math::AbsoluteValue(remaining.y) < SMOOTH_SCROLL_END_DISTANCE &&
+		smooth_scroll.velocity.Magnitude() < SMOOTH_SCROLL_END_SPEED)
+	{
+		smooth_scroll.position = smooth_scroll.target;
+		smooth_scroll.velocity = Vector2f(0.f);
+		smooth_scroll.active = false;
+	}
+
+	// The offsets are rounded when set, so the unrounded position is kept for the next step.
+	const Vector2f position = smooth_scroll.position;
+	element->SetScrollLeft(position.x);
+	element->SetScrollTop(position.y);
+	smooth_scroll.applied = Vector2f(element->GetScrollLeft(), element->GetScrollTop());
+}
+
 } // namespace Rml
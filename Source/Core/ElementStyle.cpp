@@ -44,6 +44,7 @@
 #include "../../Include/RmlUi/Core/TransformPrimitive.h"
 #include "ElementDecoration.h"
 #include "ElementDefinition.h"
+#include "FrameStatisticsRecorder.h"
 #include "ComputeProperty.h"
 #include "PropertiesIterator.h"
 #include <algorithm>
@@ -114,15 +115,27 @@ const Property* ElementStyle::GetProperty(PropertyId id, const Element* element,
 
 // Apply transition to relevant properties if a transition is defined on element.
 // Properties that are part of a transition are removed from the properties list.
-void ElementStyle::TransitionPropertyChanges(Element* element, PropertyIdSet& properties, const PropertyDictionary& inline_properties, const ElementDefinition* old_definition, const ElementDefinition* new_definition)
+void ElementStyle::TransitionPropertyChanges(Element* element, PropertyIdSet& properties, const PropertyDictionary& inline_properties, const ElementDefinition* old_definition, const ElementDefinition* new_definition, const Vector<Transition>& definition_transitions)
 {
 	RMLUI_ASSERT(element);
 	if (!old_definition || !new_definition || properties.Empty())
 		return;
 
+	static const PropertyDictionary empty_properties;
+
+	auto add_transition = [&](const Transition& transition) {
+		bool transition_added = false;
+		const Property* start_value = GetProperty(transition.id, element, inline_properties, old_definition);
+		const Property* target_value = GetProperty(transition.id, element, empty_properties, new_definition);
+		if (start_value && target_value && (*start_value != *target_value))
+			transition_added = element->StartTransition(transition, *start_value, *target_value);
+		return transition_added;
+	};
+
 	// We get the local property instead of the computed value here, because we want to intercept property changes even before the computed values are ready.
 	// Now that we have the concept of computed values, we may want do this operation directly on them instead.
-	if (const Property* transition_property = GetLocalProperty(PropertyId::Transition, inline_properties, new_definition))
+	// An inline transition property overrides the one in the definition, in that case the precomputed transitions don't apply.
+	if (const Property* transition_property = inline_properties.GetProperty(PropertyId::Transition))
 	{
 		if (transition_property->value.GetType() != Variant::TRANSITIONLIST)
 			return;
@@ -131,17 +144,6 @@ void ElementStyle::TransitionPropertyChanges(Element* element, PropertyIdSet& pr
 
 		if (!transition_list.none)
 		{
-			static const PropertyDictionary empty_properties;
-
-			auto add_transition = [&](const Transition& transition) {
-				bool transition_added = false;
-				const Property* start_value = GetProperty(transition.id, element, inline_properties, old_definition);
-				const Property* target_value = GetProperty(transition.id, element, empty_properties, new_definition);
-				if (start_value && target_value && (*start_value != *target_value))
-					transition_added = element->StartTransition(transition, *start_value, *target_value);
-				return transition_added;
-			};
-
 			if (transition_list.all)
 			{
 				Transition transition = transition_list.transitions[0];
@@ -167,6 +169,17 @@ void ElementStyle::TransitionPropertyChanges(Element* element, PropertyIdSet& pr
 			}
 		}
 	}
+	else
+	{
+		for (const Transition& transition : definition_transitions)
+		{
+			if (properties.Contains(transition.id))
+			{
+				if (add_transition(transition))
+					properties.Erase(transition.id);
+			}
+		}
+	}
 }
 	
 void ElementStyle::UpdateDefinition()
@@ -175,7 +188,11 @@ void ElementStyle::UpdateDefinition()
 	{
 		RMLUI_ZoneScoped;
 
-		definition_dirty = false;
+		if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+		{
+			recorder->GetStatistics().definition_updates += 1;
+			recorder->RecordElementFlags(element, ElementStatistics::DefinitionUpdated);
+		}
 
 		SharedPtr<ElementDefinition> new_definition;
 		
@@ -188,28 +205,23 @@ void ElementStyle::UpdateDefinition()
 		if (new_definition != definition)
 		{
 			PropertyIdSet changed_properties;
-			
-			if (definition)
-				changed_properties = definition->GetPropertyIds();
-
-			if (new_definition)
-				changed_properties |= new_definition->GetPropertyIds();
 
 			if (definition && new_definition)
 			{
-				// Remove properties that compare equal from the changed list.
-				const PropertyIdSet properties_in_both_definitions = (definition->GetPropertyIds() & new_definition->GetPropertyIds());
-
-				for (PropertyId id : properties_in_both_definitions)
-				{
-					const Property* p0 = definition->GetProperty(id);
-					const Property* p1 = new_definition->GetProperty(id);
-					if (p0 && p1 && *p0 == *p1)
-						changed_properties.Erase(id);
-				}
+				// The changed properties and applicable transitions between two definitions are cached on the old definition.
+				const SharedPtr<const ElementDefinition::Change> change = definition->GetChange(new_definition);
+				changed_properties = change->changed_properties;
 
 				// Transition changed properties if transition property is set
-				TransitionPropertyChanges(element, changed_properties, inline_properties, definition.get(), new_definition.get());
+				TransitionPropertyChanges(element, changed_properties, inline_properties, definition.get(), new_definition.get(), change->transitions);
+			}
+			else if (definition)
+			{
+				changed_properties = definition->GetPropertyIds();
+			}
+			else if (new_definition)
+			{
+				changed_properties = new_definition->GetPropertyIds();
 			}
 
 			definition = new_definition;
@@ -217,6 +229,9 @@ void ElementStyle::UpdateDefinition()
 			DirtyProperties(changed_properties);
 		}
 
+		// Cleared after dirtying the properties, as the element is already being updated.
+		definition_dirty = false;
+
 		// Even if the definition was not changed, the child definitions may have changed as a result of anything that
 		// could change the definition of this element, such as a new pseudo class.
 		DirtyChildDefinitions();
@@ -328,6 +343,11 @@ bool ElementStyle::SetProperty(PropertyId id, const Property& property)
 	if (!new_property.definition)
 		return false;
 
+	// Setting the same value again should not dirty the element, as this would cause needless updates.
+	const Property* old_property = inline_properties.GetProperty(id);
+	if (old_property && *old_property == new_property && old_property->definition == new_property.definition)
+		return true;
+
 	inline_properties.SetProperty(id, new_property);
 	DirtyProperty(id);
 
@@ -462,11 +482,13 @@ float ElementStyle::ResolveLength(const Property* property, RelativeTarget relat
 
 void ElementStyle::DirtyDefinition()
 {
+	RequestElementUpdate();
 	definition_dirty = true;
 }
 
 void ElementStyle::DirtyInheritedProperties()
 {
+	RequestElementUpdate();
 	dirty_properties |= StyleSheetSpecification::GetRegisteredInheritedProperties();
 }
 
@@ -530,15 +552,27 @@ PropertiesIterator ElementStyle::Iterate() const {
 // Sets a single property as dirty.
 void ElementStyle::DirtyProperty(PropertyId id)
 {
+	RequestElementUpdate();
 	dirty_properties.Insert(id);
 }
 
 // Sets a list of properties as dirty.
 void ElementStyle::DirtyProperties(const PropertyIdSet& properties)
 {
+	if (properties.Empty())
+		return;
+
+	RequestElementUpdate();
 	dirty_properties |= properties;
 }
 
+void ElementStyle::RequestElementUpdate()
+{
+	// The element has already requested an update if the style is dirty.
+	if (!definition_dirty && dirty_properties.Empty())
+		element->RequestUpdate();
+}
+
 PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const Style::ComputedValues* parent_values, const Style::ComputedValues* document_values, bool values_are_default_initialized, float dp_ratio, Vector2f vp_dimensions)
 {
 	if (dirty_properties.Empty())
@@ -546,6 +580,9 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 
 	RMLUI_ZoneScopedC(0xFF7F50);
 
+	if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+		recorder->GetStatistics().computed_values_updates += 1;
+
 	// Generally, this is how it works:
 	//   1. Assign default values (clears any removed properties)
 	//   2. Inherit inheritable values from parent
@@ -869,6 +906,9 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		case PropertyId::PointerEvents:
 			values.pointer_events = (PointerEvents)p->Get<int>();
 			break;
+		case PropertyId::ScrollBehavior:
+			values.scroll_behavior = (ScrollBehavior)p->Get<int>();
+			break;
 
 		case PropertyId::Perspective:
 			values.perspective = ComputeLength(p, font_size, document_font_size, dp_ratio, vp_dimensions);
@@ -934,7 +974,7 @@ PropertyIdSet ElementStyle::ComputeValues(Style::ComputedValues& values, const S
 		for (int i = 0; i < element->GetNumChildren(true); i++)
 		{
 			auto child = element->GetChild(i);
-			child->GetStyle()->dirty_properties |= dirty_inherited_properties;
+			child->GetStyle()->DirtyProperties(dirty_inherited_properties);
 		}
 	}
 	
@@ -29,6 +29,7 @@
 #include "../../Include/RmlUi/Core/ElementText.h"
 #include "ElementDefinition.h"
 #include "ElementStyle.h"
+#include "TransformState.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
@@ -38,6 +39,11 @@
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/Property.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include <algorithm>
+
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+#include "FontEngineDefault/FontProvider.h"
+#endif
 
 namespace Rml {
 
@@ -56,6 +62,12 @@ ElementText::ElementText(const String& tag) : Element(tag), colour(255, 255, 255
 	font_effects_handle = 0;
 	font_effects_dirty = true;
 	font_handle_version = 0;
+
+	generated_lines_begin = 0;
+	generated_lines_end = 0;
+	generated_font_face_handle = 0;
+	generated_font_effects_handle = 0;
+	generated_font_handle_version = 0;
 }
 
 ElementText::~ElementText()
@@ -85,6 +97,12 @@ void ElementText::OnRender()
 	FontFaceHandle font_face_handle = GetFontFaceHandle();
 	if (font_face_handle == 0)
 		return;
+
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	// The font face handle may be changed by a context on another thread. Hold the font lock while our geometry is
+	// validated and generated, it can then be rendered without the lock as it holds on to its own textures.
+	std::unique_lock<std::recursive_mutex> font_lock(FontProvider::GetMutex());
+#endif
 	
 	// If our font effects have potentially changed, update it and force a geometry generation if necessary.
 	if (font_effects_dirty && UpdateFontEffects())
@@ -98,9 +116,51 @@ void ElementText::OnRender()
 		geometry_dirty = true;
 	}
 
-	// Regenerate the geometry if the colour or font configuration has altered.
-	if (geometry_dirty)
-		GenerateGeometry(font_face_handle);
+	const Vector2f translation = GetAbsoluteOffset();
+
+	// Find the range of lines inside the clipping region, geometry is only needed for these lines. We can't easily tell
+	// which lines are visible when the element is transformed, then all lines are considered visible.
+	int visible_begin = 0;
+	int visible_end = (int)lines.size();
+
+	const TransformState* transform_state = GetTransformState();
+	Vector2i clip_origin;
+	Vector2i clip_dimensions;
+	if ((!transform_state || !transform_state->GetTransform()) && GetContext()->GetActiveClipRegion(clip_origin, clip_dimensions))
+	{
+		float clip_top = (float)clip_origin.y;
+		float clip_left = (float)clip_origin.x;
+		float clip_right = (float)(clip_origin.x + clip_dimensions.x);
+		float clip_bottom = (float)(clip_origin.y + clip_dimensions.y);
+		float line_height = (float)GetFontEngineInterface()->GetLineHeight(GetFontFaceHandle());
+
+		// Lines are placed from top to bottom, so we can search for the vertical range of lines inside the clipping region.
+		auto it_begin = std::partition_point(lines.begin(), lines.end(), [&](const Line& line) { return translation.y + line.position.y < clip_top; });
+		auto it_end = std::partition_point(it_begin, lines.end(), [&](const Line& line) { return translation.y + line.position.y - line_height <= clip_bottom; });
+		visible_begin = int(it_begin - lines.begin());
+		visible_end = int(it_end - lines.begin());
+
+		// Then trim any lines outside the clipping region horizontally from the ends of the range.
+		auto IsInsideHorizontally = [&](const Line& line) {
+			const float x = translation.x + line.position.x;
+			return !(x > clip_right) && !(line.width >= 0 && x + line.width < clip_left);
+		};
+		while (visible_begin < visible_end && !IsInsideHorizontally(lines[visible_begin]))
+			visible_begin += 1;
+		while (visible_begin < visible_end && !IsInsideHorizontally(lines[visible_end - 1]))
+			visible_end -= 1;
+	}
+
+	const bool render = (visible_begin < visible_end);
+
+	// Regenerate the geometry if the colour or font configuration has altered, or if visible lines are missing their
+	// geometry. We generate the visible lines plus a margin of the same number of lines on each side, so that we don't
+	// need to regenerate on every scroll.
+	if (render && (geometry_dirty || visible_begin < generated_lines_begin || visible_end > generated_lines_end))
+	{
+		const int margin = visible_end - visible_begin;
+		GenerateGeometry(font_face_handle, Math::Max(visible_begin - margin, 0), Math::Min(visible_end + margin, (int)lines.size()));
+	}
 
 	// Regenerate text decoration if necessary.
 	if (decoration_property != generated_decoration)
@@ -113,40 +173,10 @@ void ElementText::OnRender()
 		generated_decoration = decoration_property;
 	}
 
-	const Vector2f translation = GetAbsoluteOffset();
-	
-	bool render = true;
-	Vector2i clip_origin;
-	Vector2i clip_dimensions;
-	if (GetContext()->GetActiveClipRegion(clip_origin, clip_dimensions))
-	{
-		float clip_top = (float)clip_origin.y;
-		float clip_left = (float)clip_origin.x;
-		float clip_right = (float)(clip_origin.x + clip_dimensions.x);
-		float clip_bottom = (float)(clip_origin.y + clip_dimensions.y);
-		float line_height = (float)GetFontEngineInterface()->GetLineHeight(GetFontFaceHandle());
-		
-		render = false;
-		for (size_t i = 0; i < lines.size(); ++i)
-		{			
-			const Line& line = lines[i];
-			float x = translation.x + line.position.x;
-			float y = translation.y + line.position.y;
-			
-			bool render_line = !(x > clip_right);
-			render_line = render_line && !(x + line.width < clip_left);
-			
-			render_line = render_line && !(y - line_height > clip_bottom);
-			render_line = render_line && !(y < clip_top);
-			
-			if (render_line)
-			{
-				render = true;
-				break;
-			}
-		}
-	}
-	
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+	font_lock.unlock();
+#endif
+
 	if (render)
 	{
 		for (size_t i = 0; i < geometry.size(); ++i)
@@ -310,11 +340,12 @@ bool ElementText::GenerateLine(String& line, int& line_length, float& line_width
 // Clears all lines of generated text and prepares the element for generating new lines.
 void ElementText::ClearLines()
 {
-	// Clear the rendering information.
-	for (size_t i = 0; i < geometry.size(); ++i)
-		geometry[i].Release(true);
+	// Keep the lines matching the current geometry around, their geometry can be reused if the same lines are added again.
+	if (!geometry_dirty)
+		previous_lines = std::move(lines);
 
 	lines.clear();
+	geometry_dirty = true;
 	generated_decoration = Style::TextDecoration::None;
 	decoration.Release(true);
 }
@@ -336,6 +367,53 @@ void ElementText::AddLine(Vector2f line_position, const String& line)
 	geometry_dirty = true;
 }
 
+// Replaces a range of lines with new lines, the remaining lines keep their geometry.
+void ElementText::ReplaceLines(int lines_begin, int lines_end, const Vector<Pair<Vector2f, String>>& new_lines, Vector2f following_lines_offset)
+{
+	RMLUI_ASSERT(lines_begin >= 0 && lines_begin <= lines_end && lines_end <= (int)lines.size());
+
+	FontFaceHandle font_face_handle = GetFontFaceHandle();
+
+	if (font_face_handle == 0)
+		return;
+
+	if (font_effects_dirty)
+		UpdateFontEffects();
+
+	if (following_lines_offset != Vector2f(0, 0))
+	{
+		for (int i = lines_end; i < (int)lines.size(); i++)
+			lines[i].position += following_lines_offset;
+	}
+
+	const int num_replaced = lines_end - lines_begin;
+	const int num_new = (int)new_lines.size();
+
+	if (num_new < num_replaced)
+		lines.erase(lines.begin() + lines_begin + num_new, lines.begin() + lines_end);
+	else if (num_new > num_replaced)
+		lines.insert(lines.begin() + lines_end, size_t(num_new - num_replaced), Line(String(), Vector2f(0, 0)));
+
+	const Vector2f baseline_offset = Vector2f(0.0f, (float)GetFontEngineInterface()->GetLineHeight(font_face_handle) - GetFontEngineInterface()->GetBaseline(font_face_handle));
+	for (int i = 0; i < num_new; i++)
+		lines[lines_begin + i] = Line(new_lines[i].second, new_lines[i].first + baseline_offset);
+
+	// Keep the generated range covering all the lines which still have geometry.
+	const int num_added = num_new - num_replaced;
+	if (generated_lines_end > lines_end)
+		generated_lines_end += num_added;
+	else if (generated_lines_end > lines_begin)
+		generated_lines_end = lines_begin;
+	if (generated_lines_begin >= lines_end)
+		generated_lines_begin += num_added;
+	else if (generated_lines_begin > lines_begin)
+		generated_lines_begin = lines_begin;
+
+	geometry_dirty = true;
+	generated_decoration = Style::TextDecoration::None;
+	decoration.Release(true);
+}
+
 // Prevents the element from dirtying its document's layout when its text is changed.
 void ElementText::SuppressAutoLayout()
 {
@@ -444,30 +522,173 @@ bool ElementText::UpdateFontEffects()
 	return false;
 }
 
-// Clears and regenerates all of the text's geometry.
-void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle)
+// Clears and regenerates the text's geometry for the given range of lines.
+void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle, int lines_begin, int lines_end)
 {
 	RMLUI_ZoneScopedC(0xD2691E);
 
-	// Release the old geometry ...
+	// Move the old geometry aside, the geometry of lines which are unchanged since the last generation is copied from here ...
+	GeometryList previous_geometry;
+	previous_geometry.swap(geometry);
+
+	const bool reuse_geometry = (font_face_handle == generated_font_face_handle && font_effects_handle == generated_font_effects_handle &&
+		font_handle_version == generated_font_handle_version && colour == generated_colour);
+
+	// Lines which have been added since the lines were cleared look up the previous lines by their text. Only the
+	// previous lines in the generated range have geometry to reuse.
+	UnorderedMap< size_t, int > previous_line_map;
+	if (reuse_geometry && !previous_lines.empty())
+	{
+		const int previous_end = Math::Min(generated_lines_end, (int)previous_lines.size());
+		previous_line_map.reserve(size_t(Math::Max(previous_end - generated_lines_begin, 0)));
+		for (int i = generated_lines_begin; i < previous_end; ++i)
+			previous_line_map.emplace(Hash< String >()(previous_lines[i].text), i);
+	}
+
+	// ... and generate the rest again!
+	for (int i = lines_begin; i < lines_end; ++i)
+	{
+		Line& line = lines[i];
+
+		// Lines kept since the last generation can reuse their own geometry.
+		bool reused = false;
+		if (reuse_geometry && !line.geometry_slices.empty())
+		{
+			reused = ReuseGeometry(line, previous_geometry, line);
+		}
+		else if (!previous_line_map.empty())
+		{
+			auto it = previous_line_map.find(Hash< String >()(line.text));
+			if (it != previous_line_map.end())
+				reused = ReuseGeometry(previous_lines[it->second], previous_geometry, line);
+		}
+
+		if (!reused)
+			GenerateGeometry(font_face_handle, line);
+	}
+
+	// Lines which are no longer in the generated range are left without geometry.
+	const int previous_end = Math::Min(generated_lines_end, (int)lines.size());
+	for (int i = generated_lines_begin; i < previous_end; ++i)
+	{
+		if (i < lines_begin || i >= lines_end)
+			lines[i].geometry_slices.clear();
+	}
+
+	for (Geometry& line_geometry : geometry)
+		line_geometry.SetHostElement(this);
+
+	// Take our own references to the font textures, and load them now while the font face handle is up to date.
+	Vector< Texture > new_geometry_textures;
+	new_geometry_textures.reserve(geometry.size());
+	for (const Geometry& line_geometry : geometry)
+		new_geometry_textures.push_back(line_geometry.GetTexture() ? *line_geometry.GetTexture() : Texture());
+	geometry_textures.swap(new_geometry_textures);
+
+	RenderInterface* render_interface = GetRenderInterface();
 	for (size_t i = 0; i < geometry.size(); ++i)
-		geometry[i].Release(true);
+	{
+		if (geometry_textures[i])
+		{
+			geometry[i].SetTexture(&geometry_textures[i]);
+			geometry_textures[i].GetHandle(render_interface);
+		}
+	}
 
-	// ... and generate it all again!
-	for (size_t i = 0; i < lines.size(); ++i)
-		GenerateGeometry(font_face_handle, lines[i]);
+	previous_lines.clear();
 
-	decoration.Release(true);
-	generated_decoration = Style::TextDecoration::None;
+	generated_lines_begin = lines_begin;
+	generated_lines_end = lines_end;
+	generated_font_face_handle = font_face_handle;
+	generated_font_effects_handle = font_effects_handle;
+	generated_font_handle_version = font_handle_version;
+	generated_colour = colour;
+
+	// The decoration only needs to be regenerated when the lines or their style has changed.
+	if (geometry_dirty)
+	{
+		decoration.Release(true);
+		generated_decoration = Style::TextDecoration::None;
+	}
 
 	geometry_dirty = false;
 }
 
 void ElementText::GenerateGeometry(const FontFaceHandle font_face_handle, Line& line)
 {
+	line.geometry_slices.clear();
+	for (Geometry& text_geometry : geometry)
+		line.geometry_slices.push_back(GeometrySlice{ (int)text_geometry.GetVertices().size(), 0, (int)text_geometry.GetIndices().size(), 0 });
+
 	line.width = GetFontEngineInterface()->GenerateString(font_face_handle, font_effects_handle, line.text, line.position, colour, geometry);
+	line.geometry_position = line.position;
+
+	// Record the geometry generated for this line, new geometries may have been added by the font engine.
+	line.geometry_slices.resize(geometry.size(), GeometrySlice{ 0, 0, 0, 0 });
+	for (size_t i = 0; i < geometry.size(); ++i)
+	{
+		GeometrySlice& slice = line.geometry_slices[i];
+		slice.num_vertices = (int)geometry[i].GetVertices().size() - slice.vertex_begin;
+		slice.num_indices = (int)geometry[i].GetIndices().size() - slice.index_begin;
+	}
+}
+
+bool ElementText::ReuseGeometry(const Line& previous_line, GeometryList& previous_geometry, Line& line)
+{
+	if (line.text != previous_line.text || previous_line.geometry_slices.size() != previous_geometry.size())
+		return false;
+
+	// Glyph positions are rounded, thus the geometry can only be moved by whole pixels.
+	const Vector2f translation = line.position - previous_line.geometry_position;
+	if (translation != translation.Round())
+		return false;
+
+	if (geometry.empty())
+	{
+		geometry.resize(previous_geometry.size());
+		for (size_t i = 0; i < geometry.size(); ++i)
+			geometry[i].SetTexture(previous_geometry[i].GetTexture());
+	}
+	else if (geometry.size() != previous_geometry.size())
+		return false;
+
+	// The previous geometry refers to our copies of the font textures, compare them by their underlying resource.
 	for (size_t i = 0; i < geometry.size(); ++i)
-		geometry[i].SetHostElement(this);
+	{
+		const Texture* texture = geometry[i].GetTexture();
+		const Texture* previous_texture = previous_geometry[i].GetTexture();
+		if (texture != previous_texture && !(texture && previous_texture && *texture == *previous_texture))
+			return false;
+	}
+
+	line.geometry_slices.resize(geometry.size());
+
+	for (size_t i = 0; i < geometry.size(); ++i)
+	{
+		// Copied by value, as the previous line may be the same as the new line.
+		const GeometrySlice previous_slice = previous_line.geometry_slices[i];
+		const Vertex* previous_vertices = previous_geometry[i].GetVertices().data() + previous_slice.vertex_begin;
+		const int* previous_indices = previous_geometry[i].GetIndices().data() + previous_slice.index_begin;
+
+		Vector< Vertex >& vertices = geometry[i].GetVertices();
+		Vector< int >& indices = geometry[i].GetIndices();
+
+		GeometrySlice& slice = line.geometry_slices[i];
+		slice = GeometrySlice{ (int)vertices.size(), previous_slice.num_vertices, (int)indices.size(), previous_slice.num_indices };
+
+		vertices.insert(vertices.end(), previous_vertices, previous_vertices + previous_slice.num_vertices);
+		for (int j = slice.vertex_begin; j < (int)vertices.size(); ++j)
+			vertices[j].position += translation;
+
+		const int index_offset = slice.vertex_begin - previous_slice.vertex_begin;
+		for (int j = 0; j < previous_slice.num_indices; ++j)
+			indices.push_back(previous_indices[j] + index_offset);
+	}
+
+	line.width = previous_line.width;
+	line.geometry_position = line.position;
+
+	return true;
 }
 
 // Generates any geometry necessary for rendering a line decoration (underline, strike-through, etc).
@@ -475,8 +696,14 @@ void ElementText::GenerateDecoration(const FontFaceHandle font_face_handle)
 {
 	RMLUI_ZoneScopedC(0xA52A2A);
 	
-	for(const Line& line : lines)
+	for (Line& line : lines)
+	{
+		// Lines outside the visible range may not have been measured yet.
+		if (line.width < 0)
+			line.width = GetFontEngineInterface()->GetStringWidth(font_face_handle, line.text);
+
 		GeometryUtilities::GenerateLine(font_face_handle, &decoration, line.position, line.width, decoration_property, colour);
+	}
 }
 
 static bool BuildToken(String& token, const char*& token_begin, const char* string_end, bool first_token, bool collapse_white_space, bool break_at_endline, Style::TextTransform text_transformation, bool decode_escape_characters)
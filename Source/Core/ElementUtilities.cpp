@@ -335,7 +335,7 @@ bool ElementUtilities::ApplyTransform(Element &element)
 		const Matrix4f* pointer; // This may be expired, dereferencing not allowed!
 		Matrix4f value;
 	};
-	static SmallUnorderedMap<RenderInterface*, PreviousMatrix> previous_matrix;
+	static thread_local SmallUnorderedMap<RenderInterface*, PreviousMatrix> previous_matrix;
 
 	auto it = previous_matrix.find(render_interface);
 	if (it == previous_matrix.end())
@@ -30,12 +30,15 @@
 #include "../../../Include/RmlUi/Core/Elements/DataSource.h"
 #include "../../../Include/RmlUi/Core/Math.h"
 #include "../../../Include/RmlUi/Core/XMLParser.h"
+#include "../../../Include/RmlUi/Core/Log.h"
 #include "../../../Include/RmlUi/Core/Event.h"
 #include "../../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../../Include/RmlUi/Core/Factory.h"
 #include "../../../Include/RmlUi/Core/Property.h"
 #include "../../../Include/RmlUi/Core/Elements/DataFormatter.h"
+#include "../../../Include/RmlUi/Core/Elements/DataQuery.h"
 #include "../../../Include/RmlUi/Core/Elements/ElementDataGridRow.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -66,10 +69,15 @@ ElementDataGrid::ElementDataGrid(const String& tag) : Element(tag)
 	SetProperty(PropertyId::OverflowY, Property(Style::Overflow::Auto));
 
 	new_data_source = "";
+
+	// Rows are fetched lazily from the data source and as the grid is scrolled, keep polling for them.
+	SetUpdateEveryFrame(true);
 }
 
 ElementDataGrid::~ElementDataGrid()
 {
+	if (virtual_data_source)
+		virtual_data_source->DetachListener(this);
 }
 
 void ElementDataGrid::SetDataSource(const String& data_source_name)
@@ -77,6 +85,28 @@ void ElementDataGrid::SetDataSource(const String& data_source_name)
 	new_data_source = data_source_name;
 }
 
+void ElementDataGrid::SetVirtualized(bool in_virtualized)
+{
+	if (virtualized == in_virtualized)
+		return;
+
+	// Remove the rows of the current mode, and set the data source again in the next update.
+	if (virtualized)
+		SetVirtualDataSource("");
+	else
+		root->SetDataSource("");
+
+	virtualized = in_virtualized;
+
+	if (new_data_source.empty())
+		new_data_source = data_source_name;
+}
+
+bool ElementDataGrid::IsVirtualized() const
+{
+	return virtualized;
+}
+
 // Adds a column to the table.
 bool ElementDataGrid::AddColumn(const String& fields, const String& formatter, float initial_width, const String& header_rml)
 {
@@ -135,6 +165,10 @@ void ElementDataGrid::AddColumn(const String& fields, const String& formatter, f
 
 	columns.push_back(column);
 
+	// Virtualized rows are created for the current columns, so instance them again.
+	if (virtualized)
+		ReleaseVirtualRows();
+
 	Dictionary parameters;
 	parameters["index"] = (int)(columns.size() - 1);
 	if (DispatchEvent(EventId::Columnadd, parameters))
@@ -211,12 +245,23 @@ void ElementDataGrid::RemoveRows(int index, int num_rows)
 // Returns the number of rows in the table
 int ElementDataGrid::GetNumRows() const
 {
+	if (virtualized)
+		return virtual_num_rows;
+
 	return body->GetNumChildren();
 }
 
 // Returns the row at the given index in the table.
 ElementDataGridRow* ElementDataGrid::GetRow(int index) const
 {
+	if (virtualized)
+	{
+		const int slot = index - virtual_first_row;
+		if (slot < 0 || slot >= (int)virtual_rows.size())
+			return nullptr;
+		return virtual_rows[slot];
+	}
+
 	// We need to add two to the index, to skip the header row.
 	ElementDataGridRow* row = rmlui_dynamic_cast< ElementDataGridRow* >(body->GetChild(index));
 	return row;
@@ -226,11 +271,16 @@ void ElementDataGrid::OnUpdate()
 {
 	if (!new_data_source.empty())
 	{
-		root->SetDataSource(new_data_source);
+		if (virtualized)
+			SetVirtualDataSource(new_data_source);
+		else
+			root->SetDataSource(new_data_source);
+
+		data_source_name = new_data_source;
 		new_data_source = "";
 	}
 
-	bool any_new_children = root->UpdateChildren();
+	bool any_new_children = (virtualized ? UpdateVirtualRows() : root->UpdateChildren());
 	if (any_new_children)
 	{
 		DispatchEvent(EventId::Rowupdate, Dictionary());
@@ -249,6 +299,256 @@ void ElementDataGrid::OnResize()
 	}
 }
 
+void ElementDataGrid::OnAttributeChange(const ElementAttributes& changed_attributes)
+{
+	Element::OnAttributeChange(changed_attributes);
+
+	if (changed_attributes.find("virtualize") != changed_attributes.end())
+		SetVirtualized(HasAttribute("virtualize"));
+}
+
+void ElementDataGrid::OnDataSourceDestroy(DataSource* data_source)
+{
+	if (data_source == virtual_data_source)
+		SetVirtualDataSource("");
+}
+
+void ElementDataGrid::OnRowAdd(DataSource* data_source, const String& table, int first_row_added, int num_rows_added)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	// Only the visible rows at or after the new rows need to be fetched again.
+	virtual_num_rows += num_rows_added;
+	DirtyVirtualRows(first_row_added);
+
+	Dictionary parameters;
+	parameters["first_row_added"] = first_row_added;
+	parameters["num_rows_added"] = num_rows_added;
+	DispatchEvent(EventId::Rowadd, parameters);
+}
+
+void ElementDataGrid::OnRowRemove(DataSource* data_source, const String& table, int first_row_removed, int num_rows_removed)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	virtual_num_rows = Math::Max(virtual_num_rows - num_rows_removed, 0);
+	DirtyVirtualRows(first_row_removed);
+
+	Dictionary parameters;
+	parameters["first_row_removed"] = first_row_removed;
+	parameters["num_rows_removed"] = num_rows_removed;
+	DispatchEvent(EventId::Rowremove, parameters);
+}
+
+void ElementDataGrid::OnRowChange(DataSource* data_source, const String& table, int first_row_changed, int num_rows_changed)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	DirtyVirtualRows(first_row_changed, num_rows_changed);
+
+	Dictionary parameters;
+	parameters["first_row_changed"] = first_row_changed;
+	parameters["num_rows_changed"] = num_rows_changed;
+	DispatchEvent(EventId::Rowchange, parameters);
+}
+
+void ElementDataGrid::OnRowChange(DataSource* data_source, const String& table)
+{
+	if (data_source != virtual_data_source || table != virtual_data_table)
+		return;
+
+	virtual_num_rows = virtual_data_source->GetNumRows(virtual_data_table);
+	DirtyVirtualRows(0);
+
+	// The whole table may have changed.
+	Dictionary parameters;
+	parameters["first_row_changed"] = 0;
+	parameters["num_rows_changed"] = virtual_num_rows;
+	DispatchEvent(EventId::Rowchange, parameters);
+}
+
+void ElementDataGrid::SetVirtualDataSource(const String& new_data_source_name)
+{
+	if (virtual_data_source)
+	{
+		virtual_data_source->DetachListener(this);
+		virtual_data_source = nullptr;
+	}
+
+	ReleaseVirtualRows();
+	virtual_num_rows = 0;
+	virtual_first_row = 0;
+
+	if (!new_data_source_name.empty() && ParseDataSource(virtual_data_source, virtual_data_table, new_data_source_name))
+	{
+		virtual_data_source->AttachListener(this);
+		virtual_num_rows = virtual_data_source->GetNumRows(virtual_data_table);
+	}
+	else
+	{
+		virtual_data_source = nullptr;
+	}
+}
+
+bool ElementDataGrid::UpdateVirtualRows()
+{
+	if (!virtual_data_source)
+		return false;
+
+	if (!virtual_spacer_top)
+	{
+		XMLAttributes attributes;
+		ElementPtr element = Factory::InstanceElement(body, "*", "datagridspacer", attributes);
+		element->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+		virtual_spacer_top = body->AppendChild(std::move(element));
+
+		element = Factory::InstanceElement(body, "*", "datagridspacer", attributes);
+		element->SetProperty(PropertyId::Display, Property(Style::Display::Block));
+		virtual_spacer_bottom = body->AppendChild(std::move(element));
+
+		virtual_spacer_top_height = -1.f;
+		virtual_spacer_bottom_height = -1.f;
+	}
+
+	// Measure the row height from the previous layout of the rows.
+	if (virtual_rows.size() >= 2)
+		virtual_row_height = virtual_rows[1]->GetAbsoluteOffset(Box::BORDER).y - virtual_rows[0]->GetAbsoluteOffset(Box::BORDER).y;
+	else if (virtual_rows.size() == 1)
+		virtual_row_height = virtual_rows[0]->GetBox().GetSize(Box::MARGIN).y;
+
+	if (virtual_row_height <= 0.f)
+		virtual_row_height = Math::Max(GetLineHeight(), 1.f);
+
+	// Find the range of rows inside the visible area of the grid.
+	const float view_top = GetAbsoluteOffset(Box::PADDING).y - body->GetAbsoluteOffset(Box::CONTENT).y;
+	const int first_row = Math::Clamp(int(view_top / virtual_row_height), 0, Math::Max(virtual_num_rows - 1, 0));
+	const int num_rows = Math::Min(int(GetClientHeight() / virtual_row_height) + 2, virtual_num_rows - first_row);
+
+	// Remove or add rows at the end to match the number of visible rows, new rows are fetched below.
+	const int num_previous_rows = (int)virtual_rows.size();
+	while ((int)virtual_rows.size() > num_rows)
+	{
+		body->RemoveChild(virtual_rows.back());
+		virtual_rows.pop_back();
+	}
+
+	while ((int)virtual_rows.size() < num_rows)
+	{
+		ElementPtr element = Factory::InstanceElement(this, "#rmlctl_datagridrow", "datagridrow", XMLAttributes());
+		ElementDataGridRow* row = rmlui_dynamic_cast< ElementDataGridRow* >(element.get());
+		// A non-negative child index keeps the row collapsed, child rows are not displayed in virtualized mode.
+		row->Initialise(this, nullptr, 0, header, 0);
+		body->InsertBefore(std::move(element), virtual_spacer_bottom);
+		virtual_rows.push_back(row);
+	}
+
+	if (num_rows != num_previous_rows)
+		DirtyLayout();
+
+	// Recycle the rows scrolled out of view by moving them to the other end, these are fetched again below.
+	const int shift = first_row - virtual_first_row;
+	if (std::abs(shift) >= (int)virtual_rows.size())
+	{
+		for (ElementDataGridRow* row : virtual_rows)
+			row->dirty_cells = true;
+	}
+	else if (shift > 0)
+	{
+		for (int i = 0; i < shift; i++)
+		{
+			ElementDataGridRow* row = virtual_rows[i];
+			body->InsertBefore(body->RemoveChild(row), virtual_spacer_bottom);
+			row->dirty_cells = true;
+		}
+		std::rotate(virtual_rows.begin(), virtual_rows.begin() + shift, virtual_rows.end());
+	}
+	else if (shift < 0)
+	{
+		Element* next_row = virtual_rows.front();
+		for (int i = 0; i < -shift; i++)
+		{
+			ElementDataGridRow* row = virtual_rows[virtual_rows.size() - 1 - i];
+			body->InsertBefore(body->RemoveChild(row), next_row);
+			row->dirty_cells = true;
+			next_row = row;
+		}
+		std::rotate(virtual_rows.begin(), virtual_rows.end() + shift, virtual_rows.end());
+	}
+
+	virtual_first_row = first_row;
+
+	// Fetch the dirty rows from the data source, in contiguous ranges.
+	bool any_rows_loaded = false;
+	for (int i = 0; i < (int)virtual_rows.size();)
+	{
+		if (!virtual_rows[i]->dirty_cells)
+		{
+			i++;
+			continue;
+		}
+
+		int end = i + 1;
+		while (end < (int)virtual_rows.size() && virtual_rows[end]->dirty_cells)
+			end++;
+
+		DataQuery query(virtual_data_source, virtual_data_table, column_fields, first_row + i, end - i);
+		for (; i < end; i++)
+		{
+			if (!query.NextRow())
+				Log::Message(Log::LT_WARNING, "Failed to load row %d from data source %s", first_row + i, virtual_data_table.c_str());
+
+			virtual_rows[i]->child_index = first_row + i;
+			virtual_rows[i]->Load(query);
+		}
+
+		any_rows_loaded = true;
+	}
+
+	// The spacers take the place of the rows that are not instanced, giving the grid its full scroll height.
+	const float spacer_top_height = float(first_row) * virtual_row_height;
+	const float spacer_bottom_height = float(virtual_num_rows - first_row - (int)virtual_rows.size()) * virtual_row_height;
+
+	if (spacer_top_height != virtual_spacer_top_height)
+	{
+		virtual_spacer_top->SetProperty(PropertyId::Height, Property(spacer_top_height, Property::PX));
+		virtual_spacer_top_height = spacer_top_height;
+	}
+	if (spacer_bottom_height != virtual_spacer_bottom_height)
+	{
+		virtual_spacer_bottom->SetProperty(PropertyId::Height, Property(spacer_bottom_height, Property::PX));
+		virtual_spacer_bottom_height = spacer_bottom_height;
+	}
+
+	return any_rows_loaded;
+}
+
+void ElementDataGrid::DirtyVirtualRows(int first_row, int num_rows)
+{
+	const int begin = Math::Max(first_row - virtual_first_row, 0);
+	const int end = (num_rows < 0 ? (int)virtual_rows.size() : Math::Min(first_row + num_rows - virtual_first_row, (int)virtual_rows.size()));
+
+	for (int i = begin; i < end; i++)
+		virtual_rows[i]->dirty_cells = true;
+}
+
+void ElementDataGrid::ReleaseVirtualRows()
+{
+	for (ElementDataGridRow* row : virtual_rows)
+		body->RemoveChild(row);
+	virtual_rows.clear();
+
+	if (virtual_spacer_top)
+	{
+		body->RemoveChild(virtual_spacer_top);
+		body->RemoveChild(virtual_spacer_bottom);
+		virtual_spacer_top = nullptr;
+		virtual_spacer_bottom = nullptr;
+	}
+}
+
 // Gets the markup and content of the element.
 void ElementDataGrid::GetInnerRML(String& content) const
 {
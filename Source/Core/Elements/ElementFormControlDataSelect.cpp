@@ -84,6 +84,7 @@ void ElementFormControlDataSelect::OnAttributeChange(const ElementAttributes& ch
 		}
 
 		initialised = false;
+		RequestUpdate();
 	}
 	else if (changed_attributes.find("fields") != changed_attributes.end() ||
 			 changed_attributes.find("valuefield") != changed_attributes.end() ||
@@ -43,7 +43,7 @@ class ElementFormControlInput;
 	@author Peter Curry
  */
 
-class InputType
+class InputType : public Allocated<MemoryCategory::Element>
 {
 public:
 	InputType(ElementFormControlInput* element);
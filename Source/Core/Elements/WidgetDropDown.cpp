@@ -290,6 +290,7 @@ void WidgetDropDown::OnValueChange(const String& value)
 	parent_element->DispatchEvent(EventId::Change, parameters);
 
 	value_rml_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::SetSelection(Element* select_option, bool force)
@@ -322,6 +323,7 @@ void WidgetDropDown::SetSelection(Element* select_option, bool force)
 	}
 
 	value_rml_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::SeekSelection(bool seek_forward)
@@ -447,6 +449,7 @@ void WidgetDropDown::OnChildAdd(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::OnChildRemove(Element* element)
@@ -461,6 +464,7 @@ void WidgetDropDown::OnChildRemove(Element* element)
 
 	selection_dirty = true;
 	box_layout_dirty = true;
+	parent_element->RequestUpdate();
 }
 
 void WidgetDropDown::AttachScrollEvent()
@@ -147,7 +147,7 @@ void WidgetSlider::Update()
 		{
 			if (!updated_time)
 			{
-				double current_time = Clock::GetElapsedTime();
+				double current_time = Clock::GetElapsedTime(parent->GetContext());
 				delta_time = float(current_time - last_update_time);
 				last_update_time = current_time;
 			}
@@ -160,6 +160,10 @@ void WidgetSlider::Update()
 			}
 		}
 	}
+
+	// Keep updating while an arrow is held down.
+	if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+		parent->RequestUpdate();
 }
 
 // Sets the position of the bar.
@@ -391,13 +395,15 @@ void WidgetSlider::ProcessEvent(Event& event)
 		else if (event.GetTargetElement() == arrows[0])
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
-			last_update_time = Clock::GetElapsedTime();
+			last_update_time = Clock::GetElapsedTime(parent->GetContext());
+			parent->RequestUpdate();
 			SetBarPosition(OnLineDecrement());
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
-			last_update_time = Clock::GetElapsedTime();
+			last_update_time = Clock::GetElapsedTime(parent->GetContext());
+			parent->RequestUpdate();
 			SetBarPosition(OnLineIncrement());
 		}
 	}
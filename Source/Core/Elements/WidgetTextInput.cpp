@@ -41,6 +41,7 @@
 #include "../../../Include/RmlUi/Core/StringUtilities.h"
 #include "../Clock.h"
 #include <algorithm>
+#include <iterator>
 #include <limits.h>
 
 namespace Rml {
@@ -103,6 +104,15 @@ WidgetTextInput::WidgetTextInput(ElementFormControl* _parent) : internal_dimensi
 
 	max_length = -1;
 
+	changed_begin_index = -1;
+	changed_end_index = -1;
+	changed_length_delta = 0;
+	reformat_all_lines = true;
+	formatted_line_width = -1;
+	widest_line_width = 0;
+	text_lines_match = false;
+	num_endlines = 0;
+
 	selection_anchor_index = 0;
 	selection_begin_index = 0;
 	selection_length = 0;
@@ -131,6 +141,27 @@ WidgetTextInput::~WidgetTextInput()
 // Sets the value of the text field.
 void WidgetTextInput::SetValue(const String& value)
 {
+	const String& text = text_element->GetText();
+	if (value != text)
+	{
+		// Find the range of the value which has changed, so that only the lines around it need to be reformatted.
+		const size_t common_size = Math::Min(text.size(), value.size());
+		const size_t prefix_size = size_t(std::mismatch(text.begin(), text.begin() + common_size, value.begin()).first - text.begin());
+		const size_t suffix_size = size_t(std::mismatch(text.rbegin(), text.rbegin() + (common_size - prefix_size), value.rbegin()).first - text.rbegin());
+
+		// Changes should be formatted one at a time, otherwise just reformat everything.
+		if (changed_begin_index >= 0)
+			reformat_all_lines = true;
+
+		changed_begin_index = (int)prefix_size;
+		changed_end_index = (int)(value.size() - suffix_size);
+		changed_length_delta = (int)value.size() - (int)text.size();
+
+		// Only the changed range can add or remove endlines.
+		num_endlines -= (int)std::count(text.begin() + prefix_size, text.end() - suffix_size, '\n');
+		num_endlines += (int)std::count(value.begin() + prefix_size, value.end() - suffix_size, '\n');
+	}
+
 	text_element->SetText(value);
 	FormatElement();
 
@@ -220,7 +251,7 @@ void WidgetTextInput::OnUpdate()
 {
 	if (cursor_timer > 0)
 	{
-		double current_time = Clock::GetElapsedTime();
+		double current_time = Clock::GetElapsedTime(parent->GetContext());
 		cursor_timer -= float(current_time - last_update_time);
 		last_update_time = current_time;
 
@@ -229,6 +260,9 @@ void WidgetTextInput::OnUpdate()
 			cursor_timer += CURSOR_BLINK_TIME;
 			cursor_visible = !cursor_visible;
 		}
+
+		// Keep updating to blink the cursor.
+		parent->RequestUpdate();
 	}
 }
 
@@ -268,6 +302,8 @@ void WidgetTextInput::OnRender()
 // Formats the widget's internal content.
 void WidgetTextInput::OnLayout()
 {
+	// The font or other properties affecting the text may have changed, so format all the lines again.
+	reformat_all_lines = true;
 	FormatElement();
 	parent->SetScrollLeft(scroll_offset.x);
 	parent->SetScrollTop(scroll_offset.y);
@@ -887,7 +923,8 @@ void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 		keyboard_showed = true;
 		
 		cursor_timer = CURSOR_BLINK_TIME;
-		last_update_time = GetSystemInterface()->GetElapsedTime();
+		last_update_time = Clock::GetElapsedTime(parent->GetContext());
+		parent->RequestUpdate();
 
 		// Shift the cursor into view.
 		if (move_to_cursor)
@@ -913,6 +950,7 @@ void WidgetTextInput::ShowCursor(bool show, bool move_to_cursor)
 		cursor_visible = false;
 		cursor_timer = -1;
 		last_update_time = 0;
+		parent->RequestUpdate();
 		if (keyboard_showed)
 		{
 			SetKeyboardActive(false);
@@ -941,6 +979,18 @@ void WidgetTextInput::FormatElement()
 	else
 		scroll->DisableScrollbar(ElementScroll::VERTICAL);
 
+	// If the text has more lines than fit in the element even without any wrapping, we know up front that the vertical
+	// scrollbar is needed. This avoids formatting the text at two different widths.
+	bool vertical_scrollbar_enabled = false;
+	if (y_overflow_property == Overflow::Auto)
+	{
+		if (float(num_endlines + 1) * parent->GetLineHeight() > parent->GetClientHeight())
+		{
+			scroll->EnableScrollbar(ElementScroll::VERTICAL, width);
+			vertical_scrollbar_enabled = true;
+		}
+	}
+
 	// Format the text and determine its total area.
 	Vector2f content_area = FormatText();
 
@@ -952,7 +1002,7 @@ void WidgetTextInput::FormatElement()
 	}
 
 	// Now check for vertical overflow. If we do turn on the scrollbar, this will cause a reflow.
-	if (y_overflow_property == Overflow::Auto)
+	if (y_overflow_property == Overflow::Auto && !vertical_scrollbar_enabled)
 	{
 		if (parent->GetClientHeight() < content_area.y)
 		{
@@ -974,12 +1024,57 @@ void WidgetTextInput::FormatElement()
 // Formats the input element's text field.
 Vector2f WidgetTextInput::FormatText()
 {
+	const int num_previous_lines = (int)lines.size();
+
+	// Break the text into lines, reusing the lines which are unaffected by any changes to the text.
+	const LineRange reflowed = ReflowLines(parent->GetClientWidth() - cursor_size.x);
+
+	// Determine the line-height of the text element.
+	const float line_height = parent->GetLineHeight();
+
+	if (text_lines_match && selection_length == 0 && reflowed.num_removed < num_previous_lines)
+	{
+		// Only the reflowed lines need to be replaced in the text element, the other lines and their geometry are kept.
+		if (reflowed.num_removed > 0 || reflowed.num_added > 0)
+		{
+			Vector< Pair< Vector2f, String > > new_text_lines;
+			new_text_lines.reserve(reflowed.num_added);
+
+			for (int i = reflowed.begin; i < reflowed.begin + reflowed.num_added; i++)
+			{
+				const Line& line = lines[i];
+				const int line_length = (int)line.content.size() - (line.extra_characters < 0 ? 1 : 0);
+				new_text_lines.emplace_back(Vector2f(0, float(i) * line_height), line.content.substr(0, line_length));
+			}
+
+			const Vector2f following_lines_offset(0, float(reflowed.num_added - reflowed.num_removed) * line_height);
+			text_element->ReplaceLines(reflowed.begin, reflowed.begin + reflowed.num_removed, new_text_lines, following_lines_offset);
+		}
+	}
+	else
+	{
+		FormatTextLines(line_height);
+	}
+
+	// The soft return tokens before the cursor are included in the absolute cursor index.
 	absolute_cursor_index = edit_index;
+	int line_begin = 0;
+	for (const Line& line : lines)
+	{
+		line_begin += line.value_length;
+		if (line_begin > edit_index)
+			break;
+		if (line.extra_characters < 0)
+			absolute_cursor_index += 1;
+	}
 
-	Vector2f content_area(0, 0);
+	return Vector2f(widest_line_width + cursor_size.x, float(lines.size()) * line_height);
+}
 
-	// Clear the old lines, and all the lines in the text elements.
-	lines.clear();
+// Places all the lines in the text elements, splitting them around the selection.
+void WidgetTextInput::FormatTextLines(float line_height)
+{
+	// Clear all the lines in the text elements.
 	text_element->ClearLines();
 	selected_text_element->ClearLines();
 
@@ -989,11 +1084,140 @@ Vector2f WidgetTextInput::FormatText()
 	Vector< Vertex >& selection_vertices = selection_geometry.GetVertices();
 	Vector< int >& selection_indices = selection_geometry.GetIndices();
 
-	// Determine the line-height of the text element.
-	float line_height = parent->GetLineHeight();
+	// Return the extra kerning that would result in joining two strings.
+	auto GetKerningBetween = [this](const String& left, const String& right) -> float {
+		if (left.empty() || right.empty())
+			return 0.0f;
+		// We could join the whole string, and compare the result of the joined width to the individual widths of each string. Instead, we just take the
+		// two neighboring characters from each string and compare the string width with and without kerning, which should be much faster.
+		const Character left_back = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&left.back(), &left.front()));
+		const String right_front_u8 = right.substr(0, size_t(StringUtilities::SeekForwardUTF8(right.c_str() + 1, right.c_str() + right.size()) - right.c_str()));
+		const int width_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, left_back);
+		const int width_no_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, Character::Null);
+		return float(width_kerning - width_no_kerning);
+	};
+
+	int line_begin = 0;
+
+	for (int line_index = 0; line_index < (int)lines.size(); line_index++)
+	{
+		const Line& line = lines[line_index];
+		Vector2f line_position(0, float(line_index) * line_height);
+
+		// A soft return is terminated by a '\r' token, which is not placed in the text elements.
+		const bool soft_return = (line.extra_characters < 0);
+		const int line_length = (int)line.content.size() - (soft_return ? 1 : 0);
+
+		// We split the string of characters appearing on the line into three parts; the unselected text appearing
+		// before any selected text on the line, the selected text on the line, and any unselected text after the
+		// selection.
+		String pre_selection, selection, post_selection;
+		GetLineSelection(pre_selection, selection, post_selection, line.content, line_length, line_begin);
+
+		// The pre-selected text is placed, if there is any (if the selection starts on or before
+		// the beginning of this line, then this will be empty). Without a selection, every line is placed so that the
+		// lines of the text element match our lines.
+		if (!pre_selection.empty() || selection_length == 0)
+		{
+			text_element->AddLine(line_position, pre_selection);
+
+			// The width is only needed for placing the selected text after it.
+			if (!selection.empty())
+				line_position.x += ElementUtilities::GetStringWidth(text_element, pre_selection);
+		}
+
+		// If there is any selected text on this line, place it in the selected text element and
+		// generate the geometry for its background.
+		if (!selection.empty())
+		{
+			line_position.x += GetKerningBetween(pre_selection, selection);
+			selected_text_element->AddLine(line_position, selection);
+			const int selection_width = ElementUtilities::GetStringWidth(selected_text_element, selection);
+
+			selection_vertices.resize(selection_vertices.size() + 4);
+			selection_indices.resize(selection_indices.size() + 6);
+			GeometryUtilities::GenerateQuad(&selection_vertices[selection_vertices.size() - 4], &selection_indices[selection_indices.size() - 6], line_position, Vector2f((float)selection_width, line_height), selection_colour, (int)selection_vertices.size() - 4);
+
+			line_position.x += selection_width;
+		}
+
+		// If there is any unselected text after the selection on this line, place it in the
+		// standard text element after the selected text.
+		if (!post_selection.empty())
+		{
+			line_position.x += GetKerningBetween(selection, post_selection);
+			text_element->AddLine(line_position, post_selection);
+		}
+
+		line_begin += line.value_length;
+	}
+
+	text_lines_match = (selection_length == 0 && text_element->GetFontFaceHandle() != 0);
+}
+
+// Breaks the text into lines, reusing the lines which are unaffected by the last change to the text.
+WidgetTextInput::LineRange WidgetTextInput::ReflowLines(float maximum_line_width)
+{
+	const String& text = text_element->GetText();
 
+	// Line breaking inspects the three characters following each line for spaces to append to it as orphans.
+	static constexpr int orphan_lookahead = 3;
+
+	// By default, all lines are replaced.
+	LineRange reflowed = { 0, (int)lines.size(), 0 };
+	bool reuse_lines = false;
 	int line_begin = 0;
-	Vector2f line_position(0, 0);
+
+	if (reformat_all_lines || lines.empty() || maximum_line_width != formatted_line_width)
+	{
+		widest_line_width = 0;
+	}
+	else if (changed_begin_index < 0)
+	{
+		// The text is unchanged, and so are the lines.
+		return LineRange{ 0, 0, 0 };
+	}
+	else
+	{
+		// A change can affect the line containing the first character whose orphan lookahead reaches the change.
+		// Furthermore, removing characters may allow the first word of that line to move up onto the previous line.
+		// Thus, we start reflowing from the line before it.
+		const int reflow_index = changed_begin_index - orphan_lookahead;
+
+		int first_line = 0;
+		int prior_line_begin = 0;
+		while (first_line + 1 < (int)lines.size() && line_begin + lines[first_line].value_length <= reflow_index)
+		{
+			prior_line_begin = line_begin;
+			line_begin += lines[first_line].value_length;
+			first_line += 1;
+		}
+
+		if (first_line > 0)
+		{
+			first_line -= 1;
+			line_begin = prior_line_begin;
+		}
+
+		reflowed.begin = first_line;
+		reflowed.num_removed = (int)lines.size() - first_line;
+		reuse_lines = true;
+	}
+
+	const int changed_end = changed_end_index;
+	const int length_delta = changed_length_delta;
+
+	formatted_line_width = maximum_line_width;
+	reformat_all_lines = false;
+	changed_begin_index = -1;
+	changed_end_index = -1;
+	changed_length_delta = 0;
+
+	// The index and beginning of the previous line we are trying to line up with the new lines.
+	int previous_index = reflowed.begin;
+	int previous_line_begin = line_begin;
+
+	LineList new_lines;
 	bool last_line = false;
 
 	// Keep generating lines until all the text content is placed.
@@ -1004,7 +1228,7 @@ Vector2f WidgetTextInput::FormatText()
 		float line_width;
 
 		// Generate the next line.
-		last_line = text_element->GenerateLine(line.content, line.content_length, line_width, line_begin, parent->GetClientWidth() - cursor_size.x, 0, false, false);
+		last_line = text_element->GenerateLine(line.content, line.content_length, line_width, line_begin, maximum_line_width, 0, false, false);
 
 		// If this line terminates in a soft-return, then the line may be leaving a space or two behind as an orphan.
 		// If so, we must append the orphan onto the line even though it will push the line outside of the input
@@ -1016,7 +1240,6 @@ Vector2f WidgetTextInput::FormatText()
 		{
 			soft_return = true;
 
-			const String& text = text_element->GetText();
 			String orphan;
 			for (int i = 1; i >= 0; --i)
 			{
@@ -1045,76 +1268,15 @@ Vector2f WidgetTextInput::FormatText()
 			}
 		}
 
-
-		// Now that we have the string of characters appearing on the new line, we split it into
-		// three parts; the unselected text appearing before any selected text on the line, the
-		// selected text on the line, and any unselected text after the selection.
-		String pre_selection, selection, post_selection;
-		GetLineSelection(pre_selection, selection, post_selection, line.content, line_begin);
-
-		// The pre-selected text is placed, if there is any (if the selection starts on or before
-		// the beginning of this line, then this will be empty).
-		if (!pre_selection.empty())
-		{
-			text_element->AddLine(line_position, pre_selection);
-			line_position.x += ElementUtilities::GetStringWidth(text_element, pre_selection);
-		}
-
-		// Return the extra kerning that would result in joining two strings.
-		auto GetKerningBetween = [this](const String& left, const String& right) -> float {
-			if (left.empty() || right.empty())
-				return 0.0f;
-			// We could join the whole string, and compare the result of the joined width to the individual widths of each string. Instead, we just take the
-			// two neighboring characters from each string and compare the string width with and without kerning, which should be much faster.
-			const Character left_back = StringUtilities::ToCharacter(StringUtilities::SeekBackwardUTF8(&left.back(), &left.front()));
-			const String right_front_u8 = right.substr(0, size_t(StringUtilities::SeekForwardUTF8(right.c_str() + 1, right.c_str() + right.size()) - right.c_str()));
-			const int width_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, left_back);
-			const int width_no_kerning = ElementUtilities::GetStringWidth(text_element, right_front_u8, Character::Null);
-			return float(width_kerning - width_no_kerning);
-		};
-
-		// If there is any selected text on this line, place it in the selected text element and
-		// generate the geometry for its background.
-		if (!selection.empty())
-		{
-			line_position.x += GetKerningBetween(pre_selection, selection);
-			selected_text_element->AddLine(line_position, selection);
-			const int selection_width = ElementUtilities::GetStringWidth(selected_text_element, selection);
-
-			selection_vertices.resize(selection_vertices.size() + 4);
-			selection_indices.resize(selection_indices.size() + 6);
-			GeometryUtilities::GenerateQuad(&selection_vertices[selection_vertices.size() - 4], &selection_indices[selection_indices.size() - 6], line_position, Vector2f((float)selection_width, line_height), selection_colour, (int)selection_vertices.size() - 4);
-
-			line_position.x += selection_width;
-		}
-
-		// If there is any unselected text after the selection on this line, place it in the
-		// standard text element after the selected text.
-		if (!post_selection.empty())
-		{
-			line_position.x += GetKerningBetween(selection, post_selection);
-			text_element->AddLine(line_position, post_selection);
-		}
-
-
-		// Update variables for the next line.
-		line_begin += line.content_length;
-		line_position.x = 0;
-		line_position.y += line_height;
-
-		// Grow the content area width-wise if this line is the longest so far, and push the
-		// height out.
-		content_area.x = Math::Max(content_area.x, line_width + cursor_size.x);
-		content_area.y = line_position.y;
+		line.value_length = line.content_length;
+		line.width = line_width;
+		line_begin += line.value_length;
 
 		// Push a trailing '\r' token onto the back to indicate a soft return if necessary.
 		if (soft_return)
 		{
 			line.content += '\r';
 			line.extra_characters -= 1;
-
-			if (edit_index >= line_begin)
-				absolute_cursor_index += 1;
 		}
 
 		// Push the new line into our array of lines, but first check if its content length needs to be truncated to
@@ -1122,11 +1284,54 @@ Vector2f WidgetTextInput::FormatText()
 		if (!line.content.empty() &&
 			line.content[line.content.size() - 1] == '\n')
 			line.content_length -= 1;
-		lines.push_back(line);
+		new_lines.push_back(std::move(line));
+
+		// Once we are past the changed part of the text, the remaining lines are unchanged if a previous line begins
+		// at the same place in the text.
+		if (!last_line && reuse_lines && line_begin >= changed_end)
+		{
+			const int previous_target_begin = line_begin - length_delta;
+			while (previous_index < (int)lines.size() && previous_line_begin < previous_target_begin)
+			{
+				previous_line_begin += lines[previous_index].value_length;
+				previous_index += 1;
+			}
+
+			if (previous_index < (int)lines.size() && previous_line_begin == previous_target_begin)
+			{
+				reflowed.num_removed = previous_index - reflowed.begin;
+				break;
+			}
+		}
 	}
 	while (!last_line);
 
-	return content_area;
+	reflowed.num_added = (int)new_lines.size();
+
+	// The widest line only needs to be found again if it may have been removed.
+	const auto removed_begin = lines.begin() + reflowed.begin;
+	const auto removed_end = removed_begin + reflowed.num_removed;
+	if (std::any_of(removed_begin, removed_end, [this](const Line& line) { return line.width >= widest_line_width; }))
+	{
+		widest_line_width = 0;
+		for (auto it = lines.begin(); it != lines.end(); ++it)
+		{
+			if (it < removed_begin || it >= removed_end)
+				widest_line_width = Math::Max(widest_line_width, it->width);
+		}
+	}
+	for (const Line& line : new_lines)
+		widest_line_width = Math::Max(widest_line_width, line.width);
+
+	// Replace the removed lines with the new ones.
+	const int num_moved = Math::Min(reflowed.num_removed, reflowed.num_added);
+	std::move(new_lines.begin(), new_lines.begin() + num_moved, removed_begin);
+	if (reflowed.num_added < reflowed.num_removed)
+		lines.erase(removed_begin + num_moved, removed_end);
+	else
+		lines.insert(removed_begin + num_moved, std::make_move_iterator(new_lines.begin() + num_moved), std::make_move_iterator(new_lines.end()));
+
+	return reflowed;
 }
 
 // Generates the text cursor.
@@ -1214,10 +1419,10 @@ void WidgetTextInput::DeleteSelection()
 {
 	if (selection_length > 0)
 	{
-		const String& value = GetElement()->GetAttribute< String >("value", "");
+		String value = GetElement()->GetAttribute< String >("value", "");
 
-		String new_value = value.substr(0, selection_begin_index) + value.substr(std::min(size_t(selection_begin_index + selection_length), size_t(value.size())));
-		GetElement()->SetAttribute("value", new_value);
+		value.erase(std::min(size_t(selection_begin_index), value.size()), size_t(selection_length));
+		GetElement()->SetAttribute("value", value);
 
 		// Move the cursor to the beginning of the old selection.
 		absolute_cursor_index = selection_begin_index;
@@ -1229,24 +1434,26 @@ void WidgetTextInput::DeleteSelection()
 }
 
 // Split one line of text into three parts, based on the current selection.
-void WidgetTextInput::GetLineSelection(String& pre_selection, String& selection, String& post_selection, const String& line, int line_begin)
+void WidgetTextInput::GetLineSelection(String& pre_selection, String& selection, String& post_selection, const String& line, int line_length, int line_begin)
 {
 	// Check if we have any selection at all, and if so if the selection is on this line.
 	if (selection_length <= 0 ||
 		selection_begin_index + selection_length < line_begin ||
-		selection_begin_index > line_begin + (int) line.size())
+		selection_begin_index > line_begin + line_length)
 	{
-		pre_selection = line;
+		pre_selection = line.substr(0, line_length);
 		return;
 	}
 
-	int line_length = (int)line.size();
 	using namespace Math;
 
 	// Split the line up into its three parts, depending on the size and placement of the selection.
-	pre_selection = line.substr(0, Max(0, selection_begin_index - line_begin));
-	selection = line.substr(Clamp(selection_begin_index - line_begin, 0, line_length), Max(0, selection_length + Min(0, selection_begin_index - line_begin)));
-	post_selection = line.substr(Clamp(selection_begin_index + selection_length - line_begin, 0, line_length));
+	const int selection_begin = Clamp(selection_begin_index - line_begin, 0, line_length);
+	const int selection_end = Clamp(selection_begin_index + selection_length - line_begin, 0, line_length);
+
+	pre_selection = line.substr(0, selection_begin);
+	selection = line.substr(selection_begin, selection_end - selection_begin);
+	post_selection = line.substr(selection_end, line_length - selection_end);
 }
 
 void WidgetTextInput::SetKeyboardActive(bool active)
@@ -155,6 +155,22 @@ private:
 	/// Formats the input element's text field.
 	/// @return The content area of the element.
 	Vector2f FormatText();
+	/// Places all the lines in the text elements, splitting them around the selection.
+	/// @param[in] line_height The height of each line.
+	void FormatTextLines(float line_height);
+
+	// A range of lines replaced by new lines.
+	struct LineRange
+	{
+		int begin;
+		int num_removed;
+		int num_added;
+	};
+
+	/// Breaks the text into lines, only lines affected by the last change to the text are regenerated.
+	/// @param[in] maximum_line_width The width (in pixels) of space allowed for each line.
+	/// @return The range of lines which were replaced, the lines before and after it are unchanged.
+	LineRange ReflowLines(float maximum_line_width);
 
 	/// Updates the position to render the cursor.
 	void UpdateCursorPosition();
@@ -174,8 +190,9 @@ private:
 	/// @param[out] selection The section of selected text on the line.
 	/// @param[out] post_selection The section of unselected text after any selected text on the line. If there is no selection on the line, then this will be empty.
 	/// @param[in] line The text making up the line.
+	/// @param[in] line_length The number of characters of the line to split.
 	/// @param[in] line_begin The absolute index at the beginning of the line.
-	void GetLineSelection(String& pre_selection, String& selection, String& post_selection, const String& line, int line_begin);
+	void GetLineSelection(String& pre_selection, String& selection, String& post_selection, const String& line, int line_length, int line_begin);
 
 	struct Line
 	{
@@ -187,6 +204,11 @@ private:
 		// The number of extra characters at the end of the content that are not present in the actual value; in the
 		// case of a soft return, this may be negative.
 		int extra_characters;
+
+		// The number of characters of the value making up the line (including the trailing endline).
+		int value_length;
+		// The width (in pixels) of the line.
+		float width;
 	};
 
 	ElementFormControl* parent;
@@ -199,6 +221,22 @@ private:
 	typedef Vector< Line > LineList;
 	LineList lines;
 
+	// The range of the value which has changed since the lines were last formatted, in bytes of the new value, and the
+	// change in its length. A negative begin index means the value is unchanged.
+	int changed_begin_index;
+	int changed_end_index;
+	int changed_length_delta;
+	// If set, all lines need to be reformatted, such as after the size or the font of the element changes.
+	bool reformat_all_lines;
+	// The maximum line width the lines were formatted for.
+	float formatted_line_width;
+	// The width of the widest line.
+	float widest_line_width;
+	// True if each line is placed as a single line in the text element, then only lines which have changed need to be replaced there.
+	bool text_lines_match;
+	// The number of endlines in the value.
+	int num_endlines;
+
 	// Length in number of characters.
 	int max_length;
 
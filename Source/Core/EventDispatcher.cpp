@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/EventListener.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "EventSpecification.h"
+#include "FrameStatisticsRecorder.h"
 #include <algorithm>
 #include <limits>
 
@@ -131,6 +132,9 @@ bool EventDispatcher::DispatchEvent(Element* target_element, const EventId id, c
 {
 	RMLUI_ASSERTMSG(!((int)default_action_phase & (int)EventPhase::Capture), "We assume here that the default action phases cannot include capture phase.");
 
+	if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+		recorder->GetStatistics().events_dispatched += 1;
+
 	Vector<CollectedListener> listeners;
 	Vector<ObserverPtr<Element>> default_action_elements;
 
@@ -28,16 +28,22 @@
 
 #include "EventSpecification.h"
 #include "../../Include/RmlUi/Core/ID.h"
+#include <deque>
+#include <mutex>
 
 
 namespace Rml {
 
-// An EventId is an index into the specifications vector.
-static Vector<EventSpecification> specifications = { { EventId::Invalid, "invalid", false, false, DefaultActionPhase::None } };
+// An EventId is an index into the specifications list. A deque is used so that references to existing specifications
+// remain valid when new event types are inserted.
+static std::deque<EventSpecification> specifications = { { EventId::Invalid, "invalid", false, false, DefaultActionPhase::None } };
 
 // Reverse lookup map from event type to id.
 static UnorderedMap<String, EventId> type_lookup;
 
+// Guards the specifications, custom event types may be inserted by contexts on different threads.
+static std::recursive_mutex specifications_mutex;
+
 
 namespace EventSpecificationInterface {
 
@@ -138,11 +144,13 @@ static EventSpecification& GetOrInsert(const String& event_type, bool interrupti
 
 const EventSpecification& Get(EventId id)
 {
+	std::lock_guard<std::recursive_mutex> lock(specifications_mutex);
 	return GetMutable(id);
 }
 
 const EventSpecification& GetOrInsert(const String& event_type)
 {
+	std::lock_guard<std::recursive_mutex> lock(specifications_mutex);
 	// Default values for new event types defined as follows:
 	constexpr bool interruptible = true;
 	constexpr bool bubbles = true;
@@ -153,6 +161,7 @@ const EventSpecification& GetOrInsert(const String& event_type)
 
 EventId GetIdOrInsert(const String& event_type)
 {
+	std::lock_guard<std::recursive_mutex> lock(specifications_mutex);
 	auto it = type_lookup.find(event_type);
 	if (it != type_lookup.end())
 		return it->second;
@@ -162,6 +171,7 @@ EventId GetIdOrInsert(const String& event_type)
 
 EventId InsertOrReplaceCustom(const String& event_type, bool interruptible, bool bubbles, DefaultActionPhase default_action_phase)
 {
+	std::lock_guard<std::recursive_mutex> lock(specifications_mutex);
 	const size_t size_before = specifications.size();
 	EventSpecification& specification = GetOrInsert(event_type, interruptible, bubbles, default_action_phase);
 	bool got_existing_entry = (size_before == specifications.size());
@@ -93,4 +93,21 @@ FontFaceHandleDefault* FontFace::GetHandle(int size) {
 }
 
 
+void FontFace::GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases)
+{
+	const size_t first_atlas = atlases.size();
+
+	for (auto& pair : handles)
+	{
+		if (pair.second)
+			pair.second->GetFontAtlases(atlases);
+	}
+
+	for (size_t i = first_atlas; i < atlases.size(); i++)
+	{
+		atlases[i].style = style;
+		atlases[i].weight = weight;
+	}
+}
+
 } // namespace Rml
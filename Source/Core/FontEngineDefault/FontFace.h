@@ -30,6 +30,7 @@
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFACE_H
 
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -40,7 +41,7 @@ class FontFaceHandleDefault;
 	@author Peter Curry
  */
 
-class FontFace
+class FontFace : public Allocated<MemoryCategory::Font>
 {
 public:
 	FontFace(FontFaceHandleFreetype face, Style::FontStyle style, Style::FontWeight weight, bool release_stream);
@@ -54,6 +55,9 @@ public:
 	/// @return The font handle.
 	FontFaceHandleDefault* GetHandle(int size);
 
+	/// Adds the texture atlases of every handle to the list, the family of each atlas is not filled in.
+	void GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases);
+
 private:
 	Style::FontStyle style;
 	Style::FontWeight weight;
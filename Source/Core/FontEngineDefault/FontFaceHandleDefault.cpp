@@ -109,6 +109,21 @@ float FontFaceHandleDefault::GetUnderline(float& thickness) const
 	return metrics.underline_position;
 }
 
+void FontFaceHandleDefault::GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases)
+{
+	for (size_t i = 0; i < layers.size(); ++i)
+	{
+		FontFaceLayer* layer = layers[i].layer.get();
+
+		MemoryStatistics::FontAtlas atlas;
+		atlas.size = GetSize();
+		atlas.layer = (int)i;
+		atlas.num_textures = layer->GetNumTextures();
+		atlas.bytes = layer->GetTextureSize();
+		atlases.push_back(std::move(atlas));
+	}
+}
+
 // Returns the width a string will take up if rendered with this handle.
 int FontFaceHandleDefault::GetStringWidth(const String& string, Character prior_character)
 {
@@ -200,6 +215,9 @@ int FontFaceHandleDefault::GenerateLayerConfiguration(const FontEffectList& font
 // Generates the texture data for a layer (for the texture database).
 bool FontFaceHandleDefault::GenerateLayerTexture(UniquePtr<const byte[]>& texture_data, Vector2i& texture_dimensions, const FontEffect* font_effect, int texture_id, int handle_version) const
 {
+	// Called from the texture database when the texture is first rendered, possibly from another context's thread.
+	std::lock_guard<std::recursive_mutex> lock(FontProvider::GetMutex());
+
 	if (handle_version != version)
 	{
 		RMLUI_ERRORMSG("While generating font layer texture: Handle version mismatch in texture vs font-face.");
@@ -33,6 +33,7 @@
 #include "../../../Include/RmlUi/Core/FontEffect.h"
 #include "../../../Include/RmlUi/Core/FontGlyph.h"
 #include "../../../Include/RmlUi/Core/Geometry.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "../../../Include/RmlUi/Core/Texture.h"
 #include "FontTypes.h"
 
@@ -45,7 +46,7 @@ class FontFaceLayer;
 	@author Peter Curry
  */
 
-class FontFaceHandleDefault final : public NonCopyMoveable
+class FontFaceHandleDefault final : public NonCopyMoveable, public Allocated<MemoryCategory::Font>
 {
 public:
 	FontFaceHandleDefault();
@@ -69,6 +70,9 @@ public:
 	/// Returns the font's glyphs.
 	const FontGlyphMap& GetGlyphs() const;
 
+	/// Adds the texture atlas of each layer to the list, only the size and layer of each atlas is filled in.
+	void GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases);
+
 	/// Returns the width a string will take up if rendered with this handle.
 	/// @param[in] string The string to measure.
 	/// @param[in] prior_character The optionally-specified character that immediately precedes the string. This may have an impact on the string width due to kerning.
@@ -28,6 +28,8 @@
 
 #include "FontFaceLayer.h"
 #include "FontFaceHandleDefault.h"
+#include "../../../Include/RmlUi/Core/Core.h"
+#include "../../../Include/RmlUi/Core/TaskInterface.h"
 
 namespace Rml {
 
@@ -184,46 +186,55 @@ bool FontFaceLayer::GenerateTexture(UniquePtr<const byte[]>& texture_data, Vecto
 	texture_data = texture_layout.GetTexture(texture_id).AllocateTexture();
 	texture_dimensions = texture_layout.GetTexture(texture_id).GetDimensions();
 
-	for (int i = 0; i < texture_layout.GetNumRectangles(); ++i)
-	{
-		TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
-		Character character = (Character)rectangle.GetId();
-		RMLUI_ASSERT(character_boxes.find(character) != character_boxes.end());
+	// Each glyph is written to its own rectangle of the texture, so the glyphs can be rasterized in parallel.
+	constexpr int glyphs_per_task = 32;
 
-		TextureBox& box = character_boxes[character];
+	GetTaskInterface()->ParallelFor(0, texture_layout.GetNumRectangles(), glyphs_per_task, [&](int begin, int end) {
+		for (int i = begin; i < end; ++i)
+		{
+			TextureLayoutRectangle& rectangle = texture_layout.GetRectangle(i);
+			const Character character = (Character)rectangle.GetId();
 
-		if (box.texture_index != texture_id)
-			continue;
+			auto it_box = character_boxes.find(character);
+			RMLUI_ASSERT(it_box != character_boxes.end());
+			if (it_box == character_boxes.end())
+				continue;
 
-		auto it = glyphs.find((Character)rectangle.GetId());
-		if (it == glyphs.end())
-			continue;
+			const TextureBox& box = it_box->second;
 
-		const FontGlyph& glyph = it->second;
+			if (box.texture_index != texture_id)
+				continue;
 
-		if (effect == nullptr)
-		{
-			// Copy the glyph's bitmap data into its allocated texture.
-			if (glyph.bitmap_data)
-			{
-				byte* destination = rectangle.GetTextureData();
-				const byte* source = glyph.bitmap_data;
+			auto it = glyphs.find(character);
+			if (it == glyphs.end())
+				continue;
 
-				for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+			const FontGlyph& glyph = it->second;
+
+			if (effect == nullptr)
+			{
+				// Copy the glyph's bitmap data into its allocated texture.
+				if (glyph.bitmap_data)
 				{
-					for (int k = 0; k < glyph.bitmap_dimensions.x; ++k)
-						destination[k * 4 + 3] = source[k];
+					byte* destination = rectangle.GetTextureData();
+					const byte* source = glyph.bitmap_data;
 
-					destination += rectangle.GetTextureStride();
-					source += glyph.bitmap_dimensions.x;
+					for (int j = 0; j < glyph.bitmap_dimensions.y; ++j)
+					{
+						for (int k = 0; k < glyph.bitmap_dimensions.x; ++k)
+							destination[k * 4 + 3] = source[k];
+
+						destination += rectangle.GetTextureStride();
+						source += glyph.bitmap_dimensions.x;
+					}
 				}
 			}
+			else
+			{
+				effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y)), rectangle.GetTextureStride(), glyph);
+			}
 		}
-		else
-		{
-			effect->GenerateGlyphTexture(rectangle.GetTextureData(), Vector2i(Math::RealToInteger(box.dimensions.x), Math::RealToInteger(box.dimensions.y)), rectangle.GetTextureStride(), glyph);
-		}
-	}
+	});
 
 	return true;
 }
@@ -249,6 +260,17 @@ int FontFaceLayer::GetNumTextures() const
 	return (int)textures.size();
 }
 
+size_t FontFaceLayer::GetTextureSize()
+{
+	size_t size = 0;
+	for (int i = 0; i < texture_layout.GetNumTextures(); ++i)
+	{
+		const Vector2i dimensions = texture_layout.GetTexture(i).GetDimensions();
+		size += size_t(dimensions.x) * size_t(dimensions.y) * 4;
+	}
+	return size;
+}
+
 // Returns the layer's colour.
 Colourb FontFaceLayer::GetColour() const
 {
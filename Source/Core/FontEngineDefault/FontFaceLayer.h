@@ -47,7 +47,7 @@ class FontFaceHandleDefault;
 	@author Peter Curry
  */
 
-class FontFaceLayer
+class FontFaceLayer : public Allocated<MemoryCategory::Font>
 {
 public:
 	FontFaceLayer(const SharedPtr<const FontEffect>& _effect);
@@ -108,6 +108,8 @@ public:
 	const Texture* GetTexture(int index);
 	/// Returns the number of textures employed by this layer.
 	int GetNumTextures() const;
+	/// Returns the number of bytes used by the texture data of this layer.
+	size_t GetTextureSize();
 
 	/// Returns the layer's colour.
 	Colourb GetColour() const;
@@ -71,4 +71,15 @@ FontFace* FontFamily::AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle s
 	return result;
 }
 
+void FontFamily::GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases)
+{
+	const size_t first_atlas = atlases.size();
+
+	for (auto& face : font_faces)
+		face->GetFontAtlases(atlases);
+
+	for (size_t i = first_atlas; i < atlases.size(); i++)
+		atlases[i].family = name;
+}
+
 } // namespace Rml
@@ -29,6 +29,7 @@
 #ifndef RMLUI_CORE_FONTENGINEDEFAULT_FONTFAMILY_H
 #define RMLUI_CORE_FONTENGINEDEFAULT_FONTFAMILY_H
 
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "FontTypes.h"
 
 namespace Rml {
@@ -40,7 +41,7 @@ class FontFaceHandleDefault;
 	@author Peter Curry
  */
 
-class FontFamily
+class FontFamily : public Allocated<MemoryCategory::Font>
 {
 public:
 	FontFamily(const String& name);
@@ -61,6 +62,9 @@ public:
 	/// @return True if the face was loaded successfully, false otherwise.
 	FontFace* AddFace(FontFaceHandleFreetype ft_face, Style::FontStyle style, Style::FontWeight weight, bool release_stream);
 
+	/// Adds the texture atlases of every face to the list.
+	void GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases);
+
 protected:
 	String name;
 
@@ -30,6 +30,7 @@
 #include "FontFace.h"
 #include "FontFamily.h"
 #include "FreeTypeInterface.h"
+#include "../MemoryUsage.h"
 #include "../../../Include/RmlUi/Core/Core.h"
 #include "../../../Include/RmlUi/Core/FileInterface.h"
 #include "../../../Include/RmlUi/Core/Log.h"
@@ -102,6 +103,28 @@ FontFaceHandleDefault* FontProvider::GetFallbackFontFace(int index, int font_siz
 }
 
 
+void FontProvider::GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases)
+{
+	if (!g_font_provider)
+		return;
+
+	std::lock_guard<std::recursive_mutex> lock(GetMutex());
+
+	for (auto& pair : g_font_provider->font_families)
+		pair.second->GetFontAtlases(atlases);
+}
+
+std::recursive_mutex& FontProvider::GetMutex()
+{
+	static std::recursive_mutex mutex;
+	return mutex;
+}
+
+void MemoryUsage::AddFontAtlases(MemoryStatistics& statistics)
+{
+	FontProvider::GetFontAtlases(statistics.font_atlases);
+}
+
 bool FontProvider::LoadFontFace(const String& file_name, bool fallback_face)
 {
 	FileInterface* file_interface = GetFileInterface();
@@ -31,7 +31,9 @@
 
 #include "../../../Include/RmlUi/Core/Types.h"
 #include "../../../Include/RmlUi/Core/ComputedValues.h"
+#include "../../../Include/RmlUi/Core/MemoryStatistics.h"
 #include "FontTypes.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -72,6 +74,13 @@ public:
 	/// Return a font face handle with the given index, at the given font size.
 	static FontFaceHandleDefault* GetFallbackFontFace(int index, int font_size);
 
+	/// Adds the texture atlases of every generated font face handle to the list.
+	static void GetFontAtlases(Vector<MemoryStatistics::FontAtlas>& atlases);
+
+	/// Returns the mutex guarding the font families and their generated font face handles. Glyphs and layers are
+	/// generated lazily, thus this lock must be held whenever a handle is used by contexts on different threads.
+	static std::recursive_mutex& GetMutex();
+
 private:
 	FontProvider();
 	~FontProvider();
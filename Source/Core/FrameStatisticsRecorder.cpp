@@ -0,0 +1,199 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "FrameStatisticsRecorder.h"
+#include "../../Include/RmlUi/Core/Element.h"
+#include "Clock.h"
+
+namespace Rml {
+
+static thread_local FrameStatisticsRecorder* active_recorder = nullptr;
+static ScriptHandlerStatisticsFunction script_handler_statistics_function;
+
+FrameStatisticsRecorder* FrameStatisticsRecorder::GetActive()
+{
+	return active_recorder;
+}
+
+FrameStatistics& FrameStatisticsRecorder::GetStatistics()
+{
+	return statistics;
+}
+
+void FrameStatisticsRecorder::EndFrame()
+{
+	frame_statistics = statistics;
+	statistics = FrameStatistics();
+	texture = Texture();
+
+	if (element_statistics_enabled)
+	{
+		frame_element_statistics.swap(element_statistics);
+		element_statistics.clear();
+		element_statistics_index.clear();
+	}
+}
+
+const FrameStatistics& FrameStatisticsRecorder::GetFrameStatistics() const
+{
+	return frame_statistics;
+}
+
+void FrameStatisticsRecorder::RecordDrawCall(int num_vertices, const Texture* draw_texture)
+{
+	statistics.draw_calls += 1;
+	statistics.vertices += num_vertices;
+
+	if (!draw_texture || !*draw_texture)
+	{
+		texture = Texture();
+	}
+	else if (!(*draw_texture == texture))
+	{
+		statistics.texture_binds += 1;
+		texture = *draw_texture;
+	}
+}
+
+void FrameStatisticsRecorder::SetElementStatisticsEnabled(bool enable)
+{
+	element_statistics_enabled = enable;
+	if (!enable)
+	{
+		element_statistics.clear();
+		frame_element_statistics.clear();
+		element_statistics_index.clear();
+	}
+}
+
+const ElementStatisticsList& FrameStatisticsRecorder::GetElementStatistics() const
+{
+	return frame_element_statistics;
+}
+
+void FrameStatisticsRecorder::RecordElementFlags(Element* element, int flags)
+{
+	if (!element_statistics_enabled)
+		return;
+
+	if (!element)
+		element = timed_element;
+
+	if (element)
+		GetElementEntry(element).flags |= flags;
+}
+
+ElementStatistics& FrameStatisticsRecorder::GetElementEntry(Element* element)
+{
+	auto it = element_statistics_index.find(element);
+	if (it != element_statistics_index.end())
+	{
+		// The address may have been reused by a new element after the previous one was destroyed during the frame.
+		ElementStatistics& entry = element_statistics[it->second];
+		if (!(entry.element == element))
+		{
+			entry = ElementStatistics();
+			entry.element = element->GetObserverPtr();
+		}
+		return entry;
+	}
+
+	element_statistics_index.emplace(element, element_statistics.size());
+	element_statistics.emplace_back();
+	ElementStatistics& entry = element_statistics.back();
+	entry.element = element->GetObserverPtr();
+	return entry;
+}
+
+void RecordScriptTime(double time)
+{
+	if (active_recorder)
+	{
+		FrameStatistics& statistics = active_recorder->GetStatistics();
+		statistics.script_time += time;
+		statistics.script_calls += 1;
+	}
+}
+
+void SetScriptHandlerStatisticsFunction(ScriptHandlerStatisticsFunction function)
+{
+	script_handler_statistics_function = std::move(function);
+}
+
+ScriptHandlerStatisticsList GetScriptHandlerStatistics()
+{
+	if (!script_handler_statistics_function)
+		return ScriptHandlerStatisticsList();
+	return script_handler_statistics_function();
+}
+
+FrameStatisticsScope::FrameStatisticsScope(FrameStatisticsRecorder* recorder) : previous_recorder(active_recorder)
+{
+	active_recorder = recorder;
+}
+
+FrameStatisticsScope::~FrameStatisticsScope()
+{
+	active_recorder = previous_recorder;
+}
+
+FrameStatisticsTimer::FrameStatisticsTimer(double FrameStatistics::* time) : recorder(active_recorder), time(time)
+{
+	if (recorder)
+		start_time = Clock::GetSteadyTime();
+}
+
+FrameStatisticsTimer::~FrameStatisticsTimer()
+{
+	if (recorder)
+		recorder->GetStatistics().*time += Clock::GetSteadyTime() - start_time;
+}
+
+ElementStatisticsTimer::ElementStatisticsTimer(Element* element, double ElementStatistics::* time) : element(element), time(time)
+{
+	if (active_recorder && active_recorder->element_statistics_enabled)
+	{
+		recorder = active_recorder;
+		previous_timed_element = std::exchange(recorder->timed_element, element);
+		previous_nested_time = std::exchange(recorder->nested_time, 0.0);
+		start_time = Clock::GetSteadyTime();
+	}
+}
+
+ElementStatisticsTimer::~ElementStatisticsTimer()
+{
+	if (recorder)
+	{
+		const double elapsed_time = Clock::GetSteadyTime() - start_time;
+		recorder->GetElementEntry(element).*time += elapsed_time - recorder->nested_time;
+		recorder->timed_element = previous_timed_element;
+		recorder->nested_time = previous_nested_time + elapsed_time;
+	}
+}
+
+} // namespace Rml
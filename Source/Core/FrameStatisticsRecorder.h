@@ -0,0 +1,144 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_FRAMESTATISTICSRECORDER_H
+#define RMLUI_CORE_FRAMESTATISTICSRECORDER_H
+
+#include "../../Include/RmlUi/Core/FrameStatistics.h"
+#include "../../Include/RmlUi/Core/Texture.h"
+
+namespace Rml {
+
+/**
+	Records the frame statistics of a context while the context is updating, rendering or processing input.
+
+	The recorder of the context currently doing work on this thread is made active by a FrameStatisticsScope, so that
+	the counts can be added from anywhere in the library.
+ */
+
+class FrameStatisticsRecorder
+{
+public:
+	/// Returns the recorder active on this thread, or nullptr if no context is currently doing work.
+	static FrameStatisticsRecorder* GetActive();
+
+	/// Returns the statistics of the frame currently being recorded.
+	FrameStatistics& GetStatistics();
+	/// Ends the current frame, its statistics are then available from GetFrameStatistics().
+	void EndFrame();
+	/// Returns the statistics of the most recently ended frame.
+	const FrameStatistics& GetFrameStatistics() const;
+
+	/// Records a draw call of the given number of vertices and texture.
+	void RecordDrawCall(int num_vertices, const Texture* texture);
+
+	/// Enables or disables recording of per-element statistics.
+	void SetElementStatisticsEnabled(bool enable);
+	/// Returns true if per-element statistics are recorded.
+	bool IsElementStatisticsEnabled() const { return element_statistics_enabled; }
+	/// Returns the per-element statistics of the most recently ended frame.
+	const ElementStatisticsList& GetElementStatistics() const;
+
+	/// Adds the given flags to the element's statistics, does nothing unless per-element statistics are enabled.
+	/// @param[in] element The element, or nullptr to use the element currently being updated or rendered.
+	void RecordElementFlags(Element* element, int flags);
+
+private:
+	friend class ElementStatisticsTimer;
+
+	// Returns the statistics entry of the given element in the current frame, creating it if necessary.
+	ElementStatistics& GetElementEntry(Element* element);
+
+	FrameStatistics statistics;
+	FrameStatistics frame_statistics;
+
+	bool element_statistics_enabled = false;
+	ElementStatisticsList element_statistics;
+	ElementStatisticsList frame_element_statistics;
+	UnorderedMap<Element*, size_t> element_statistics_index;
+
+	// The innermost element being timed, and the time spent in nested timers of that element.
+	Element* timed_element = nullptr;
+	double nested_time = 0;
+
+	// The texture of the previous draw call, for counting texture binds.
+	Texture texture;
+};
+
+/**
+	Makes the given recorder active on this thread for the lifetime of the scope.
+ */
+
+class FrameStatisticsScope
+{
+public:
+	FrameStatisticsScope(FrameStatisticsRecorder* recorder);
+	~FrameStatisticsScope();
+
+private:
+	FrameStatisticsRecorder* previous_recorder;
+};
+
+/**
+	Adds the time elapsed during the lifetime of the timer to the given time in the active recorder, if any.
+ */
+
+class FrameStatisticsTimer
+{
+public:
+	FrameStatisticsTimer(double FrameStatistics::* time);
+	~FrameStatisticsTimer();
+
+private:
+	FrameStatisticsRecorder* recorder;
+	double FrameStatistics::* time;
+	double start_time = 0;
+};
+
+/**
+	Adds the time elapsed during the lifetime of the timer, excluding nested element timers, to the given time of the
+	element's statistics in the active recorder. Does nothing unless per-element statistics are enabled.
+ */
+
+class ElementStatisticsTimer
+{
+public:
+	ElementStatisticsTimer(Element* element, double ElementStatistics::* time);
+	~ElementStatisticsTimer();
+
+private:
+	FrameStatisticsRecorder* recorder = nullptr;
+	Element* element;
+	double ElementStatistics::* time;
+	double start_time = 0;
+	Element* previous_timed_element = nullptr;
+	double previous_nested_time = 0;
+};
+
+} // namespace Rml
+#endif
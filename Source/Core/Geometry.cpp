@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/RenderInterface.h"
+#include "FrameStatisticsRecorder.h"
 #include "GeometryDatabase.h"
 #include <utility>
 
@@ -105,11 +106,16 @@ void Geometry::Render(Vector2f translation)
 
 	translation = translation.Round();
 
+	FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive();
+
 	// Render our compiled geometry if possible.
 	if (compiled_geometry)
 	{
 		RMLUI_ZoneScopedN("RenderCompiled");
 		render_interface->RenderCompiledGeometry(compiled_geometry, translation);
+
+		if (recorder)
+			recorder->RecordDrawCall((int)vertices.size(), texture);
 	}
 	// Otherwise, if we actually have geometry, try to compile it if we haven't already done so, otherwise render it in
 	// immediate mode.
@@ -121,10 +127,22 @@ void Geometry::Render(Vector2f translation)
 
 		RMLUI_ZoneScopedN("RenderGeometry");
 
+		const TextureHandle texture_handle = (texture ? texture->GetHandle(render_interface) : 0);
+
+		if (recorder)
+			recorder->RecordDrawCall((int)vertices.size(), texture);
+
 		if (!compile_attempted)
 		{
 			compile_attempted = true;
-			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(render_interface) : 0);
+
+			if (recorder)
+			{
+				recorder->GetStatistics().geometry_regenerations += 1;
+				recorder->RecordElementFlags(host_element, ElementStatistics::GeometryRegenerated);
+			}
+
+			compiled_geometry = render_interface->CompileGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle);
 
 			// If we managed to compile the geometry, we can clear the local copy of vertices and indices and
 			// immediately render the compiled version.
@@ -137,7 +155,7 @@ void Geometry::Render(Vector2f translation)
 
 		// Either we've attempted to compile before (and failed), or the compile we just attempted failed; either way,
 		// render the uncompiled version.
-		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture ? texture->GetHandle(GetRenderInterface()) : 0, translation);
+		render_interface->RenderGeometry(&vertices[0], (int)vertices.size(), &indices[0], (int)indices.size(), texture_handle, translation);
 	}
 }
 
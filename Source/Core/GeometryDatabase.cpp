@@ -27,8 +27,10 @@
  */
 
 #include "GeometryDatabase.h"
+#include "MemoryUsage.h"
 #include "../../Include/RmlUi/Core/Geometry.h"
 #include <algorithm>
+#include <mutex>
 
 
 namespace Rml {
@@ -115,24 +117,41 @@ private:
 
 
 static Database geometry_database;
+// Geometry is constructed and destroyed by contexts which may be updated on different threads.
+static std::mutex geometry_database_mutex;
 
 GeometryDatabaseHandle Insert(Geometry* geometry)
 {
+	std::lock_guard<std::mutex> lock(geometry_database_mutex);
 	return geometry_database.insert(geometry);
 }
 
 void Erase(GeometryDatabaseHandle handle)
 {
+	std::lock_guard<std::mutex> lock(geometry_database_mutex);
 	geometry_database.erase(handle);
 }
 
 void ReleaseAll()
 {
+	std::lock_guard<std::mutex> lock(geometry_database_mutex);
 	geometry_database.for_each([](Geometry* geometry) {
 		geometry->Release();
 	});
 }
 
+int GetNumGeometries(size_t& buffer_size)
+{
+	std::lock_guard<std::mutex> lock(geometry_database_mutex);
+	int num_geometries = 0;
+	buffer_size = 0;
+	geometry_database.for_each([&num_geometries, &buffer_size](Geometry* geometry) {
+		num_geometries += 1;
+		buffer_size += geometry->GetVertices().capacity() * sizeof(Vertex) + geometry->GetIndices().capacity() * sizeof(int);
+	});
+	return num_geometries;
+}
+
 
 #ifdef RMLUI_TESTS_ENABLED
 
@@ -160,4 +179,13 @@ bool ListMatchesDatabase(const Vector<Geometry>& geometry_list)
 #endif // RMLUI_TESTS_ENABLED
 
 } // namespace GeometryDatabase
+
+void MemoryUsage::AddGeometry(MemoryStatistics& statistics)
+{
+	size_t buffer_size = 0;
+	const int num_geometries = GeometryDatabase::GetNumGeometries(buffer_size);
+	statistics.geometry.count += num_geometries;
+	statistics.geometry.bytes += num_geometries * sizeof(Geometry) + buffer_size;
+}
+
 } // namespace Rml
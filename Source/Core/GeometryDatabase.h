@@ -53,6 +53,9 @@ namespace GeometryDatabase {
 
     void ReleaseAll();
 
+    // Returns the number of active geometries, and the total size of their vertex and index buffers in bytes.
+    int GetNumGeometries(size_t& buffer_size);
+
 #ifdef RMLUI_TESTS_ENABLED
     bool PrepareForTests();
     bool ListMatchesDatabase(const Vector<Geometry>& geometry_list);
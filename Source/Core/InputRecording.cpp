@@ -0,0 +1,260 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/InputRecording.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include <stdio.h>
+
+namespace Rml {
+
+static const char* recording_header = "rmlui-input-recording 1";
+
+InputRecorder::InputRecorder(Context* context) : context(context)
+{
+	RMLUI_ASSERTMSG(!context->input_recorder, "The context is already being recorded.");
+	context->input_recorder = this;
+
+	recording = recording_header;
+	recording += '\n';
+	RecordDimensions(context->GetDimensions());
+}
+
+InputRecorder::~InputRecorder()
+{
+	if (context)
+		context->input_recorder = nullptr;
+}
+
+const String& InputRecorder::GetRecording() const
+{
+	return recording;
+}
+
+void InputRecorder::RecordKeyDown(Input::KeyIdentifier key_identifier, int key_modifier_state)
+{
+	Record("keydown", CreateString(32, "%d %d", (int)key_identifier, key_modifier_state));
+}
+
+void InputRecorder::RecordKeyUp(Input::KeyIdentifier key_identifier, int key_modifier_state)
+{
+	Record("keyup", CreateString(32, "%d %d", (int)key_identifier, key_modifier_state));
+}
+
+void InputRecorder::RecordTextInput(const String& string)
+{
+	// Encode the text as hexadecimal bytes to keep each entry on a single line.
+	String hex;
+	hex.reserve(string.size() * 2);
+	for (char c : string)
+		hex += CreateString(4, "%02x", (unsigned int)(unsigned char)c);
+	Record("text", hex);
+}
+
+void InputRecorder::RecordMouseMove(int x, int y, int key_modifier_state)
+{
+	Record("mousemove", CreateString(48, "%d %d %d", x, y, key_modifier_state));
+}
+
+void InputRecorder::RecordMouseButtonDown(int button_index, int key_modifier_state)
+{
+	Record("mousedown", CreateString(32, "%d %d", button_index, key_modifier_state));
+}
+
+void InputRecorder::RecordMouseButtonUp(int button_index, int key_modifier_state)
+{
+	Record("mouseup", CreateString(32, "%d %d", button_index, key_modifier_state));
+}
+
+void InputRecorder::RecordMouseWheel(float wheel_delta, int key_modifier_state)
+{
+	Record("wheel", CreateString(48, "%.9g %d", wheel_delta, key_modifier_state));
+}
+
+void InputRecorder::RecordDimensions(Vector2i dimensions)
+{
+	Record("dimensions", CreateString(32, "%d %d", dimensions.x, dimensions.y));
+}
+
+void InputRecorder::RecordUpdate()
+{
+	Record("update", String());
+}
+
+void InputRecorder::Record(const char* type, const String& arguments)
+{
+	recording += CreateString(64, "%.6f %s", context->GetElapsedTime(), type);
+	if (!arguments.empty())
+	{
+		recording += ' ';
+		recording += arguments;
+	}
+	recording += '\n';
+}
+
+
+InputReplayer::InputReplayer(Context* context, const String& recording) : context(context)
+{
+	StringList lines;
+	StringUtilities::ExpandString(lines, recording, '\n');
+
+	valid = (!lines.empty() && lines[0] == recording_header);
+	for (size_t i = 1; valid && i < lines.size(); i++)
+	{
+		Entry entry;
+		if (!ParseEntry(lines[i], entry))
+		{
+			Log::Message(Log::LT_WARNING, "Invalid input recording entry at line %d: %s", int(i + 1), lines[i].c_str());
+			valid = false;
+		}
+		else
+		{
+			if (entry.type == Type::Update)
+				num_frames += 1;
+			entries.push_back(std::move(entry));
+		}
+	}
+
+	if (!valid)
+	{
+		entries.clear();
+		num_frames = 0;
+	}
+
+	if (!entries.empty())
+		time = entries.front().time;
+	context->SetTimeOverride(time);
+}
+
+InputReplayer::~InputReplayer()
+{
+	context->ClearTimeOverride();
+}
+
+bool InputReplayer::IsValid() const
+{
+	return valid;
+}
+
+bool InputReplayer::NextFrame()
+{
+	while (next_entry < entries.size())
+	{
+		const Entry& entry = entries[next_entry++];
+		time = entry.time;
+		context->SetTimeOverride(time);
+
+		switch (entry.type)
+		{
+		case Type::KeyDown: context->ProcessKeyDown((Input::KeyIdentifier)entry.values[0], entry.values[1]); break;
+		case Type::KeyUp: context->ProcessKeyUp((Input::KeyIdentifier)entry.values[0], entry.values[1]); break;
+		case Type::TextInput: context->ProcessTextInput(entry.text); break;
+		case Type::MouseMove: context->ProcessMouseMove(entry.values[0], entry.values[1], entry.values[2]); break;
+		case Type::MouseButtonDown: context->ProcessMouseButtonDown(entry.values[0], entry.values[1]); break;
+		case Type::MouseButtonUp: context->ProcessMouseButtonUp(entry.values[0], entry.values[1]); break;
+		case Type::MouseWheel: context->ProcessMouseWheel(entry.wheel_delta, entry.values[0]); break;
+		case Type::Dimensions: context->SetDimensions(Vector2i(entry.values[0], entry.values[1])); break;
+		case Type::Update: return true;
+		}
+	}
+
+	return false;
+}
+
+int InputReplayer::GetNumFrames() const
+{
+	return num_frames;
+}
+
+double InputReplayer::GetTime() const
+{
+	return time;
+}
+
+bool InputReplayer::ParseEntry(const String& line, Entry& entry)
+{
+	entry = {};
+
+	char type[16] = {};
+	int num_read = 0;
+	if (sscanf(line.c_str(), "%lf %15s %n", &entry.time, type, &num_read) != 2)
+		return false;
+
+	const char* arguments = line.c_str() + num_read;
+	const String type_name = type;
+	int* values = entry.values;
+
+	if (type_name == "keydown" || type_name == "keyup")
+	{
+		entry.type = (type_name == "keydown" ? Type::KeyDown : Type::KeyUp);
+		return sscanf(arguments, "%d %d", &values[0], &values[1]) == 2;
+	}
+	else if (type_name == "text")
+	{
+		entry.type = Type::TextInput;
+		unsigned int byte = 0;
+		for (const char* p = arguments; p[0] && p[1]; p += 2)
+		{
+			if (sscanf(p, "%2x", &byte) != 1)
+				return false;
+			entry.text += (char)byte;
+		}
+		return true;
+	}
+	else if (type_name == "mousemove")
+	{
+		entry.type = Type::MouseMove;
+		return sscanf(arguments, "%d %d %d", &values[0], &values[1], &values[2]) == 3;
+	}
+	else if (type_name == "mousedown" || type_name == "mouseup")
+	{
+		entry.type = (type_name == "mousedown" ? Type::MouseButtonDown : Type::MouseButtonUp);
+		return sscanf(arguments, "%d %d", &values[0], &values[1]) == 2;
+	}
+	else if (type_name == "wheel")
+	{
+		entry.type = Type::MouseWheel;
+		return sscanf(arguments, "%f %d", &entry.wheel_delta, &values[0]) == 2;
+	}
+	else if (type_name == "dimensions")
+	{
+		entry.type = Type::Dimensions;
+		return sscanf(arguments, "%d %d", &values[0], &values[1]) == 2;
+	}
+	else if (type_name == "update")
+	{
+		entry.type = Type::Update;
+		return true;
+	}
+
+	return false;
+}
+
+} // namespace Rml
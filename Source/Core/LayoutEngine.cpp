@@ -27,10 +27,12 @@
  */
 
 #include "LayoutEngine.h"
+#include "FrameStatisticsRecorder.h"
 #include "LayoutBlockBoxSpace.h"
 #include "LayoutDetails.h"
 #include "LayoutInlineBoxText.h"
 #include "LayoutTable.h"
+#include "MemoryUsage.h"
 #include "Pool.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
@@ -51,9 +53,23 @@ static constexpr std::size_t ChunkSizeBig = sizeof(LayoutBlockBox);
 static constexpr std::size_t ChunkSizeMedium = MAX(sizeof(LayoutInlineBox), sizeof(LayoutInlineBoxText));
 static constexpr std::size_t ChunkSizeSmall = MAX(sizeof(LayoutLineBox), sizeof(LayoutBlockBoxSpace));
 
-static Pool< LayoutChunk<ChunkSizeBig> > layout_chunk_pool_big(50, true);
-static Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true);
-static Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true);
+static Pool< LayoutChunk<ChunkSizeBig> > layout_chunk_pool_big(50, true, MemoryCategory::Layout);
+static Pool< LayoutChunk<ChunkSizeMedium> > layout_chunk_pool_medium(50, true, MemoryCategory::Layout);
+static Pool< LayoutChunk<ChunkSizeSmall> > layout_chunk_pool_small(50, true, MemoryCategory::Layout);
+
+template <typename PoolType>
+static void AddPoolUsage(MemoryStatistics::Usage& usage, const Pool<PoolType>& pool)
+{
+	usage.count += pool.GetNumAllocatedObjects();
+	usage.bytes += pool.GetSize() * sizeof(PoolType);
+}
+
+void MemoryUsage::AddLayoutChunks(MemoryStatistics& statistics)
+{
+	AddPoolUsage(statistics.layout_chunks, layout_chunk_pool_big);
+	AddPoolUsage(statistics.layout_chunks, layout_chunk_pool_medium);
+	AddPoolUsage(statistics.layout_chunks, layout_chunk_pool_small);
+}
 
 
 // Formats the contents for a root-level element (usually a document or floating element).
@@ -66,6 +82,12 @@ void LayoutEngine::FormatElement(Element* element, Vector2f containing_block, co
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+	{
+		recorder->GetStatistics().formatted_elements += 1;
+		recorder->RecordElementFlags(element, ElementStatistics::Formatted);
+	}
+
 	auto containing_block_box = MakeUnique<LayoutBlockBox>(nullptr, nullptr, Box(containing_block), 0.0f, FLT_MAX);
 
 	Box box;
@@ -139,6 +161,12 @@ bool LayoutEngine::FormatElement(LayoutBlockBox* block_context_box, Element* ele
 	RMLUI_ZoneName(name.c_str(), name.size());
 #endif
 
+	if (FrameStatisticsRecorder* recorder = FrameStatisticsRecorder::GetActive())
+	{
+		recorder->GetStatistics().formatted_elements += 1;
+		recorder->RecordElementFlags(element, ElementStatistics::Formatted);
+	}
+
 	auto& computed = element->GetComputedValues();
 
 	// Check if we have to do any special formatting for any elements that don't fit into the standard layout scheme.
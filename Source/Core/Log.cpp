@@ -30,6 +30,7 @@
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "LogCapture.h"
 
 #include <stdarg.h>
 #ifdef RMLUI_PLATFORM_WIN32
@@ -66,7 +67,8 @@ void Log::Message(Log::Type type, const char* fmt, ...)
 	buffer[len] = '\0';
 	va_end(argument_list);
 
-	GetSystemInterface()->LogMessage(type, buffer);
+	if (!LogCapture::Capture(type, buffer))
+		GetSystemInterface()->LogMessage(type, buffer);
 }
 
 // Log a parse error on the specified file and line number.
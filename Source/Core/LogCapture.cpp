@@ -0,0 +1,70 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "LogCapture.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+
+namespace Rml {
+
+static thread_local LogCapture* active_capture = nullptr;
+
+LogCapture::LogCapture() : enclosing_capture(active_capture)
+{
+	active_capture = this;
+}
+
+LogCapture::~LogCapture()
+{
+	RMLUI_ASSERT(active_capture == this);
+	active_capture = enclosing_capture;
+}
+
+CapturedLogMessageList& LogCapture::GetMessages()
+{
+	return messages;
+}
+
+void LogCapture::Forward(const CapturedLogMessage& message) const
+{
+	if (enclosing_capture)
+		enclosing_capture->messages.push_back(message);
+	else
+		GetSystemInterface()->LogMessage(message.type, message.message);
+}
+
+bool LogCapture::Capture(Log::Type type, const char* message)
+{
+	if (!active_capture)
+		return false;
+
+	active_capture->messages.push_back(CapturedLogMessage{type, message});
+	return true;
+}
+
+} // namespace Rml
@@ -0,0 +1,74 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_CORE_LOGCAPTURE_H
+#define RMLUI_CORE_LOGCAPTURE_H
+
+#include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/Traits.h"
+#include "../../Include/RmlUi/Core/Types.h"
+
+namespace Rml {
+
+struct CapturedLogMessage {
+	Log::Type type;
+	String message;
+};
+using CapturedLogMessageList = Vector<CapturedLogMessage>;
+
+/**
+	Captures the messages logged on this thread during the lifetime of the object, instead of passing them on to the
+	system interface.
+
+	Used to keep messages from tasks that may run on other threads, so that they can be logged on the calling thread once
+	the tasks are done. Captures can be nested, the innermost capture on the thread receives the messages.
+ */
+
+class LogCapture : NonCopyMoveable
+{
+public:
+	LogCapture();
+	~LogCapture();
+
+	/// Returns the messages captured so far.
+	CapturedLogMessageList& GetMessages();
+
+	/// Logs the message past this capture, to the enclosing capture on this thread, or otherwise to the system interface.
+	void Forward(const CapturedLogMessage& message) const;
+
+	/// Adds the message to the innermost capture on this thread.
+	/// @return True if the message was captured, false if no capture is active.
+	static bool Capture(Log::Type type, const char* message);
+
+private:
+	CapturedLogMessageList messages;
+	LogCapture* enclosing_capture;
+};
+
+} // namespace Rml
+#endif
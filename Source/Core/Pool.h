@@ -31,13 +31,36 @@
 
 #include "../../Include/RmlUi/Core/Header.h"
 #include "../../Include/RmlUi/Core/Debug.h"
+#include "../../Include/RmlUi/Core/MemoryInterface.h"
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
+/**
+	Keeps track of all memory pools, so that their memory can be returned to the memory interface on shutdown.
+ */
+class PoolBase
+{
+public:
+	/// Frees the memory chunks of all pools without any allocated objects. The pools will allocate new chunks on demand.
+	static void ReleaseAllUnusedChunks();
+
+protected:
+	PoolBase();
+	virtual ~PoolBase();
+
+	/// Frees the memory chunks of the pool if it has no allocated objects.
+	virtual void ReleaseUnusedChunks() = 0;
+
+private:
+	PoolBase* previous_pool;
+	PoolBase* next_pool;
+};
+
 template < typename PoolType >
-class Pool
+class Pool : public PoolBase
 {
 private:
 	static constexpr size_t N = sizeof(PoolType);
@@ -106,13 +129,15 @@ public:
 		PoolNode* node;
 	};
 
-	Pool(int chunk_size = 0, bool grow = false);
+	/// Constructs the pool. The first chunk is allocated when the first object is allocated.
+	Pool(int chunk_size = 0, bool grow = false, MemoryCategory category = MemoryCategory::General);
 	~Pool();
 
 	/// Initialises the pool to a given size.
 	void Initialise(int chunk_size, bool grow = false);
 
 	/// Returns the head of the linked list of allocated objects.
+	/// @note Iteration is not synchronized with allocations from other threads.
 	inline Iterator Begin();
 
 	/// Attempts to allocate an object into a free slot in the memory pool and construct it using the given arguments.
@@ -133,12 +158,18 @@ public:
 	/// Returns the number of allocated objects in the pool.
 	inline int GetNumAllocatedObjects() const;
 
+protected:
+	void ReleaseUnusedChunks() override;
+
 private:
 	// Creates a new pool chunk and appends its nodes to the beginning of the free list.
 	void CreateChunk();
+	// Frees all chunks, all objects must have been deallocated.
+	void ReleaseChunks();
 
 	int chunk_size;
 	bool grow;
+	MemoryCategory category;
 
 	PoolChunk* pool;
 
@@ -148,6 +179,10 @@ private:
 
 	int num_allocated_objects;
 
+	// Guards the lists of nodes and chunks, pools are shared by contexts which may be updated on different threads.
+	// Objects are constructed and destroyed outside the lock.
+	mutable std::mutex mutex;
+
 #ifdef RMLUI_DEBUG
 	int max_num_allocated_objects = 0;
 #endif
@@ -31,10 +31,11 @@
 namespace Rml {
 
 template < typename PoolType >
-Pool< PoolType >::Pool(int _chunk_size, bool _grow)
+Pool< PoolType >::Pool(int _chunk_size, bool _grow, MemoryCategory _category)
 {
 	chunk_size = 0;
 	grow = _grow;
+	category = _category;
 
 	num_allocated_objects = 0;
 
@@ -51,16 +52,7 @@ Pool< PoolType >::~Pool()
 {
 	RMLUI_ASSERT(num_allocated_objects == 0);
 
-	PoolChunk* chunk = pool;
-	while (chunk)
-	{
-		PoolChunk* next_chunk = chunk->next;
-
-		delete[] chunk->chunk;
-		delete chunk;
-
-		chunk = next_chunk;
-	}
+	ReleaseChunks();
 }
 
 // Initialises the pool to a given size.
@@ -77,9 +69,6 @@ void Pool< PoolType >::Initialise(int _chunk_size, bool _grow)
 	grow = _grow;
 	chunk_size = _chunk_size;
 	pool = nullptr;
-
-	// Create the initial chunk.
-	CreateChunk();
 }
 
 // Returns the head of the linked list of allocated objects.
@@ -94,11 +83,13 @@ template<typename PoolType>
 template<typename ...Args>
 inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 {
+	std::unique_lock<std::mutex> lock(mutex);
+
 	// We can't allocate a new object if the deallocated list is empty.
 	if (first_free_node == nullptr)
 	{
-		// Attempt to grow the pool first.
-		if (grow)
+		// Attempt to grow the pool first, or create the initial chunk.
+		if (grow || !pool)
 		{
 			CreateChunk();
 			if (first_free_node == nullptr)
@@ -140,6 +131,8 @@ inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 
 	first_allocated_node = allocated_object;
 
+	lock.unlock();
+
 	return new (allocated_object->object) PoolType(std::forward<Args>(args)...);
 }
 
@@ -147,12 +140,14 @@ inline PoolType* Pool<PoolType>::AllocateAndConstruct(Args&&... args)
 template < typename PoolType >
 void Pool< PoolType >::DestroyAndDeallocate(Iterator& iterator)
 {
-	// We're about to deallocate an object.
-	--num_allocated_objects;
-
 	PoolNode* object = iterator.node;
 	reinterpret_cast<PoolType*>(object->object)->~PoolType();
 
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// We've just deallocated an object.
+	--num_allocated_objects;
+
 	// Get the previous and next pointers now, because they will be overwritten
 	// before we're finished.
 	PoolNode* previous_object = object->previous;
@@ -208,6 +203,7 @@ int Pool< PoolType >::GetSize() const
 template < typename PoolType >
 int Pool< PoolType >::GetNumChunks() const
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	int num_chunks = 0;
 
 	PoolChunk* chunk = pool;
@@ -224,6 +220,7 @@ int Pool< PoolType >::GetNumChunks() const
 template < typename PoolType >
 int Pool< PoolType >::GetNumAllocatedObjects() const
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	return num_allocated_objects;
 }
 
@@ -235,12 +232,14 @@ void Pool< PoolType >::CreateChunk()
 		return;
 
 	// Create the new chunk and mark it as the first chunk.
-	PoolChunk* new_chunk = new PoolChunk();
+	PoolChunk* new_chunk = new (Memory::Allocate(sizeof(PoolChunk), alignof(PoolChunk), category)) PoolChunk();
 	new_chunk->next = pool;
 	pool = new_chunk;
 
 	// Create chunk's pool nodes.
-	new_chunk->chunk = new PoolNode[chunk_size];
+	new_chunk->chunk = static_cast<PoolNode*>(Memory::Allocate(sizeof(PoolNode) * chunk_size, alignof(PoolNode), category));
+	for (int i = 0; i < chunk_size; i++)
+		new (&new_chunk->chunk[i]) PoolNode();
 
 	// Initialise the linked list.
 	for (int i = 0; i < chunk_size; i++)
@@ -259,4 +258,34 @@ void Pool< PoolType >::CreateChunk()
 	first_free_node = new_chunk->chunk;
 }
 
+template < typename PoolType >
+void Pool< PoolType >::ReleaseUnusedChunks()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	if (num_allocated_objects == 0)
+		ReleaseChunks();
+}
+
+template < typename PoolType >
+void Pool< PoolType >::ReleaseChunks()
+{
+	PoolChunk* chunk = pool;
+	while (chunk)
+	{
+		PoolChunk* next_chunk = chunk->next;
+
+		for (int i = 0; i < chunk_size; i++)
+			chunk->chunk[i].~PoolNode();
+		Memory::Deallocate(chunk->chunk, sizeof(PoolNode) * chunk_size, alignof(PoolNode), category);
+		chunk->~PoolChunk();
+		Memory::Deallocate(chunk, sizeof(PoolChunk), alignof(PoolChunk), category);
+
+		chunk = next_chunk;
+	}
+
+	pool = nullptr;
+	first_allocated_node = nullptr;
+	first_free_node = nullptr;
+}
+
 } // namespace Rml
@@ -38,7 +38,7 @@ namespace Rml {
 static int FormatString(String& string, size_t max_size, const char* format, va_list argument_list)
 {
 	const int INTERNAL_BUFFER_SIZE = 1024;
-	static char buffer[INTERNAL_BUFFER_SIZE];
+	static thread_local char buffer[INTERNAL_BUFFER_SIZE];
 	char* buffer_ptr = buffer;
 
 	if (max_size + 1 > INTERNAL_BUFFER_SIZE)
@@ -28,6 +28,7 @@
 
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "ElementDefinition.h"
+#include "MemoryUsage.h"
 #include "StyleSheetNode.h"
 #include "Utilities.h"
 #include "../../Include/RmlUi/Core/DecoratorInstancer.h"
@@ -36,9 +37,12 @@
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
 #include <algorithm>
+#include <atomic>
 
 namespace Rml {
 
+static std::atomic<int> num_style_sheets{0};
+
 // Sorts style nodes based on specificity.
 inline static bool StyleSheetNodeSort(const StyleSheetNode* lhs, const StyleSheetNode* rhs)
 {
@@ -49,10 +53,12 @@ StyleSheet::StyleSheet()
 {
 	root = MakeUnique<StyleSheetNode>();
 	specificity_offset = 0;
+	num_style_sheets += 1;
 }
 
 StyleSheet::~StyleSheet()
 {
+	num_style_sheets -= 1;
 }
 
 /// Combines this style sheet with another one, producing a new sheet
@@ -77,6 +83,7 @@ void StyleSheet::MergeStyleSheet(const StyleSheet& other_sheet)
 {
 	RMLUI_ZoneScoped;
 
+	node_index_built = false;
 	root->MergeHierarchy(other_sheet.root.get(), specificity_offset);
 	specificity_offset += other_sheet.specificity_offset;
 
@@ -105,9 +112,22 @@ void StyleSheet::MergeStyleSheet(const StyleSheet& other_sheet)
 void StyleSheet::BuildNodeIndex()
 {
 	RMLUI_ZoneScoped;
+
+	// Style sheets loaded from file are shared between documents, only build the index the first time it is needed.
+	std::lock_guard<std::mutex> lock(cache_mutex);
+	if (node_index_built)
+		return;
+
 	styled_node_index.clear();
 	root->BuildIndex(styled_node_index);
 	root->SetStructurallyVolatileRecursive(false);
+	sibling_dependencies = root->GetSiblingDependenciesRecursive();
+	node_index_built = true;
+}
+
+int StyleSheet::GetSiblingDependencies() const
+{
+	return sibling_dependencies;
 }
 
 // Returns the Keyframes of the given name, or null if it does not exist.
@@ -130,11 +150,14 @@ const Vector<SharedPtr<const Decorator>>& StyleSheet::InstanceDecorators(const D
 	if (source)
 		key += source->path;
 
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
 	auto it_cache = decorator_cache.find(key);
 	if (it_cache != decorator_cache.end())
-		return it_cache->second;
+		return *it_cache->second;
 
-	Vector<SharedPtr<const Decorator>>& decorators = decorator_cache[key];
+	auto decorators_ptr = MakeUnique<Vector<SharedPtr<const Decorator>>>();
+	Vector<SharedPtr<const Decorator>>& decorators = *decorators_ptr;
 
 	for (const DecoratorDeclaration& declaration : declaration_list.list)
 	{
@@ -162,6 +185,8 @@ const Vector<SharedPtr<const Decorator>>& StyleSheet::InstanceDecorators(const D
 		}
 	}
 
+	decorator_cache[key] = std::move(decorators_ptr);
+
 	return decorators;
 }
 
@@ -186,8 +211,8 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 	RMLUI_ASSERT_NONRECURSIVE;
 
 	// See if there are any styles defined for this element.
-	// Using static to avoid allocations. Make sure we don't call this function recursively.
-	static Vector< const StyleSheetNode* > applicable_nodes;
+	// Using thread-local static to avoid allocations. Make sure we don't call this function recursively.
+	static thread_local Vector< const StyleSheetNode* > applicable_nodes;
 	applicable_nodes.clear();
 
 	const String& tag = element->GetTagName();
@@ -241,6 +266,8 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 	for (const StyleSheetNode* node : applicable_nodes)
 		Utilities::HashCombine(seed, node);
 
+	std::lock_guard<std::mutex> lock(cache_mutex);
+
 	auto cache_iterator = node_cache.find(seed);
 	if (cache_iterator != node_cache.end())
 	{
@@ -255,4 +282,11 @@ SharedPtr<ElementDefinition> StyleSheet::GetElementDefinition(const Element* ele
 	return new_definition;
 }
 
+void MemoryUsage::AddStyleSheets(MemoryStatistics& statistics)
+{
+	const int count = num_style_sheets;
+	statistics.style_sheets.count += count;
+	statistics.style_sheets.bytes += count * sizeof(StyleSheet);
+}
+
 } // namespace Rml
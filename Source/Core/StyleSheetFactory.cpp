@@ -29,6 +29,7 @@
 #include "StyleSheetFactory.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "StyleSheetNode.h"
+#include "LogCapture.h"
 #include "StreamFile.h"
 #include "StyleSheetNodeSelectorNthChild.h"
 #include "StyleSheetNodeSelectorNthLastChild.h"
@@ -41,7 +42,12 @@
 #include "StyleSheetNodeSelectorOnlyChild.h"
 #include "StyleSheetNodeSelectorOnlyOfType.h"
 #include "StyleSheetNodeSelectorEmpty.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/Log.h"
+#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/TaskInterface.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -82,26 +88,104 @@ void StyleSheetFactory::Shutdown()
 const StyleSheetContainer* StyleSheetFactory::GetStyleSheetContainer(const String& sheet_name)
 {
 	// Look up the sheet definition in the cache
-	auto it = instance->stylesheets.find(sheet_name);
-	if (it != instance->stylesheets.end())
-		return it->second.get();
+	{
+		std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+		auto it = instance->stylesheets.find(sheet_name);
+		if (it != instance->stylesheets.end())
+			return it->second.get();
+	}
 
-	// Don't currently have the sheet, attempt to load it
+	// Don't currently have the sheet, attempt to load it. This is done outside the lock so that loading a sheet
+	// doesn't block other threads.
 	UniquePtr<const StyleSheetContainer> sheet = instance->LoadStyleSheetContainer(sheet_name);
 	if (!sheet)
 		return nullptr;
 
-	const StyleSheetContainer* result = sheet.get();
+	// Add it to the cache, unless another thread loaded the same sheet in the meantime.
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+	auto result = instance->stylesheets.emplace(sheet_name, std::move(sheet));
+
+	return result.first->second.get();
+}
+
+void StyleSheetFactory::PreloadStyleSheetContainers(const StringList& sheet_names)
+{
+	TaskInterface* task_interface = GetTaskInterface();
+	if (task_interface->GetConcurrency() <= 1)
+		return;
+
+	StringList missing_sheet_names;
+	{
+		std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+		for (const String& sheet_name : sheet_names)
+		{
+			if (instance->stylesheets.find(sheet_name) == instance->stylesheets.end() &&
+				std::find(missing_sheet_names.begin(), missing_sheet_names.end(), sheet_name) == missing_sheet_names.end())
+				missing_sheet_names.push_back(sheet_name);
+		}
+	}
+
+	if (missing_sheet_names.size() < 2)
+		return;
+
+	struct SheetSource {
+		String data;
+		URL url;
+		UniquePtr<StyleSheetContainer> sheet;
+		CapturedLogMessageList messages;
+	};
+	Vector<SheetSource> sources(missing_sheet_names.size());
 
-	// Add it to the cache.
-	instance->stylesheets[sheet_name] = std::move(sheet);
+	// The files are read on the calling thread, as the file interface need not be thread-safe. Files that can't be opened
+	// are skipped silently, they are reported when loaded through GetStyleSheetContainer().
+	FileInterface* file_interface = GetFileInterface();
+	for (size_t i = 0; i < missing_sheet_names.size(); i++)
+	{
+		// Mirror the path handling of StreamFile, so that relative paths in the sheets resolve the same way.
+		const String& sheet_name = missing_sheet_names[i];
+		if (file_interface->LoadFile(StringUtilities::Replace(sheet_name, '|', ':'), sources[i].data))
+		{
+			sources[i].url = URL(StringUtilities::Replace(sheet_name, ':', '|'));
+			sources[i].sheet = MakeUnique<StyleSheetContainer>();
+		}
+	}
 
-	return result;
+	task_interface->ParallelFor(0, (int)sources.size(), 1, [&sources](int begin, int end) {
+		for (int i = begin; i < end; i++)
+		{
+			SheetSource& source = sources[i];
+			if (!source.sheet)
+				continue;
+
+			LogCapture log_capture;
+			StreamMemory stream((const byte*)source.data.data(), source.data.size());
+			stream.SetSourceURL(source.url);
+			if (!source.sheet->LoadStyleSheetContainer(&stream))
+				source.sheet.reset();
+			source.messages = std::move(log_capture.GetMessages());
+		}
+	});
+
+	// Messages from the tasks are logged here, as the system interface is only called from this thread.
+	for (const SheetSource& source : sources)
+	{
+		for (const CapturedLogMessage& message : source.messages)
+			Log::Message(message.type, "%s", message.message.c_str());
+	}
+
+	// Add the sheets to the cache, unless another thread loaded the same sheet in the meantime.
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
+	for (size_t i = 0; i < missing_sheet_names.size(); i++)
+	{
+		if (sources[i].sheet)
+			instance->stylesheets.emplace(missing_sheet_names[i], std::move(sources[i].sheet));
+	}
 }
 
 // Clear the style sheet cache.
 void StyleSheetFactory::ClearStyleSheetCache()
 {
+	std::lock_guard<std::mutex> lock(instance->stylesheets_mutex);
 	instance->stylesheets.clear();
 }
 
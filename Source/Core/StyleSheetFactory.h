@@ -30,6 +30,7 @@
 #define RMLUI_CORE_STYLESHEETFACTORY_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -54,10 +55,17 @@ public:
 	static void Shutdown();
 
 	/// Gets the named sheet, retrieving it from the cache if its already been loaded.
+	/// @note May be called concurrently from contexts on different threads.
 	/// @param sheet name of sheet to load
 	/// @lifetime Returned pointer is valid until the next call to ClearStyleSheetCache or Shutdown, it should not be stored around.
 	static const StyleSheetContainer* GetStyleSheetContainer(const String& sheet);
 
+	/// Loads the given sheets into the cache, unless they are already loaded. The sheets are parsed in parallel when
+	/// the task interface allows it, otherwise nothing is done and the sheets are loaded when first retrieved.
+	/// @note May be called concurrently from contexts on different threads.
+	/// @param sheets The names of the sheets to load.
+	static void PreloadStyleSheetContainers(const StringList& sheets);
+
 	/// Clear the style sheet cache.
 	static void ClearStyleSheetCache();
 
@@ -75,6 +83,7 @@ private:
 	// Individual loaded stylesheets
 	using StyleSheets = UnorderedMap<String, UniquePtr<const StyleSheetContainer>>;
 	StyleSheets stylesheets;
+	std::mutex stylesheets_mutex;
 
 	// Custom complex selectors available for style sheets.
 	using SelectorMap = UnorderedMap<String, UniquePtr<StyleSheetNodeSelector>>;
@@ -29,27 +29,39 @@
 #include "StyleSheetNode.h"
 #include "../../Include/RmlUi/Core/Element.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
+#include "MemoryUsage.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetNodeSelector.h"
 #include <algorithm>
+#include <atomic>
 
 namespace Rml {
 
+static std::atomic<int> num_style_sheet_nodes{0};
+
 StyleSheetNode::StyleSheetNode()
 {
 	CalculateAndSetSpecificity();
+	num_style_sheet_nodes += 1;
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_selectors, bool child_combinator)
 	: parent(parent), tag(tag), id(id), class_names(classes), pseudo_class_names(pseudo_classes), structural_selectors(structural_selectors), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	num_style_sheet_nodes += 1;
 }
 
 StyleSheetNode::StyleSheetNode(StyleSheetNode* parent, String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_selectors, bool child_combinator)
 	: parent(parent), tag(std::move(tag)), id(std::move(id)), class_names(std::move(classes)), pseudo_class_names(std::move(pseudo_classes)), structural_selectors(std::move(structural_selectors)), child_combinator(child_combinator)
 {
 	CalculateAndSetSpecificity();
+	num_style_sheet_nodes += 1;
+}
+
+StyleSheetNode::~StyleSheetNode()
+{
+	num_style_sheet_nodes -= 1;
 }
 
 StyleSheetNode* StyleSheetNode::GetOrCreateChildNode(const StyleSheetNode& other)
@@ -158,6 +170,18 @@ bool StyleSheetNode::SetStructurallyVolatileRecursive(bool ancestor_is_structura
 	return (self_is_structural_pseudo_class || descendant_is_structural_pseudo_class);
 }
 
+int StyleSheetNode::GetSiblingDependenciesRecursive() const
+{
+	int dependencies = 0;
+	for (const StructuralSelector& structural_selector : structural_selectors)
+		dependencies |= structural_selector.selector->GetSiblingDependencies();
+
+	for (auto& child : children)
+		dependencies |= child->GetSiblingDependenciesRecursive();
+
+	return dependencies;
+}
+
 bool StyleSheetNode::EqualRequirements(const String& _tag, const String& _id, const StringList& _class_names, const StringList& _pseudo_class_names, const StructuralSelectorList& _structural_selectors, bool _child_combinator) const
 {
 	if (tag != _tag)
@@ -313,4 +337,11 @@ void StyleSheetNode::CalculateAndSetSpecificity()
 		specificity += parent->specificity;
 }
 
+void MemoryUsage::AddStyleSheetNodes(MemoryStatistics& statistics)
+{
+	const int count = num_style_sheet_nodes;
+	statistics.style_sheet_nodes.count += count;
+	statistics.style_sheet_nodes.bytes += count * sizeof(StyleSheetNode);
+}
+
 } // namespace Rml
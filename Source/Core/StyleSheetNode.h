@@ -57,12 +57,13 @@ using StyleSheetNodeList = Vector< UniquePtr<StyleSheetNode> >;
 	@author Pete / Lloyd
  */
 
-class StyleSheetNode
+class StyleSheetNode : public Allocated<MemoryCategory::Style>
 {
 public:
 	StyleSheetNode();
 	StyleSheetNode(StyleSheetNode* parent, const String& tag, const String& id, const StringList& classes, const StringList& pseudo_classes, const StructuralSelectorList& structural_selectors, bool child_combinator);
 	StyleSheetNode(StyleSheetNode* parent, String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_selectors, bool child_combinator);
+	~StyleSheetNode();
 
 	/// Retrieves a child node with the given requirements if they match an existing node, or else creates a new one.
 	StyleSheetNode* GetOrCreateChildNode(String&& tag, String&& id, StringList&& classes, StringList&& pseudo_classes, StructuralSelectorList&& structural_selectors, bool child_combinator);
@@ -75,6 +76,8 @@ public:
 	UniquePtr<StyleSheetNode> DeepCopy(StyleSheetNode* parent = nullptr) const;
 	/// Recursively set structural volatility.
 	bool SetStructurallyVolatileRecursive(bool ancestor_is_structurally_volatile);
+	/// Returns the combined sibling dependencies of the structural selectors in this node and its descendants.
+	int GetSiblingDependenciesRecursive() const;
 	/// Builds up a style sheet's index recursively.
 	void BuildIndex(StyleSheet::NodeIndex& styled_node_index) const;
 
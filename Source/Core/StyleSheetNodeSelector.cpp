@@ -41,6 +41,9 @@ StyleSheetNodeSelector::~StyleSheetNodeSelector()
 // Returns true if a positive integer can be found for n in the equation an + b = count.
 bool StyleSheetNodeSelector::IsNth(int a, int b, int count)
 {
+	if (count <= 0)
+		return false;
+
 	int x = count;
 	x -= b;
 	if (a != 0)
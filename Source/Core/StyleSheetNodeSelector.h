@@ -39,7 +39,7 @@ class Element;
 	@author Peter Curry
  */
 
-class StyleSheetNodeSelector
+class StyleSheetNodeSelector : public Allocated<MemoryCategory::Style>
 {
 public:
 	StyleSheetNodeSelector();
@@ -51,6 +51,21 @@ public:
 	/// @param b[in] For counting selectors, this is the 'b' variable of an + b.
 	virtual bool IsApplicable(const Element* element, int a, int b) = 0;
 
+	/// Flags for the parts of an element's structure that a selector depends on, see Element::SiblingIndex.
+	enum SiblingDependency
+	{
+		DependsOnChild = 1 << 0,
+		DependsOnLastChild = 1 << 1,
+		DependsOnOfType = 1 << 2,
+		DependsOnLastOfType = 1 << 3,
+		// Depends on the children of the element itself, rather than on its position among its siblings.
+		DependsOnChildren = 1 << 4,
+	};
+
+	/// Returns the sibling dependencies of this selector, used to determine which elements need to be re-matched when
+	/// the structure of their parent changes.
+	virtual int GetSiblingDependencies() const = 0;
+
 protected:
 	/// Returns true if a positive integer can be found for n in the equation an + b = count.
 	bool IsNth(int a, int b, int count);
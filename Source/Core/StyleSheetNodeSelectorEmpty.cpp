@@ -54,4 +54,9 @@ bool StyleSheetNodeSelectorEmpty::IsApplicable(const Element* element, int RMLUI
 	return true;
 }
 
+int StyleSheetNodeSelectorEmpty::GetSiblingDependencies() const
+{
+	return DependsOnChildren;
+}
+
 } // namespace Rml
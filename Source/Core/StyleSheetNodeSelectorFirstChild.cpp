@@ -45,28 +45,12 @@ bool StyleSheetNodeSelectorFirstChild::IsApplicable(const Element* element, int
 	RMLUI_UNUSED(a);
 	RMLUI_UNUSED(b);
 
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	int child_index = 0;
-	while (child_index < parent->GetNumChildren())
-	{
-		// If this child (the first non-text child) is our element, then the selector succeeds.
-		Element* child = parent->GetChild(child_index);
-		if (child == element)
-			return true;
-
-		// If this child is not a text element, then the selector fails; this element is non-trivial.
-		if (rmlui_dynamic_cast< ElementText* >(child) == nullptr &&
-			child->GetDisplay() != Style::Display::None)
-			return false;
-
-		// Otherwise, skip over the text element to find the last non-trivial element.
-		child_index++;
-	}
+	return element->GetSiblingIndex().child == 1;
+}
 
-	return false;
+int StyleSheetNodeSelectorFirstChild::GetSiblingDependencies() const
+{
+	return DependsOnChild;
 }
 
 } // namespace Rml
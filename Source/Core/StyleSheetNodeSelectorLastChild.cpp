@@ -45,28 +45,12 @@ bool StyleSheetNodeSelectorLastChild::IsApplicable(const Element* element, int R
 	RMLUI_UNUSED(a);
 	RMLUI_UNUSED(b);
 
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	int child_index = parent->GetNumChildren() - 1;
-	while (child_index >= 0)
-	{
-		// If this child (the last non-text child) is our element, then the selector succeeds.
-		Element* child = parent->GetChild(child_index);
-		if (child == element)
-			return true;
-
-		// If this child is not a text element, then the selector fails; this element is non-trivial.
-		if (rmlui_dynamic_cast< ElementText* >(child) == nullptr &&
-			child->GetDisplay() != Style::Display::None)
-			return false;
-
-		// Otherwise, skip over the text element to find the last non-trivial element.
-		child_index--;
-	}
+	return element->GetSiblingIndex().last_child == 1;
+}
 
-	return false;
+int StyleSheetNodeSelectorLastChild::GetSiblingDependencies() const
+{
+	return DependsOnLastChild;
 }
 
 } // namespace Rml
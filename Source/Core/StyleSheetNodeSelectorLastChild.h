@@ -47,6 +47,7 @@ public:
 
 	// Returns true if the element is the last DOM child in its parent.
 	bool IsApplicable(const Element* element, int a, int b) override;
+	int GetSiblingDependencies() const override;
 };
 
 } // namespace Rml
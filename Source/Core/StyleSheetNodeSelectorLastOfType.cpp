@@ -45,28 +45,12 @@ bool StyleSheetNodeSelectorLastOfType::IsApplicable(const Element* element, int
 	RMLUI_UNUSED(a);
 	RMLUI_UNUSED(b);
 
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	int child_index = parent->GetNumChildren() - 1;
-	while (child_index >= 0)
-	{
-		// If this child is our element, then it's the first one we've found with our tag; the selector succeeds.
-		Element* child = parent->GetChild(child_index);
-		if (child == element)
-			return true;
-
-		// Otherwise, if this child shares our element's tag, then our element is not the first tagged child; the
-		// selector fails.
-		if (child->GetTagName() == element->GetTagName() &&
-			child->GetDisplay() != Style::Display::None)
-			return false;
-
-		child_index--;
-	}
+	return element->GetSiblingIndex().last_of_type == 1;
+}
 
-	return false;
+int StyleSheetNodeSelectorLastOfType::GetSiblingDependencies() const
+{
+	return DependsOnLastOfType;
 }
 
 } // namespace Rml
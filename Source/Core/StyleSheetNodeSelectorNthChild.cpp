@@ -43,32 +43,12 @@ StyleSheetNodeSelectorNthChild::~StyleSheetNodeSelectorNthChild()
 // Returns true if the element index is (n * a) + b for a given integer value of n.
 bool StyleSheetNodeSelectorNthChild::IsApplicable(const Element* element, int a, int b)
 {
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	// Start counting elements until we find this one.
-	int element_index = 1;
-	for (int i = 0; i < parent->GetNumChildren(); i++)
-	{
-		Element* child = parent->GetChild(i);
-
-		// Skip text nodes.
-		if (rmlui_dynamic_cast< ElementText* >(child) != nullptr)
-			continue;
-
-		// If we've found our element, then break; the current index is our element's index.
-		if (child == element)
-			break;
-
-		// Skip nodes without a display type.
-		if (child->GetDisplay() == Style::Display::None)
-			continue;
-
-		element_index++;
-	}
+	return IsNth(a, b, element->GetSiblingIndex().child);
+}
 
-	return IsNth(a, b, element_index);
+int StyleSheetNodeSelectorNthChild::GetSiblingDependencies() const
+{
+	return DependsOnChild;
 }
 
 } // namespace Rml
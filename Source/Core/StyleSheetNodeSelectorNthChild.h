@@ -47,6 +47,7 @@ public:
 
 	// Returns true if the element index is (n * a) + b for a given integer value of n.
 	bool IsApplicable(const Element* element, int a, int b) override;
+	int GetSiblingDependencies() const override;
 };
 
 } // namespace Rml
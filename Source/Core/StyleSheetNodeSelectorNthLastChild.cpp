@@ -42,31 +42,12 @@ StyleSheetNodeSelectorNthLastChild::~StyleSheetNodeSelectorNthLastChild()
 // Returns true if the element's reverse index is (n * a) + b for a given integer value of n.
 bool StyleSheetNodeSelectorNthLastChild::IsApplicable(const Element* element, int a, int b)
 {
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	// Start counting elements until we find this one.
-	int element_index = 1;
-	for (int i = parent->GetNumChildren() - 1; i >= 0; --i)
-	{
-		Element* child = parent->GetChild(i);
-
-		// Skip text nodes.
-		if (rmlui_dynamic_cast< ElementText* >(child) != nullptr)
-			continue;
-
-		// If we've found our element, then break; the current index is our element's index.
-		if (child == element)
-			break;
-
-		if (child->GetDisplay() == Style::Display::None)
-			continue;
-
-		element_index++;
-	}
+	return IsNth(a, b, element->GetSiblingIndex().last_child);
+}
 
-	return IsNth(a, b, element_index);
+int StyleSheetNodeSelectorNthLastChild::GetSiblingDependencies() const
+{
+	return DependsOnLastChild;
 }
 
 } // namespace Rml
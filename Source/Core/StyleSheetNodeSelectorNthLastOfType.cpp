@@ -42,29 +42,12 @@ StyleSheetNodeSelectorNthLastOfType::~StyleSheetNodeSelectorNthLastOfType()
 // Returns true if the element index is (n * a) + b for a given integer value of n.
 bool StyleSheetNodeSelectorNthLastOfType::IsApplicable(const Element* element, int a, int b)
 {
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	// Start counting elements until we find this one.
-	int element_index = 1;
-	for (int i = parent->GetNumChildren() - 1; i >= 0; --i)
-	{
-		Element* child = parent->GetChild(i);
-
-		// If we've found our element, then break; the current index is our element's index.
-		if (child == element)
-			break;
-
-		// Skip nodes that don't share our tag.
-		if (child->GetTagName() != element->GetTagName() ||
-			child->GetDisplay() == Style::Display::None)
-			continue;
-
-		element_index++;
-	}
+	return IsNth(a, b, element->GetSiblingIndex().last_of_type);
+}
 
-	return IsNth(a, b, element_index);
+int StyleSheetNodeSelectorNthLastOfType::GetSiblingDependencies() const
+{
+	return DependsOnLastOfType;
 }
 
 } // namespace Rml
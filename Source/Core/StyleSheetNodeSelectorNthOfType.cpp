@@ -42,29 +42,12 @@ StyleSheetNodeSelectorNthOfType::~StyleSheetNodeSelectorNthOfType()
 // Returns true if the element index is (n * a) + b for a given integer value of n.
 bool StyleSheetNodeSelectorNthOfType::IsApplicable(const Element* element, int a, int b)
 {
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	// Start counting elements until we find this one.
-	int element_index = 1;
-	for (int i = 0; i < parent->GetNumChildren(); ++i)
-	{
-		Element* child = parent->GetChild(i);
-
-		// If we've found our element, then break; the current index is our element's index.
-		if (child == element)
-			break;
-
-		// Skip nodes that don't share our tag.
-		if (child->GetTagName() != element->GetTagName() ||
-			child->GetDisplay() == Style::Display::None)
-			continue;
-
-		element_index++;
-	}
+	return IsNth(a, b, element->GetSiblingIndex().of_type);
+}
 
-	return IsNth(a, b, element_index);
+int StyleSheetNodeSelectorNthOfType::GetSiblingDependencies() const
+{
+	return DependsOnOfType;
 }
 
 } // namespace Rml
@@ -45,27 +45,13 @@ bool StyleSheetNodeSelectorOnlyChild::IsApplicable(const Element* element, int R
 	RMLUI_UNUSED(a);
 	RMLUI_UNUSED(b);
 
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	for (int i = 0; i < parent->GetNumChildren(); ++i)
-	{
-		Element* child = parent->GetChild(i);
-
-		// Skip the child if it is our element.
-		if (child == element)
-			continue;
-
-		// Skip the child if it is trivial.
-		if (rmlui_dynamic_cast< const ElementText* >(element) != nullptr ||
-			child->GetDisplay() == Style::Display::None)
-			continue;
-
-		return false;
-	}
+	const Element::SiblingIndex& index = element->GetSiblingIndex();
+	return index.child == 1 && index.last_child == 1;
+}
 
-	return true;
+int StyleSheetNodeSelectorOnlyChild::GetSiblingDependencies() const
+{
+	return DependsOnChild | DependsOnLastChild;
 }
 
 } // namespace Rml
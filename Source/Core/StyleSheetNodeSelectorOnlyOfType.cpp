@@ -45,28 +45,13 @@ bool StyleSheetNodeSelectorOnlyOfType::IsApplicable(const Element* element, int
 	RMLUI_UNUSED(a);
 	RMLUI_UNUSED(b);
 
-	Element* parent = element->GetParentNode();
-	if (parent == nullptr)
-		return false;
-
-	for (int i = 0; i < parent->GetNumChildren(); ++i)
-	{
-		Element* child = parent->GetChild(i);
-
-		// Skip the child if it is our element.
-		if (child == element)
-			continue;
-
-		// Skip the child if it does not share our tag.
-		if (child->GetTagName() != element->GetTagName() ||
-			child->GetDisplay() == Style::Display::None)
-			continue;
-
-		// We've found a similarly-tagged child to our element; selector fails.
-		return false;
-	}
+	const Element::SiblingIndex& index = element->GetSiblingIndex();
+	return index.of_type == 1 && index.last_of_type == 1;
+}
 
-	return true;
+int StyleSheetNodeSelectorOnlyOfType::GetSiblingDependencies() const
+{
+	return DependsOnOfType | DependsOnLastOfType;
 }
 
 } // namespace Rml
@@ -47,6 +47,7 @@ public:
 
 	// Returns true if the element is the only DOM child of its parent of its type.
 	bool IsApplicable(const Element* element, int a, int b) override;
+	int GetSiblingDependencies() const override;
 };
 
 } // namespace Rml
@@ -28,19 +28,23 @@
 
 #include "StyleSheetParser.h"
 #include "ComputeProperty.h"
+#include "LogCapture.h"
 #include "StyleSheetFactory.h"
 #include "StyleSheetNode.h"
+#include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/DecoratorInstancer.h"
 #include "../../Include/RmlUi/Core/Factory.h"
 #include "../../Include/RmlUi/Core/Log.h"
 #include "../../Include/RmlUi/Core/Profiling.h"
 #include "../../Include/RmlUi/Core/PropertyDefinition.h"
 #include "../../Include/RmlUi/Core/PropertySpecification.h"
-#include "../../Include/RmlUi/Core/StreamMemory.h"
+#include "../../Include/RmlUi/Core/Stream.h"
 #include "../../Include/RmlUi/Core/StyleSheet.h"
 #include "../../Include/RmlUi/Core/StyleSheetContainer.h"
 #include "../../Include/RmlUi/Core/StyleSheetSpecification.h"
+#include "../../Include/RmlUi/Core/TaskInterface.h"
 #include <algorithm>
+#include <mutex>
 #include <string.h>
 
 namespace Rml {
@@ -158,6 +162,8 @@ public:
 
 
 static UniquePtr<SpritesheetPropertyParser> spritesheet_property_parser;
+// Style sheets may be parsed concurrently by documents loaded on different threads.
+static std::mutex spritesheet_property_parser_mutex;
 
 /*
  * Media queries need a special parser because they have unique properties that 
@@ -216,12 +222,13 @@ public:
 
 
 static UniquePtr<MediaQueryPropertyParser> media_query_property_parser;
+static std::mutex media_query_property_parser_mutex;
 
 
 StyleSheetParser::StyleSheetParser()
 {
+	begin_line_number = 0;
 	line_number = 0;
-	stream = nullptr;
 	parse_buffer_pos = 0;
 }
 
@@ -264,6 +271,21 @@ static bool IsValidIdentifier(const String& str)
 }
 
 
+// Returns the first character in the range [begin, end) which is one of the given delimiters, or end if none is found.
+// The range must be followed by a null character.
+static const char* FindFirstOf(const char* begin, const char* end, const char* delimiters)
+{
+	while (begin < end)
+	{
+		// Scans in bulk, but also stops at null characters which may be embedded in the range.
+		begin += strcspn(begin, delimiters);
+		if (begin == end || *begin != '\0')
+			return begin;
+		begin++;
+	}
+	return end;
+}
+
 static void PostprocessKeyframes(KeyframesMap& keyframes_map)
 {
 	for (auto& keyframes_pair : keyframes_map)
@@ -418,6 +440,7 @@ bool StyleSheetParser::ParseDecoratorBlock(const String& at_name, DecoratorSpeci
 
 bool StyleSheetParser::ParseMediaFeatureMap(PropertyDictionary& properties, const String & rules)
 {
+	std::lock_guard<std::mutex> lock(media_query_property_parser_mutex);
 	media_query_property_parser->SetTargetProperties(&properties);
 
 	enum ParseState { Global, Name, Value };
@@ -509,15 +532,27 @@ bool StyleSheetParser::ParseMediaFeatureMap(PropertyDictionary& properties, cons
 	return true;
 }
 
-bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int begin_line_number)
+bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* stream, int _begin_line_number)
 {
 	RMLUI_ZoneScoped;
 
+	// Messages are held back until the whole sheet has been parsed, so that those from rules parsed in parallel can be
+	// reported on this thread and in source order.
+	LogCapture log_capture;
+
 	int rule_count = 0;
+	begin_line_number = _begin_line_number;
 	line_number = begin_line_number;
-	stream = _stream;
 	stream_file_name = StringUtilities::Replace(stream->GetSourceURL().GetURL(), '|', ':');
 
+	// Read the whole stream up front, so that it can be scanned in bulk.
+	String stream_data;
+	stream_data.reserve(stream->Length());
+	while (!stream->IsEOS() && stream->Read(stream_data, 4096) > 0) {}
+
+	LoadBuffer(stream_data.data(), stream_data.size());
+	stream_data = String();
+
 	enum class State { Global, AtRuleIdentifier, KeyframeBlock, Invalid };
 	State state = State::Global;
 
@@ -530,202 +565,187 @@ bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int
 	// At-rules given by the following syntax in global space: @identifier name { block }
 	String at_rule_name;
 
-	// Look for more styles while data is available
-	while (FillBuffer())
+	// The properties of style rules are parsed once the whole sheet has been read.
+	PendingRuleList pending_rules;
+
+	String pre_token_str;
+
+	while (char token = FindToken(pre_token_str, "{@}", true))
 	{
-		String pre_token_str;
-		
-		while (char token = FindToken(pre_token_str, "{@}", true))
+		switch (state)
 		{
-			switch (state)
-			{
-			case State::Global:
+		case State::Global:
+		{
+			if (token == '{')
 			{
-				if (token == '{')
+				// Initialize current block if not present
+				if (!current_block.stylesheet)
 				{
-					// Initialize current block if not present
-					if (!current_block.stylesheet)
-					{
-						current_block = MediaBlock{PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet())};
-					}
+					current_block = MediaBlock{PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet())};
+				}
 
-					const int rule_line_number = line_number;
-					
-					// Read the attributes
-					PropertyDictionary properties;
-					PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
-					if (!ReadProperties(parser))
-						continue;
+				pending_rules.push_back(PendingRule{ current_block.stylesheet.get(), pre_token_str, line_number, rule_count, parse_buffer_pos, log_capture.GetMessages().size() });
 
-					StringList rule_name_list;
-					StringUtilities::ExpandString(rule_name_list, pre_token_str);
+				// Skip ahead to the end of the properties block, it always ends at the first closing brace.
+				const char* block_end = (const char*)memchr(parse_buffer.data() + parse_buffer_pos, '}', parse_buffer.size() - parse_buffer_pos);
+				parse_buffer_pos = (block_end ? size_t(block_end - parse_buffer.data()) + 1 : parse_buffer.size());
+				line_number = GetLineNumber(parse_buffer_pos);
 
-					// Add style nodes to the root of the tree
-					for (size_t i = 0; i < rule_name_list.size(); i++)
-					{
-						auto source = MakeShared<PropertySource>(stream_file_name, rule_line_number, rule_name_list[i]);
-						properties.SetSourceOfAllProperties(source);
-						ImportProperties(current_block.stylesheet->root.get(), rule_name_list[i], properties, rule_count);
-					}
+				rule_count++;
+			}
+			else if (token == '@')
+			{
+				state = State::AtRuleIdentifier;
+			}
+			else if (inside_media_block && token == '}')
+			{
+				// Complete current block
+				PostprocessKeyframes(current_block.stylesheet->keyframes);
+				current_block.stylesheet->specificity_offset = rule_count;
+				style_sheets.push_back(std::move(current_block));
+				current_block = {};
 
-					rule_count++;
-				}
-				else if (token == '@')
+				inside_media_block = false;
+				break;
+			}
+			else
+			{
+				Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing stylesheet at %s:%d. Trying to proceed.", token, stream_file_name.c_str(), line_number);
+			}
+		}
+		break;
+		case State::AtRuleIdentifier:
+		{
+			if (token == '{')
+			{					
+				// Initialize current block if not present
+				if (!current_block.stylesheet)
 				{
-					state = State::AtRuleIdentifier;
+					current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet())};
 				}
-				else if (inside_media_block && token == '}')
-				{
-					// Complete current block
-					PostprocessKeyframes(current_block.stylesheet->keyframes);
-					current_block.stylesheet->specificity_offset = rule_count;
-					style_sheets.push_back(std::move(current_block));
-					current_block = {};
 
-					inside_media_block = false;
-					break;
+				const String at_rule_identifier = StringUtilities::StripWhitespace(pre_token_str.substr(0, pre_token_str.find(' ')));
+				at_rule_name = StringUtilities::StripWhitespace(pre_token_str.substr(at_rule_identifier.size()));
+
+				if (at_rule_identifier == "keyframes")
+				{
+					state = State::KeyframeBlock;
 				}
-				else
+				else if (at_rule_identifier == "decorator")
 				{
-					Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing stylesheet at %s:%d. Trying to proceed.", token, stream_file_name.c_str(), line_number);
+					auto source = MakeShared<PropertySource>(stream_file_name, (int)line_number, pre_token_str);
+					ParseDecoratorBlock(at_rule_name, current_block.stylesheet->decorator_map, *current_block.stylesheet, source);
+					
+					at_rule_name.clear();
+					state = State::Global;
 				}
-			}
-			break;
-			case State::AtRuleIdentifier:
-			{
-				if (token == '{')
-				{					
-					// Initialize current block if not present
-					if (!current_block.stylesheet)
-					{
-						current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet())};
-					}
-
-					const String at_rule_identifier = StringUtilities::StripWhitespace(pre_token_str.substr(0, pre_token_str.find(' ')));
-					at_rule_name = StringUtilities::StripWhitespace(pre_token_str.substr(at_rule_identifier.size()));
+				else if (at_rule_identifier == "spritesheet")
+				{
+					// The spritesheet parser is reasonably heavy to initialize, so we make it a static global.
+					std::lock_guard<std::mutex> lock(spritesheet_property_parser_mutex);
+					ReadProperties(*spritesheet_property_parser);
 
-					if (at_rule_identifier == "keyframes")
+					const String& image_source = spritesheet_property_parser->GetImageSource();
+					const SpriteDefinitionList& sprite_definitions = spritesheet_property_parser->GetSpriteDefinitions();
+					const float image_resolution_factor = spritesheet_property_parser->GetImageResolutionFactor();
+					
+					if (sprite_definitions.empty())
 					{
-						state = State::KeyframeBlock;
+						Log::Message(Log::LT_WARNING, "Spritesheet '%s' has no sprites defined, ignored. At %s:%d", at_rule_name.c_str(), stream_file_name.c_str(), line_number);
 					}
-					else if (at_rule_identifier == "decorator")
+					else if (image_source.empty())
 					{
-						auto source = MakeShared<PropertySource>(stream_file_name, (int)line_number, pre_token_str);
-						ParseDecoratorBlock(at_rule_name, current_block.stylesheet->decorator_map, *current_block.stylesheet, source);
-						
-						at_rule_name.clear();
-						state = State::Global;
+						Log::Message(Log::LT_WARNING, "No image source (property 'src') specified for spritesheet '%s'. At %s:%d", at_rule_name.c_str(), stream_file_name.c_str(), line_number);
 					}
-					else if (at_rule_identifier == "spritesheet")
+					else if (image_resolution_factor <= 0.0f || image_resolution_factor >= 100.f)
 					{
-						// The spritesheet parser is reasonably heavy to initialize, so we make it a static global.
-						ReadProperties(*spritesheet_property_parser);
-
-						const String& image_source = spritesheet_property_parser->GetImageSource();
-						const SpriteDefinitionList& sprite_definitions = spritesheet_property_parser->GetSpriteDefinitions();
-						const float image_resolution_factor = spritesheet_property_parser->GetImageResolutionFactor();
-						
-						if (sprite_definitions.empty())
-						{
-							Log::Message(Log::LT_WARNING, "Spritesheet '%s' has no sprites defined, ignored. At %s:%d", at_rule_name.c_str(), stream_file_name.c_str(), line_number);
-						}
-						else if (image_source.empty())
-						{
-							Log::Message(Log::LT_WARNING, "No image source (property 'src') specified for spritesheet '%s'. At %s:%d", at_rule_name.c_str(), stream_file_name.c_str(), line_number);
-						}
-						else if (image_resolution_factor <= 0.0f || image_resolution_factor >= 100.f)
-						{
-							Log::Message(Log::LT_WARNING, "Spritesheet resolution (property 'resolution') value must be larger than 0.0 and smaller than 100.0, given %g. In spritesheet '%s'. At %s:%d", image_resolution_factor, at_rule_name.c_str(), stream_file_name.c_str(), line_number);
-						}
-						else
-						{
-							const float display_scale = 1.0f / image_resolution_factor;
-							current_block.stylesheet->spritesheet_list.AddSpriteSheet(at_rule_name, image_source, stream_file_name, (int)line_number, display_scale, sprite_definitions);
-						}
-
-						spritesheet_property_parser->Clear();
-						at_rule_name.clear();
-						state = State::Global;
-					}
-					else if (at_rule_identifier == "media")
-					{
-						// complete the current "global" block if present and start a new block
-						if (current_block.stylesheet)
-						{
-							PostprocessKeyframes(current_block.stylesheet->keyframes);
-							current_block.stylesheet->specificity_offset = rule_count;
-							style_sheets.push_back(std::move(current_block));
-							current_block = {};
-						}
-
-						// parse media query list into block
-						PropertyDictionary feature_map;
-						ParseMediaFeatureMap(feature_map, at_rule_name);
-						current_block = {std::move(feature_map), UniquePtr<StyleSheet>(new StyleSheet())};
-
-						inside_media_block = true;
-						state = State::Global;
+						Log::Message(Log::LT_WARNING, "Spritesheet resolution (property 'resolution') value must be larger than 0.0 and smaller than 100.0, given %g. In spritesheet '%s'. At %s:%d", image_resolution_factor, at_rule_name.c_str(), stream_file_name.c_str(), line_number);
 					}
 					else
 					{
-						// Invalid identifier, should ignore
-						at_rule_name.clear();
-						state = State::Global;
-						Log::Message(Log::LT_WARNING, "Invalid at-rule identifier '%s' found in stylesheet at %s:%d", at_rule_identifier.c_str(), stream_file_name.c_str(), line_number);
+						const float display_scale = 1.0f / image_resolution_factor;
+						current_block.stylesheet->spritesheet_list.AddSpriteSheet(at_rule_name, image_source, stream_file_name, (int)line_number, display_scale, sprite_definitions);
 					}
 
+					spritesheet_property_parser->Clear();
+					at_rule_name.clear();
+					state = State::Global;
 				}
-				else
+				else if (at_rule_identifier == "media")
 				{
-					Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing at-rule identifier in stylesheet at %s:%d", token, stream_file_name.c_str(), line_number);
-					state = State::Invalid;
-				}
-			}
-			break;
-			case State::KeyframeBlock:
-			{
-				if (token == '{')
-				{	
-					// Initialize current block if not present
-					if (!current_block.stylesheet)
+					// complete the current "global" block if present and start a new block
+					if (current_block.stylesheet)
 					{
-						current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet())};
+						PostprocessKeyframes(current_block.stylesheet->keyframes);
+						current_block.stylesheet->specificity_offset = rule_count;
+						style_sheets.push_back(std::move(current_block));
+						current_block = {};
 					}
 
-					// Each keyframe in keyframes has its own block which is processed here
-					PropertyDictionary properties;
-					PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
-					if(!ReadProperties(parser))
-						continue;
+					// parse media query list into block
+					PropertyDictionary feature_map;
+					ParseMediaFeatureMap(feature_map, at_rule_name);
+					current_block = {std::move(feature_map), UniquePtr<StyleSheet>(new StyleSheet())};
 
-					if (!ParseKeyframeBlock(current_block.stylesheet->keyframes, at_rule_name, pre_token_str, properties))
-						continue;
+					inside_media_block = true;
+					state = State::Global;
 				}
-				else if (token == '}')
+				else
 				{
+					// Invalid identifier, should ignore
 					at_rule_name.clear();
 					state = State::Global;
+					Log::Message(Log::LT_WARNING, "Invalid at-rule identifier '%s' found in stylesheet at %s:%d", at_rule_identifier.c_str(), stream_file_name.c_str(), line_number);
 				}
-				else
+
+			}
+			else
+			{
+				Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing at-rule identifier in stylesheet at %s:%d", token, stream_file_name.c_str(), line_number);
+				state = State::Invalid;
+			}
+		}
+		break;
+		case State::KeyframeBlock:
+		{
+			if (token == '{')
+			{	
+				// Initialize current block if not present
+				if (!current_block.stylesheet)
 				{
-					Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing keyframe block in stylesheet at %s:%d", token, stream_file_name.c_str(), line_number);
-					state = State::Invalid;
+					current_block = {PropertyDictionary{}, UniquePtr<StyleSheet>(new StyleSheet())};
 				}
+
+				// Each keyframe in keyframes has its own block which is processed here
+				PropertyDictionary properties;
+				PropertySpecificationParser parser(properties, StyleSheetSpecification::GetPropertySpecification());
+				if(!ReadProperties(parser))
+					continue;
+
+				if (!ParseKeyframeBlock(current_block.stylesheet->keyframes, at_rule_name, pre_token_str, properties))
+					continue;
 			}
-			break;
-			default:
-				RMLUI_ERROR;
+			else if (token == '}')
+			{
+				at_rule_name.clear();
+				state = State::Global;
+			}
+			else
+			{
+				Log::Message(Log::LT_WARNING, "Invalid character '%c' found while parsing keyframe block in stylesheet at %s:%d", token, stream_file_name.c_str(), line_number);
 				state = State::Invalid;
-				break;
 			}
-
-			if (state == State::Invalid)
-				break;
+		}
+		break;
+		default:
+			RMLUI_ERROR;
+			state = State::Invalid;
+			break;
 		}
 
 		if (state == State::Invalid)
 			break;
-	}	
+	}
 
 	// Complete last block if present
 	if (current_block.stylesheet)
@@ -735,18 +755,16 @@ bool StyleSheetParser::Parse(MediaBlockList& style_sheets, Stream* _stream, int
 		style_sheets.push_back(std::move(current_block));
 	}
 
+	ImportPendingRules(pending_rules, log_capture);
+
 	return !style_sheets.empty();
 }
 
 bool StyleSheetParser::ParseProperties(PropertyDictionary& parsed_properties, const String& properties)
 {
-	RMLUI_ASSERT(!stream);
-	StreamMemory stream_owner((const byte*)properties.c_str(), properties.size());
-	stream = &stream_owner;
+	LoadBuffer(properties.data(), properties.size());
 	PropertySpecificationParser parser(parsed_properties, StyleSheetSpecification::GetPropertySpecification());
-	bool success = ReadProperties(parser);
-	stream = nullptr;
-	return success;
+	return ReadProperties(parser);
 }
 
 StyleSheetNodeListRaw StyleSheetParser::ConstructNodes(StyleSheetNode& root_node, const String& selectors)
@@ -770,6 +788,13 @@ StyleSheetNodeListRaw StyleSheetParser::ConstructNodes(StyleSheetNode& root_node
 }
 
 bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
+{
+	const bool result = ReadProperties(property_parser, parse_buffer_pos);
+	line_number = GetLineNumber(parse_buffer_pos);
+	return result;
+}
+
+bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser, size_t& pos) const
 {
 	RMLUI_ZoneScoped;
 
@@ -779,11 +804,26 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 	enum ParseState { NAME, VALUE, QUOTE };
 	ParseState state = NAME;
 
-	char character;
-	char previous_character = 0;
-	while (ReadCharacter(character))
+	const char* const buffer_begin = parse_buffer.data();
+	const char* const buffer_end = buffer_begin + parse_buffer.size();
+	const char* cursor = buffer_begin + pos;
+
+	bool end_of_block = false;
+	while (!end_of_block && cursor < buffer_end)
 	{
-		parse_buffer_pos++;
+		// Copy all the characters up to the next one of interest in the current state at once.
+		const char* delimiters = (state == NAME ? ";}:" : (state == VALUE ? ";}\"" : "\"}"));
+		const char* delimiter = FindFirstOf(cursor, buffer_end, delimiters);
+		(state == NAME ? name : value).append(cursor, delimiter);
+
+		if (delimiter == buffer_end)
+		{
+			cursor = buffer_end;
+			break;
+		}
+
+		const char character = *delimiter;
+		cursor = delimiter + 1;
 
 		switch (state)
 		{
@@ -794,7 +834,7 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 					name = StringUtilities::StripWhitespace(name);
 					if (!name.empty())
 					{
-						Log::Message(Log::LT_WARNING, "Found name with no value while parsing property declaration '%s' at %s:%d", name.c_str(), stream_file_name.c_str(), line_number);
+						Log::Message(Log::LT_WARNING, "Found name with no value while parsing property declaration '%s' at %s:%d", name.c_str(), stream_file_name.c_str(), GetLineNumber(delimiter - buffer_begin));
 						name.clear();
 					}
 				}
@@ -802,16 +842,15 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 				{
 					name = StringUtilities::StripWhitespace(name);
 					if (!name.empty())
-						Log::Message(Log::LT_WARNING, "End of rule encountered while parsing property declaration '%s' at %s:%d", name.c_str(), stream_file_name.c_str(), line_number);
+						Log::Message(Log::LT_WARNING, "End of rule encountered while parsing property declaration '%s' at %s:%d", name.c_str(), stream_file_name.c_str(), GetLineNumber(delimiter - buffer_begin));
+					pos = size_t(cursor - buffer_begin);
 					return true;
 				}
-				else if (character == ':')
+				else
 				{
 					name = StringUtilities::StripWhitespace(name);
 					state = VALUE;
 				}
-				else
-					name += character;
 			}
 			break;
 			
@@ -822,7 +861,7 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 					value = StringUtilities::StripWhitespace(value);
 
 					if (!property_parser.Parse(name, value))
-						Log::Message(Log::LT_WARNING, "Syntax error parsing property declaration '%s: %s;' in %s: %d.", name.c_str(), value.c_str(), stream_file_name.c_str(), line_number);
+						Log::Message(Log::LT_WARNING, "Syntax error parsing property declaration '%s: %s;' in %s: %d.", name.c_str(), value.c_str(), stream_file_name.c_str(), GetLineNumber(delimiter - buffer_begin));
 
 					name.clear();
 					value.clear();
@@ -830,13 +869,12 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 				}
 				else if (character == '}')
 				{
-					break;
+					end_of_block = true;
 				}
 				else
 				{
 					value += character;
-					if (character == '"')
-						state = QUOTE;
+					state = QUOTE;
 				}
 			}
 			break;
@@ -844,32 +882,86 @@ bool StyleSheetParser::ReadProperties(AbstractPropertyParser& property_parser)
 			case QUOTE:
 			{
 				value += character;
-				if (character == '"' && previous_character != '/')
+				if (character == '}')
+					end_of_block = true;
+				else if (delimiter[-1] != '/')
 					state = VALUE;
 			}
 			break;
 		}
-
-		if (character == '}')
-			break;
-		previous_character = character;
 	}
 
+	pos = size_t(cursor - buffer_begin);
+
 	if (state == VALUE && !name.empty() && !value.empty())
 	{
 		value = StringUtilities::StripWhitespace(value);
 
 		if (!property_parser.Parse(name, value))
-			Log::Message(Log::LT_WARNING, "Syntax error parsing property declaration '%s: %s;' in %s: %d.", name.c_str(), value.c_str(), stream_file_name.c_str(), line_number);
+			Log::Message(Log::LT_WARNING, "Syntax error parsing property declaration '%s: %s;' in %s: %d.", name.c_str(), value.c_str(), stream_file_name.c_str(), GetLineNumber(pos));
 	}
 	else if (!name.empty() || !value.empty())
 	{
-		Log::Message(Log::LT_WARNING, "Invalid property declaration '%s':'%s' at %s:%d", name.c_str(), value.c_str(), stream_file_name.c_str(), line_number);
+		Log::Message(Log::LT_WARNING, "Invalid property declaration '%s':'%s' at %s:%d", name.c_str(), value.c_str(), stream_file_name.c_str(), GetLineNumber(pos));
 	}
 	
 	return true;
 }
 
+void StyleSheetParser::ImportPendingRules(const PendingRuleList& pending_rules, LogCapture& log_capture) const
+{
+	RMLUI_ZoneScoped;
+
+	const int num_rules = (int)pending_rules.size();
+	Vector<PropertyDictionary> rule_properties(num_rules);
+	Vector<CapturedLogMessageList> rule_messages(num_rules);
+
+	// The properties of each rule are parsed independently, so large style sheets can be parsed in parallel. The tasks
+	// must not log directly, as the system interface is only called from this thread.
+	constexpr int rules_per_task = 64;
+
+	GetTaskInterface()->ParallelFor(0, num_rules, rules_per_task, [&](int begin, int end) {
+		for (int i = begin; i < end; i++)
+		{
+			LogCapture rule_log_capture;
+			PropertySpecificationParser parser(rule_properties[i], StyleSheetSpecification::GetPropertySpecification());
+			size_t pos = pending_rules[i].properties_pos;
+			ReadProperties(parser, pos);
+			rule_messages[i] = std::move(rule_log_capture.GetMessages());
+		}
+	});
+
+	// Report the messages of each rule after those logged before it while scanning the sheet.
+	const CapturedLogMessageList& scan_messages = log_capture.GetMessages();
+	size_t scan_message_index = 0;
+	for (int i = 0; i < num_rules; i++)
+	{
+		for (; scan_message_index < pending_rules[i].num_preceding_messages; scan_message_index++)
+			log_capture.Forward(scan_messages[scan_message_index]);
+		for (const CapturedLogMessage& message : rule_messages[i])
+			log_capture.Forward(message);
+	}
+	for (; scan_message_index < scan_messages.size(); scan_message_index++)
+		log_capture.Forward(scan_messages[scan_message_index]);
+
+	// Add style nodes to the root of the tree, in order, as the nodes are shared between rules.
+	for (int i = 0; i < num_rules; i++)
+	{
+		const PendingRule& rule = pending_rules[i];
+		PropertyDictionary& properties = rule_properties[i];
+
+		StringList rule_name_list;
+		StringUtilities::ExpandString(rule_name_list, rule.rule_names);
+
+		for (const String& rule_name : rule_name_list)
+		{
+			auto source = MakeShared<PropertySource>(stream_file_name, rule.line_number, rule_name);
+			properties.SetSourceOfAllProperties(source);
+			ImportProperties(rule.style_sheet->root.get(), rule_name, properties, rule.specificity);
+		}
+	}
+}
+
 StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, String rule_name, const PropertyDictionary& properties, int rule_specificity)
 {
 	StyleSheetNode* leaf_node = node;
@@ -964,114 +1056,80 @@ StyleSheetNode* StyleSheetParser::ImportProperties(StyleSheetNode* node, String
 
 char StyleSheetParser::FindToken(String& buffer, const char* tokens, bool remove_token)
 {
-	buffer.clear();
-	char character;
-	while (ReadCharacter(character))
-	{
-		if (strchr(tokens, character) != nullptr)
-		{
-			if (remove_token)
-				parse_buffer_pos++;
-			return character;
-		}
-		else
-		{
-			buffer += character;
-			parse_buffer_pos++;
-		}
-	}
+	const char* const buffer_begin = parse_buffer.data();
+	const char* const buffer_end = buffer_begin + parse_buffer.size();
+	const char* cursor = buffer_begin + parse_buffer_pos;
+
+	const char* token = FindFirstOf(cursor, buffer_end, tokens);
+	buffer.assign(cursor, token);
+
+	parse_buffer_pos = size_t(token - buffer_begin);
+	line_number = GetLineNumber(parse_buffer_pos);
 
-	return 0;
+	if (token == buffer_end)
+		return 0;
+
+	if (remove_token)
+		parse_buffer_pos++;
+
+	return *token;
 }
 
-// Attempts to find the next character in the active stream.
-bool StyleSheetParser::ReadCharacter(char& buffer)
+void StyleSheetParser::LoadBuffer(const char* data, size_t size)
 {
-	bool comment = false;
+	RMLUI_ZoneScoped;
 
-	// Continuously fill the buffer until either we run out of
-	// stream or we find the requested token
-	do
-	{
-		while (parse_buffer_pos < parse_buffer.size())
+	parse_buffer.clear();
+	parse_buffer.reserve(size);
+	parse_buffer_pos = 0;
+	line_breaks.clear();
+
+	// Appends the given range to the parse buffer, leaving out and recording its line breaks.
+	auto AppendText = [this](const char* begin, const char* end) {
+		while (const char* line_break = (const char*)memchr(begin, '\n', end - begin))
 		{
-			if (parse_buffer[parse_buffer_pos] == '\n')
-				line_number++;
-			else if (comment)
-			{
-				// Check for closing comment
-				if (parse_buffer[parse_buffer_pos] == '*')
-				{
-					parse_buffer_pos++;
-					if (parse_buffer_pos >= parse_buffer.size())
-					{
-						if (!FillBuffer())
-							return false;
-					}
+			parse_buffer.append(begin, line_break);
+			line_breaks.push_back(parse_buffer.size());
+			begin = line_break + 1;
+		}
+		parse_buffer.append(begin, end);
+	};
 
-					if (parse_buffer[parse_buffer_pos] == '/')
-						comment = false;
-				}
-			}
-			else
-			{
-				// Check for an opening comment
-				if (parse_buffer[parse_buffer_pos] == '/')
-				{
-					parse_buffer_pos++;
-					if (parse_buffer_pos >= parse_buffer.size())
-					{
-						if (!FillBuffer())
-						{
-							buffer = '/';
-							parse_buffer = "/";
-							return true;
-						}
-					}
-					
-					if (parse_buffer[parse_buffer_pos] == '*')
-						comment = true;
-					else
-					{
-						buffer = '/';
-						if (parse_buffer_pos == 0)
-							parse_buffer.insert(parse_buffer_pos, 1, '/');
-						else
-							parse_buffer_pos--;
-						return true;
-					}
-				}
+	const char* cursor = data;
+	const char* const end = data + size;
 
-				if (!comment)
-				{
-					// If we find a character, return it
-					buffer = parse_buffer[parse_buffer_pos];
-					return true;
-				}
-			}
+	while (cursor < end)
+	{
+		// Find the start of the next comment.
+		const char* comment = cursor;
+		while ((comment = (const char*)memchr(comment, '/', end - comment)) && (comment + 1 == end || comment[1] != '*'))
+			comment++;
 
-			parse_buffer_pos++;
+		if (!comment)
+		{
+			AppendText(cursor, end);
+			break;
 		}
-	}
-	while (FillBuffer());
 
-	return false;
-}
+		AppendText(cursor, comment);
 
-// Fills the internal buffer with more content
-bool StyleSheetParser::FillBuffer()
-{
-	// If theres no data to process, abort
-	if (stream->IsEOS())
-		return false;
+		// Find the end of the comment, or else it runs until the end of the data.
+		const char* comment_end = comment + 2;
+		while ((comment_end = (const char*)memchr(comment_end, '*', end - comment_end)) && (comment_end + 1 == end || comment_end[1] != '/'))
+			comment_end++;
 
-	// Read in some data (4092 instead of 4096 to avoid the buffer growing when we have to add back
-	// a character after a failed comment parse.)
-	parse_buffer.clear();
-	bool read = stream->Read(parse_buffer, 4092) > 0;
-	parse_buffer_pos = 0;
+		cursor = (comment_end ? comment_end + 2 : end);
 
-	return read;
+		// Only the line breaks inside the comment are kept, for reporting line numbers.
+		for (const char* line_break = comment; (line_break = (const char*)memchr(line_break, '\n', cursor - line_break)) != nullptr; line_break++)
+			line_breaks.push_back(parse_buffer.size());
+	}
+}
+
+int StyleSheetParser::GetLineNumber(size_t pos) const
+{
+	// Count the line breaks before the given position.
+	return begin_line_number + int(std::upper_bound(line_breaks.begin(), line_breaks.end(), pos) - line_breaks.begin());
 }
 
 } // namespace Rml
@@ -36,9 +36,11 @@ namespace Rml {
 
 class PropertyDictionary;
 class Stream;
+class StyleSheet;
 class StyleSheetNode;
 class AbstractPropertyParser;
 struct PropertySource;
+class LogCapture;
 using StyleSheetNodeListRaw = Vector<StyleSheetNode*>;
 
 /**
@@ -78,21 +80,49 @@ public:
 	static void Shutdown();
 
 private:
-	// Stream we're parsing from.
-	Stream* stream;
-	// Parser memory buffer.
+	// Parser memory buffer, holding the whole style sheet with comments and line breaks removed.
 	String parse_buffer;
 	// How far we've read through the buffer.
 	size_t parse_buffer_pos;
+	// The positions in the parse buffer where line breaks were removed, in increasing order.
+	Vector<size_t> line_breaks;
 
 	// The name of the file we're parsing.
 	String stream_file_name;
+	// The line number of the beginning of the parse buffer.
+	int begin_line_number;
 	// Current line number we're parsing.
 	int line_number;
 
+	// A style rule whose properties are parsed after the rest of the style sheet, possibly in parallel with other rules.
+	struct PendingRule {
+		StyleSheet* style_sheet;
+		String rule_names;
+		int line_number;
+		int specificity;
+		size_t properties_pos;
+		// The number of messages logged while scanning the sheet before this rule.
+		size_t num_preceding_messages;
+	};
+	using PendingRuleList = Vector<PendingRule>;
+
+	// Loads the given data into the parse buffer, removing comments and line breaks.
+	void LoadBuffer(const char* data, size_t size);
+	// Returns the line number of the given position in the parse buffer.
+	int GetLineNumber(size_t pos) const;
+
 	// Parses properties from the parse buffer.
 	// @param property_parser An abstract parser which specifies how the properties are parsed and stored.
 	bool ReadProperties(AbstractPropertyParser& property_parser);
+	// Parses properties from the given position in the parse buffer, up to and including the end of the block. Does
+	// not modify the parser, so that several blocks can be read in parallel.
+	// @param property_parser An abstract parser which specifies how the properties are parsed and stored.
+	// @param pos The position to start reading from, set to the position after the block on return.
+	bool ReadProperties(AbstractPropertyParser& property_parser, size_t& pos) const;
+
+	// Parses the properties of the pending rules, in parallel if possible, and imports them into their style sheets.
+	// Messages logged while parsing are reported through the log capture of the sheet, in source order.
+	void ImportPendingRules(const PendingRuleList& pending_rules, LogCapture& log_capture) const;
 
 	// Import properties into the stylesheet node
 	// @param node Node to import into
@@ -111,20 +141,12 @@ private:
 	// Attempts to parse the properties of a @media query
 	bool ParseMediaFeatureMap(PropertyDictionary& properties, const String& rules);
 
-	// Attempts to find one of the given character tokens in the active stream
+	// Attempts to find one of the given character tokens in the parse buffer
 	// If it's found, buffer is filled with all content up until the token
 	// @param buffer The buffer that receives the content
 	// @param characters The character tokens to find
 	// @param remove_token If the token that caused the find to stop should be removed from the stream
 	char FindToken(String& buffer, const char* tokens, bool remove_token);
-
-	// Attempts to find the next character in the active stream.
-	// If it's found, buffer is filled with the character
-	// @param buffer The buffer that receives the character, if read.
-	bool ReadCharacter(char& buffer);
-
-	// Fill the internal parse buffer
-	bool FillBuffer();
 };
 
 } // namespace Rml
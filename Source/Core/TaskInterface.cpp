@@ -0,0 +1,89 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../../Include/RmlUi/Core/TaskInterface.h"
+#include "../../Include/RmlUi/Core/Math.h"
+
+namespace Rml {
+
+TaskInterface::TaskInterface()
+{
+}
+
+TaskInterface::~TaskInterface()
+{
+}
+
+int TaskInterface::GetConcurrency()
+{
+	return 1;
+}
+
+TaskInterface::TaskHandle TaskInterface::Submit(Function<void()> task)
+{
+	task();
+	return 0;
+}
+
+void TaskInterface::Wait(TaskHandle /*handle*/)
+{
+}
+
+void TaskInterface::ParallelFor(int begin, int end, int grain_size, const Function<void(int, int)>& function)
+{
+	const int num_indices = end - begin;
+	if (num_indices <= 0)
+		return;
+
+	grain_size = Math::Max(grain_size, 1);
+	const int num_chunks = Math::Min(GetConcurrency(), (num_indices + grain_size - 1) / grain_size);
+
+	if (num_chunks <= 1)
+	{
+		function(begin, end);
+		return;
+	}
+
+	const int chunk_size = (num_indices + num_chunks - 1) / num_chunks;
+
+	Vector<TaskHandle> handles;
+	handles.reserve(num_chunks - 1);
+
+	for (int chunk_begin = begin + chunk_size; chunk_begin < end; chunk_begin += chunk_size)
+	{
+		const int chunk_end = Math::Min(chunk_begin + chunk_size, end);
+		handles.push_back(Submit([&function, chunk_begin, chunk_end]() { function(chunk_begin, chunk_end); }));
+	}
+
+	function(begin, Math::Min(begin + chunk_size, end));
+
+	for (TaskHandle handle : handles)
+		Wait(handle);
+}
+
+} // namespace Rml
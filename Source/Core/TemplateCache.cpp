@@ -66,9 +66,12 @@ void TemplateCache::Shutdown()
 Template* TemplateCache::LoadTemplate(const String& name)
 {
 	// Check if the template is already loaded
-	Templates::iterator itr = instance->templates.find(name);
-	if (itr != instance->templates.end())
-		return (*itr).second;
+	{
+		std::lock_guard<std::mutex> lock(instance->mutex);
+		Templates::iterator itr = instance->templates.find(name);
+		if (itr != instance->templates.end())
+			return (*itr).second;
+	}
 
 	// Nope, we better load it
 	Template* new_template = nullptr;
@@ -90,8 +93,18 @@ Template* TemplateCache::LoadTemplate(const String& name)
 		}
 		else
 		{
-			instance->templates[name] = new_template;
-			instance->template_ids[new_template->GetName()] = new_template;
+			std::lock_guard<std::mutex> lock(instance->mutex);
+			auto result = instance->templates.emplace(name, new_template);
+			if (result.second)
+			{
+				instance->template_ids[new_template->GetName()] = new_template;
+			}
+			else
+			{
+				// Another thread loaded the same template in the meantime, use that one instead.
+				delete new_template;
+				new_template = result.first->second;
+			}
 		}
 	}
 	else
@@ -105,6 +118,7 @@ Template* TemplateCache::LoadTemplate(const String& name)
 Template* TemplateCache::GetTemplate(const String& name)
 {
 	// Check if the template is already loaded
+	std::lock_guard<std::mutex> lock(instance->mutex);
 	Templates::iterator itr = instance->template_ids.find(name);
 	if (itr != instance->template_ids.end())
 		return (*itr).second;
@@ -114,6 +128,7 @@ Template* TemplateCache::GetTemplate(const String& name)
 
 void TemplateCache::Clear()
 {
+	std::lock_guard<std::mutex> lock(instance->mutex);
 	for (Templates::iterator i = instance->templates.begin(); i != instance->templates.end(); ++i)
 		delete (*i).second;
 
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_TEMPLATECACHE_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -63,6 +64,9 @@ private:
 	using Templates = UnorderedMap<String, Template*>;
 	Templates templates;
 	Templates template_ids;
+
+	// Guards the template maps, templates may be loaded by contexts on different threads.
+	std::mutex mutex;
 };
 
 } // namespace Rml
@@ -28,9 +28,11 @@
 
 #include "TextureDatabase.h"
 #include "TextureResource.h"
+#include "MemoryUsage.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/StringUtilities.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include <algorithm>
 
 namespace Rml {
 
@@ -86,6 +88,8 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 	else
 		GetSystemInterface()->JoinPath(path, StringUtilities::Replace(source_directory, '|', ':'), source);
 
+	std::lock_guard<std::recursive_mutex> lock(texture_database->mutex);
+
 	TextureMap::iterator iterator = texture_database->textures.find(path);
 	if (iterator != texture_database->textures.end())
 	{
@@ -102,13 +106,19 @@ SharedPtr<TextureResource> TextureDatabase::Fetch(const String& source, const St
 void TextureDatabase::AddCallbackTexture(TextureResource* texture)
 {
 	if (texture_database)
+	{
+		std::lock_guard<std::recursive_mutex> lock(texture_database->mutex);
 		texture_database->callback_textures.insert(texture);
+	}
 }
 
 void TextureDatabase::RemoveCallbackTexture(TextureResource* texture)
 {
 	if (texture_database)
+	{
+		std::lock_guard<std::recursive_mutex> lock(texture_database->mutex);
 		texture_database->callback_textures.erase(texture);
+	}
 }
 
 StringList TextureDatabase::GetSourceList()
@@ -117,6 +127,8 @@ StringList TextureDatabase::GetSourceList()
 	
 	if (texture_database)
 	{
+		std::lock_guard<std::recursive_mutex> lock(texture_database->mutex);
+
 		result.reserve(texture_database->textures.size());
 
 		for (const auto& pair : texture_database->textures)
@@ -130,6 +142,8 @@ void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 {
 	if (texture_database)
 	{
+		std::lock_guard<std::recursive_mutex> lock(texture_database->mutex);
+
 		for (const auto& texture : texture_database->textures)
 			texture.second->Release(render_interface);
 
@@ -138,4 +152,39 @@ void TextureDatabase::ReleaseTextures(RenderInterface* render_interface)
 	}
 }
 
+void TextureDatabase::GetLoadedDimensions(Vector<Vector2i>& dimensions)
+{
+	if (texture_database)
+	{
+		std::lock_guard<std::recursive_mutex> lock(texture_database->mutex);
+
+		for (const auto& pair : texture_database->textures)
+			pair.second->GetLoadedDimensions(dimensions);
+		for (const TextureResource* texture : texture_database->callback_textures)
+			texture->GetLoadedDimensions(dimensions);
+	}
+}
+
+void MemoryUsage::AddTextures(MemoryStatistics& statistics)
+{
+	Vector<Vector2i> dimensions;
+	TextureDatabase::GetLoadedDimensions(dimensions);
+
+	// Group the textures by their dimensions.
+	std::sort(dimensions.begin(), dimensions.end(), [](Vector2i a, Vector2i b) { return a.x < b.x || (a.x == b.x && a.y < b.y); });
+
+	for (Vector2i texture_dimensions : dimensions)
+	{
+		if (statistics.textures.empty() || statistics.textures.back().dimensions != texture_dimensions)
+		{
+			statistics.textures.emplace_back();
+			statistics.textures.back().dimensions = texture_dimensions;
+		}
+
+		MemoryStatistics::TextureGroup& group = statistics.textures.back();
+		group.count += 1;
+		group.bytes += size_t(texture_dimensions.x) * size_t(texture_dimensions.y) * 4;
+	}
+}
+
 } // namespace Rml
@@ -30,6 +30,7 @@
 #define RMLUI_CORE_TEXTUREDATABASE_H
 
 #include "../../Include/RmlUi/Core/Types.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -64,6 +65,9 @@ public:
 	/// Return a list of all texture sources currently in the database.
 	static StringList GetSourceList();
 
+	/// Adds the dimensions of every loaded texture in the database to the list, including callback textures.
+	static void GetLoadedDimensions(Vector<Vector2i>& dimensions);
+
 private:
 	TextureDatabase();
 	~TextureDatabase();
@@ -73,6 +77,9 @@ private:
 
     using CallbackTextureMap = UnorderedSet< TextureResource* >;
     CallbackTextureMap callback_textures;
+
+	// Guards the texture maps, textures may be fetched and generated by contexts on different threads.
+	std::recursive_mutex mutex;
 };
 
 } // namespace Rml
@@ -73,6 +73,8 @@ void TextureResource::Reset()
 // Returns the resource's underlying texture.
 TextureHandle TextureResource::GetHandle(RenderInterface* render_interface)
 {
+	std::lock_guard<std::mutex> lock(mutex);
+
 	auto texture_iterator = texture_data.find(render_interface);
 	if (texture_iterator == texture_data.end())
 	{
@@ -86,6 +88,8 @@ TextureHandle TextureResource::GetHandle(RenderInterface* render_interface)
 // Returns the dimensions of the resource's texture.
 Vector2i TextureResource::GetDimensions(RenderInterface* render_interface)
 {
+	std::lock_guard<std::mutex> lock(mutex);
+
 	auto texture_iterator = texture_data.find(render_interface);
 	if (texture_iterator == texture_data.end())
 	{
@@ -102,9 +106,22 @@ const String& TextureResource::GetSource() const
 	return source;
 }
 
+void TextureResource::GetLoadedDimensions(Vector<Vector2i>& dimensions) const
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	for (const auto& pair : texture_data)
+	{
+		if (pair.second.first)
+			dimensions.push_back(pair.second.second);
+	}
+}
+
 // Releases the texture's handle.
 void TextureResource::Release(RenderInterface* render_interface)
 {
+	std::lock_guard<std::mutex> lock(mutex);
+
 	if (!render_interface)
 	{
 		for (auto& interface_data_pair : texture_data)
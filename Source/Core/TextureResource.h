@@ -31,6 +31,7 @@
 
 #include "../../Include/RmlUi/Core/Traits.h"
 #include "../../Include/RmlUi/Core/Texture.h"
+#include <mutex>
 
 namespace Rml {
 
@@ -41,7 +42,7 @@ namespace Rml {
 	@author Peter Curry
  */
 
-class TextureResource : public NonCopyMoveable
+class TextureResource : public NonCopyMoveable, public Allocated<MemoryCategory::Texture>
 {
 public:
 	TextureResource();
@@ -62,6 +63,8 @@ public:
 
 	/// Returns the resource's source.
 	const String& GetSource() const;
+	/// Adds the dimensions of the texture loaded for each render interface to the list.
+	void GetLoadedDimensions(Vector<Vector2i>& dimensions) const;
 
 	/// Releases the texture's handle.
 	void Release(RenderInterface* render_interface = nullptr);
@@ -79,6 +82,9 @@ private:
 	TextureDataMap texture_data;
 
 	UniquePtr<TextureCallback> texture_callback;
+
+	// Guards the texture data, a resource may be shared by contexts rendering on different threads.
+	mutable std::mutex mutex;
 };
 
 } // namespace Rml
@@ -34,7 +34,7 @@
 
 namespace Rml {
 
-class TransformState
+class TransformState : public Allocated<MemoryCategory::Element>
 {
 public:
 
@@ -50,6 +50,10 @@ public:
 	// Returns a nullptr if there is no transform set, or the transform is singular.
 	const Matrix4f* GetInverseTransform() const;
 
+	// Sets the absolute offset of the owning element that the transform and perspective were calculated from.
+	void SetOffset(Vector2f in_offset) { offset = in_offset; }
+	Vector2f GetOffset() const { return offset; }
+
 
 private:
 	bool have_transform = false;
@@ -65,6 +69,8 @@ private:
 
 	// The inverse of the transform matrix for projecting points from screen space to the current element's space, such as used for picking elements.
 	mutable Matrix4f inverse_transform;
+
+	Vector2f offset;
 };
 
 } // namespace Rml
@@ -151,7 +151,7 @@ void WidgetScroll::Update()
 		{
 			if (!updated_time)
 			{
-				double current_time = Clock::GetElapsedTime();
+				double current_time = Clock::GetElapsedTime(parent->GetContext());
 				delta_time = float(current_time - last_update_time);
 				last_update_time = current_time;
 			}
@@ -164,6 +164,15 @@ void WidgetScroll::Update()
 			}
 		}
 	}
+	if (arrow_timers[0] > 0 || arrow_timers[1] > 0)
+		RequestScrollUpdate();
+}
+
+// Requests an update of the scrolled element, which in turn updates its scrollbars.
+void WidgetScroll::RequestScrollUpdate()
+{
+	if (Element* element_scroll = parent->GetParentNode())
+		element_scroll->RequestUpdate();
 }
 
 // Sets the position of the bar.
@@ -433,13 +442,15 @@ void WidgetScroll::ProcessEvent(Event& event)
 		if (event.GetTargetElement() == arrows[0])
 		{
 			arrow_timers[0] = DEFAULT_REPEAT_DELAY;
-			last_update_time = Clock::GetElapsedTime();
+			last_update_time = Clock::GetElapsedTime(parent->GetContext());
+			RequestScrollUpdate();
 			SetBarPosition(OnLineDecrement());
 		}
 		else if (event.GetTargetElement() == arrows[1])
 		{
 			arrow_timers[1] = DEFAULT_REPEAT_DELAY;
-			last_update_time = Clock::GetElapsedTime();
+			last_update_time = Clock::GetElapsedTime(parent->GetContext());
+			RequestScrollUpdate();
 			SetBarPosition(OnLineIncrement());
 		}
 	}
@@ -41,7 +41,7 @@ class Element;
 	@author Peter Curry
  */
 
-class WidgetScroll final : public EventListener
+class WidgetScroll final : public EventListener, public Allocated<MemoryCategory::Element>
 {
 public:
 	enum Orientation
@@ -100,6 +100,9 @@ private:
 	/// Handles events coming through from the slider's components.
 	void ProcessEvent(Event& event) override;
 
+	/// Requests an update of the scrolled element while the arrows are held down.
+	void RequestScrollUpdate();
+
 	/// Lays out and resizes the slider's internal elements.
 	/// @param[in] containing_block The padded box containing the slider. This is used to resolve relative properties.
 	/// @param[in] resize_element True to resize the parent slider element, false to only resize its components.
@@ -36,6 +36,7 @@
 #include "ElementContextHook.h"
 #include "ElementInfo.h"
 #include "ElementLog.h"
+#include "ElementPerformance.h"
 #include "FontSource.h"
 #include "Geometry.h"
 #include "MenuSource.h"
@@ -58,6 +59,7 @@ DebuggerPlugin::DebuggerPlugin()
 	menu_element = nullptr;
 	info_element = nullptr;
 	log_element = nullptr;
+	performance_element = nullptr;
 	hook_element = nullptr;
 
 	render_outlines = false;
@@ -84,7 +86,8 @@ bool DebuggerPlugin::Initialise(Context* context)
 
 	if (!LoadMenuElement() ||
 		!LoadInfoElement() ||
-		!LoadLogElement())
+		!LoadLogElement() ||
+		!LoadPerformanceElement())
 	{
 		Log::Message(Log::LT_ERROR, "Failed to initialise debugger, error while load debugger elements.");
 		return false;
@@ -142,6 +145,9 @@ bool DebuggerPlugin::SetContext(Context* context)
 		info_element->Reset();
 	}
 
+	if (performance_element)
+		performance_element->SetDebugContext(context);
+
 	debug_context = context;
 	return true;
 }
@@ -208,6 +214,13 @@ void DebuggerPlugin::Render()
 		info_element->RenderHoverElement();
 		info_element->RenderSourceElement();
 	}
+
+	// Render the performance overlay, the statistics of the debug context's previous frame are available at this point.
+	if (performance_element && performance_element->IsVisible())
+	{
+		performance_element->RecordFrame();
+		performance_element->RenderOverlay();
+	}
 }
 
 // Called when RmlUi shuts down.
@@ -218,6 +231,7 @@ void DebuggerPlugin::OnShutdown()
 	ReleaseElements();
 
 	hook_element_instancer.reset();
+	performance_element_instancer.reset();
 
 	delete this;
 }
@@ -268,6 +282,13 @@ void DebuggerPlugin::ProcessEvent(Event& event)
 			else
 				info_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
 		}
+		else if (event.GetTargetElement()->GetId() == "performance-button")
+		{
+			if (performance_element->IsVisible())
+				performance_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+			else
+				performance_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Visible));
+		}
 		else if (event.GetTargetElement()->GetId() == "outlines-button")
 		{
 			render_outlines = !render_outlines;
@@ -318,6 +339,9 @@ bool DebuggerPlugin::LoadMenuElement()
 	Element* element_info_button = menu_element->GetElementById("debug-info-button");
 	element_info_button->AddEventListener(EventId::Click, this);
 
+	Element* performance_button = menu_element->GetElementById("performance-button");
+	performance_button->AddEventListener(EventId::Click, this);
+
 	Element* outlines_button = menu_element->GetElementById("outlines-button");
 	outlines_button->AddEventListener(EventId::Click, this);
 
@@ -371,6 +395,27 @@ bool DebuggerPlugin::LoadLogElement()
 	return true;
 }
 
+bool DebuggerPlugin::LoadPerformanceElement()
+{
+	performance_element_instancer = MakeUnique< ElementInstancerGeneric<ElementPerformance> >();
+	Factory::RegisterElementInstancer("debug-performance", performance_element_instancer.get());
+	performance_element = rmlui_dynamic_cast< ElementPerformance* >(host_context->CreateDocument("debug-performance"));
+	if (!performance_element)
+		return false;
+
+	performance_element->SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+
+	if (!performance_element->Initialise())
+	{
+		host_context->UnloadDocument(performance_element);
+		performance_element = nullptr;
+
+		return false;
+	}
+
+	return true;
+}
+
 void DebuggerPlugin::ReleaseElements()
 {
 	if (host_context)
@@ -395,6 +440,13 @@ void DebuggerPlugin::ReleaseElements()
 			application_interface = nullptr;
 			log_interface.reset();
 		}
+
+		if (performance_element)
+		{
+			performance_element->SetDebugContext(nullptr);
+			host_context->UnloadDocument(performance_element);
+			performance_element = nullptr;
+		}
 	}
 
 	if (debug_context)
@@ -41,6 +41,7 @@ namespace Debugger {
 
 class ElementLog;
 class ElementInfo;
+class ElementPerformance;
 class ElementContextHook;
 class DebuggerSystemInterface;
 
@@ -100,6 +101,7 @@ private:
 	bool LoadMenuElement();
 	bool LoadInfoElement();
 	bool LoadLogElement();
+	bool LoadPerformanceElement();
 
 	// Release all loaded elements
 	void ReleaseElements();
@@ -113,12 +115,13 @@ private:
 	ElementDocument* menu_element;
 	ElementInfo* info_element;
 	ElementLog* log_element;
+	ElementPerformance* performance_element;
 	ElementContextHook* hook_element;
 
 	Rml::SystemInterface* application_interface;
 	UniquePtr<DebuggerSystemInterface> log_interface;
 
-	UniquePtr<ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer;
+	UniquePtr<ElementInstancer> hook_element_instancer, info_element_instancer, log_element_instancer, performance_element_instancer;
 
 	bool render_outlines;
 
@@ -91,6 +91,9 @@ void ElementInfo::Reset()
 
 void ElementInfo::OnUpdate()
 {
+	// Keep polling the source element for changes while shown.
+	SetUpdateEveryFrame(source_element && update_source_element && IsVisible());
+
 	if (source_element && (update_source_element || force_update_once) && IsVisible())
 	{
 		const double t = GetSystemInterface()->GetElapsedTime();
@@ -233,6 +236,7 @@ void ElementInfo::ProcessEvent(Event& event)
 						}
 
 						force_update_once = true;
+						RequestUpdate();
 					}
 				}
 				else if (id == "offset_parent")
@@ -319,6 +323,7 @@ void ElementInfo::ProcessEvent(Event& event)
 				if (id == "show_source" || id == "update_source" || id == "enable_element_select")
 				{
 					title_dirty = true;
+					RequestUpdate();
 				}
 			}
 			// Otherwise we just want to focus on the clicked element (unless it's on a debug element)
@@ -344,6 +349,7 @@ void ElementInfo::ProcessEvent(Event& event)
 				if (id == "show_source" || id == "update_source" || id == "enable_element_select")
 				{
 					title_dirty = true;
+					RequestUpdate();
 				}
 			}
 		}
@@ -354,12 +360,14 @@ void ElementInfo::SetSourceElement(Element* new_source_element)
 {
 	source_element = new_source_element;
 	force_update_once = true;
+	RequestUpdate();
 }
 
 void ElementInfo::UpdateSourceElement()
 {
 	previous_update_time = GetSystemInterface()->GetElapsedTime();
 	title_dirty = true;
+	RequestUpdate();
 
 	// Set the pseudo classes
 	if (Element* pseudo = GetElementById("pseudo"))
@@ -181,6 +181,7 @@ void ElementLog::AddLogMessage(Log::Type type, const String& message)
 
 	// Force a refresh of the RML.
 	dirty_logs = true;
+	RequestUpdate();
 }
 
 void ElementLog::OnUpdate()
@@ -255,6 +256,7 @@ void ElementLog::ProcessEvent(Event& event)
 					}
 				}
 				dirty_logs = true;
+				RequestUpdate();
 			}
 			else
 			{
@@ -268,6 +270,7 @@ void ElementLog::ProcessEvent(Event& event)
 						else
 							event.GetTargetElement()->SetInnerRML("Off");
 						dirty_logs = true;
+						RequestUpdate();
 					}
 				}
 			}
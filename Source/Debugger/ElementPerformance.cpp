@@ -0,0 +1,444 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "ElementPerformance.h"
+#include "../../Include/RmlUi/Core/Context.h"
+#include "../../Include/RmlUi/Core/Core.h"
+#include "../../Include/RmlUi/Core/ElementUtilities.h"
+#include "../../Include/RmlUi/Core/Factory.h"
+#include "../../Include/RmlUi/Core/StringUtilities.h"
+#include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "CommonSource.h"
+#include "Geometry.h"
+#include "PerformanceSource.h"
+#include <algorithm>
+
+namespace Rml {
+namespace Debugger {
+
+// Interval between refreshing the contents of the panel, the statistics are averaged over this interval.
+static constexpr double update_interval = 0.5;
+// Duration of the flash shown when an element is invalidated.
+static constexpr double flash_duration = 0.5;
+// Number of elements shown in each ranking.
+static constexpr size_t num_ranked_elements = 10;
+// Script handler names, which can be the whole code of inline event handlers, are shortened to this length.
+static constexpr size_t max_script_handler_name_length = 60;
+
+static Colourb GetFlashColour(int flags)
+{
+	if (flags & (ElementStatistics::Formatted | ElementStatistics::LayoutDirtied))
+		return Colourb(255, 48, 48);
+	if (flags & ElementStatistics::DefinitionUpdated)
+		return Colourb(255, 215, 0);
+	if (flags & ElementStatistics::GeometryRegenerated)
+		return Colourb(48, 192, 48);
+	return Colourb(48, 128, 255);
+}
+
+static void RenderElementBoxes(Element* element, Colourb colour, bool fill)
+{
+	ElementUtilities::ApplyTransform(*element);
+
+	for (int i = 0; i < element->GetNumBoxes(); i++)
+	{
+		Vector2f box_offset;
+		const Box& box = element->GetBox(i, box_offset);
+		const Vector2f origin = element->GetAbsoluteOffset(Box::BORDER) + box_offset + box.GetPosition(Box::BORDER);
+		const Vector2f size = box.GetSize(Box::BORDER);
+
+		if (fill)
+			Geometry::RenderBox(origin, size, colour);
+		else
+			Geometry::RenderOutline(origin, Vector2f(std::max(size.x, 2.0f), std::max(size.y, 2.0f)), colour, 2);
+	}
+}
+
+ElementPerformance::ElementPerformance(const String& tag) : ElementDocument(tag)
+{
+}
+
+ElementPerformance::~ElementPerformance()
+{
+}
+
+bool ElementPerformance::Initialise()
+{
+	SetInnerRML(performance_rml);
+	SetId("rmlui-debug-performance");
+
+	AddEventListener(EventId::Click, this);
+
+	SharedPtr<StyleSheetContainer> style_sheet = Factory::InstanceStyleSheetString(String(common_rcss) + String(performance_rcss));
+	if (!style_sheet)
+		return false;
+
+	SetStyleSheetContainer(std::move(style_sheet));
+
+	return true;
+}
+
+void ElementPerformance::SetDebugContext(Context* context)
+{
+	if (debug_context && owns_recording)
+		debug_context->SetElementStatisticsEnabled(false);
+
+	debug_context = context;
+	recording = false;
+	owns_recording = false;
+
+	ResetStatistics();
+}
+
+void ElementPerformance::RecordFrame()
+{
+	if (!recording)
+		return;
+
+	const FrameStatistics& statistics = debug_context->GetFrameStatistics();
+	total_statistics.update_time += statistics.update_time;
+	total_statistics.layout_time += statistics.layout_time;
+	total_statistics.render_time += statistics.render_time;
+	total_statistics.script_time += statistics.script_time;
+	total_statistics.script_calls += statistics.script_calls;
+	total_statistics.element_updates += statistics.element_updates;
+	total_statistics.layout_passes += statistics.layout_passes;
+	total_statistics.formatted_elements += statistics.formatted_elements;
+	total_statistics.definition_updates += statistics.definition_updates;
+	total_statistics.geometry_regenerations += statistics.geometry_regenerations;
+	total_statistics.draw_calls += statistics.draw_calls;
+	num_frames += 1;
+
+	const double time = GetSystemInterface()->GetElapsedTime();
+
+	for (const ElementStatistics& element_statistics : debug_context->GetElementStatistics())
+	{
+		Element* element = element_statistics.element.get();
+		if (!element || IsDebuggerElement(element))
+			continue;
+
+		ElementCost& cost = element_costs[element];
+		if (!(cost.element == element))
+		{
+			cost = ElementCost();
+			cost.element = element_statistics.element;
+		}
+
+		cost.update_time += element_statistics.update_time;
+		cost.render_time += element_statistics.render_time;
+		if (element_statistics.flags & ElementStatistics::LayoutDirtied)
+			cost.num_layout_dirtied += 1;
+
+		if (show_flash && element_statistics.flags != 0)
+		{
+			Flash& flash = flashes[element];
+			flash.element = element_statistics.element;
+			flash.flags = element_statistics.flags;
+			flash.time = time;
+		}
+	}
+}
+
+void ElementPerformance::RenderOverlay()
+{
+	if (show_heatmap)
+	{
+		for (const HeatmapEntry& entry : heatmap)
+		{
+			Element* element = entry.element.get();
+			if (element && element->IsVisible())
+				RenderElementBoxes(element, Colourb(255, 0, 0, (byte)(32.f + 160.f * entry.intensity)), true);
+		}
+	}
+
+	if (show_flash)
+	{
+		const double time = GetSystemInterface()->GetElapsedTime();
+
+		for (auto it = flashes.begin(); it != flashes.end();)
+		{
+			const Flash& flash = it->second;
+			const double age = time - flash.time;
+			Element* element = flash.element.get();
+
+			if (!element || age > flash_duration)
+			{
+				it = flashes.erase(it);
+				continue;
+			}
+
+			if (element->IsVisible())
+			{
+				Colourb colour = GetFlashColour(flash.flags);
+				colour.alpha = (byte)(255.0 * (1.0 - std::max(age, 0.0) / flash_duration));
+				RenderElementBoxes(element, colour, false);
+			}
+
+			++it;
+		}
+	}
+}
+
+void ElementPerformance::ProcessEvent(Event& event)
+{
+	if (event == EventId::Click)
+	{
+		Element* target_element = event.GetTargetElement();
+		const String& id = target_element->GetId();
+
+		if (id == "close_button")
+		{
+			SetProperty(PropertyId::Visibility, Property(Style::Visibility::Hidden));
+		}
+		else if (id == "flash_button")
+		{
+			show_flash = !show_flash;
+			target_element->SetClass("on", show_flash);
+			if (!show_flash)
+				flashes.clear();
+		}
+		else if (id == "heatmap_button")
+		{
+			show_heatmap = !show_heatmap;
+			target_element->SetClass("on", show_heatmap);
+		}
+	}
+}
+
+void ElementPerformance::OnUpdate()
+{
+	ElementDocument::OnUpdate();
+
+	// Poll the recording state and statistics every frame while shown.
+	SetUpdateEveryFrame(IsVisible());
+
+	UpdateRecording();
+
+	if (!recording)
+		return;
+
+	const double time = GetSystemInterface()->GetElapsedTime();
+	if (time - previous_update_time < update_interval || num_frames == 0)
+		return;
+
+	previous_update_time = time;
+
+	UpdateContents();
+
+	num_frames = 0;
+	total_statistics = FrameStatistics();
+	element_costs.clear();
+}
+
+void ElementPerformance::UpdateRecording()
+{
+	const bool enable = (debug_context && IsVisible());
+	if (enable == recording)
+		return;
+
+	recording = enable;
+
+	if (enable)
+	{
+		// Leave the statistics enabled when we are done if the application enabled them on its own.
+		owns_recording = !debug_context->IsElementStatisticsEnabled();
+		debug_context->SetElementStatisticsEnabled(true);
+	}
+	else
+	{
+		if (debug_context && owns_recording)
+			debug_context->SetElementStatisticsEnabled(false);
+		owns_recording = false;
+
+		ResetStatistics();
+	}
+}
+
+void ElementPerformance::UpdateContents()
+{
+	const double frames = (double)num_frames;
+
+	if (Element* frame_element = GetElementById("frame"))
+	{
+		String rml = "<h2>Frame</h2><div>";
+		rml += CreateString(128, "<p><span class=\"time\">%.3f ms</span>Update</p>", 1000.0 * total_statistics.update_time / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.3f ms</span>Layout, %.2f passes</p>",
+			1000.0 * total_statistics.layout_time / frames, total_statistics.layout_passes / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.3f ms</span>Render</p>", 1000.0 * total_statistics.render_time / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.3f ms</span>Scripts, %.1f calls</p>",
+			1000.0 * total_statistics.script_time / frames, total_statistics.script_calls / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.1f</span>Element updates</p>", total_statistics.element_updates / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.1f</span>Formatted elements</p>", total_statistics.formatted_elements / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.1f</span>Definition updates</p>", total_statistics.definition_updates / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.1f</span>Geometry regenerations</p>", total_statistics.geometry_regenerations / frames);
+		rml += CreateString(128, "<p><span class=\"time\">%.1f</span>Draw calls</p>", total_statistics.draw_calls / frames);
+		rml += "</div>";
+		frame_element->SetInnerRML(rml);
+	}
+
+	Vector<const ElementCost*> costs;
+	costs.reserve(element_costs.size());
+	double max_cost = 0;
+	for (const auto& pair : element_costs)
+	{
+		if (pair.second.element)
+		{
+			costs.push_back(&pair.second);
+			max_cost = std::max(max_cost, pair.second.update_time + pair.second.render_time);
+		}
+	}
+
+	heatmap.clear();
+	if (max_cost > 0)
+	{
+		for (const ElementCost* cost : costs)
+		{
+			const float intensity = float((cost->update_time + cost->render_time) / max_cost);
+			heatmap.push_back(HeatmapEntry{ cost->element, intensity });
+		}
+	}
+
+	auto build_ranking = [&](const String& title, auto sort_key, auto format_value) {
+		std::sort(costs.begin(), costs.end(), [&](const ElementCost* a, const ElementCost* b) { return sort_key(*a) > sort_key(*b); });
+
+		String rml = "<h2>" + title + "</h2><div>";
+		size_t num_ranked = 0;
+		for (const ElementCost* cost : costs)
+		{
+			if (num_ranked >= num_ranked_elements || sort_key(*cost) <= 0)
+				break;
+			rml += "<p>" + format_value(*cost) + StringUtilities::EncodeRml(cost->element->GetAddress(false, false)) + "</p>";
+			num_ranked += 1;
+		}
+		if (num_ranked == 0)
+			rml += "<p><em>None</em></p>";
+		rml += "</div>";
+		return rml;
+	};
+
+	if (Element* update_element = GetElementById("update"))
+	{
+		update_element->SetInnerRML(build_ranking("Update time",
+			[](const ElementCost& cost) { return cost.update_time; },
+			[&](const ElementCost& cost) { return CreateString(64, "<span class=\"time\">%.1f us</span>", 1'000'000.0 * cost.update_time / frames); }
+		));
+	}
+
+	if (Element* render_element = GetElementById("render"))
+	{
+		render_element->SetInnerRML(build_ranking("Render time",
+			[](const ElementCost& cost) { return cost.render_time; },
+			[&](const ElementCost& cost) { return CreateString(64, "<span class=\"time\">%.1f us</span>", 1'000'000.0 * cost.render_time / frames); }
+		));
+	}
+
+	if (Element* layout_element = GetElementById("layout"))
+	{
+		layout_element->SetInnerRML(build_ranking("Layout invalidations",
+			[](const ElementCost& cost) { return (double)cost.num_layout_dirtied; },
+			[&](const ElementCost& cost) { return CreateString(64, "<span class=\"time\">%d/%d</span>", cost.num_layout_dirtied, num_frames); }
+		));
+	}
+
+	UpdateScriptHandlers();
+}
+
+void ElementPerformance::UpdateScriptHandlers()
+{
+	Element* scripts_element = GetElementById("scripts");
+	if (!scripts_element)
+		return;
+
+	// The scripting plugin reports the totals since profiling started, take the difference to the previous refresh.
+	ScriptHandlerStatisticsList handler_costs;
+	UnorderedMap<String, ScriptHandlerStatistics> new_handler_totals;
+	for (ScriptHandlerStatistics& handler : GetScriptHandlerStatistics())
+	{
+		ScriptHandlerStatistics cost = handler;
+		auto it = script_handler_totals.find(handler.name);
+		if (it != script_handler_totals.end() && it->second.calls <= handler.calls)
+		{
+			cost.calls -= it->second.calls;
+			cost.time -= it->second.time;
+		}
+		if (cost.calls > 0)
+			handler_costs.push_back(std::move(cost));
+
+		String name = handler.name;
+		new_handler_totals.emplace(std::move(name), std::move(handler));
+	}
+	script_handler_totals = std::move(new_handler_totals);
+
+	std::sort(handler_costs.begin(), handler_costs.end(), [](const ScriptHandlerStatistics& a, const ScriptHandlerStatistics& b) { return a.time > b.time; });
+	if (handler_costs.size() > num_ranked_elements)
+		handler_costs.resize(num_ranked_elements);
+
+	const double frames = (double)num_frames;
+
+	String rml = "<h2>Script handlers</h2><div>";
+	for (const ScriptHandlerStatistics& cost : handler_costs)
+	{
+		String name = cost.name;
+		if (name.size() > max_script_handler_name_length)
+			name = name.substr(0, max_script_handler_name_length - 3) + "...";
+
+		rml += CreateString(128, "<p><span class=\"time\">%.1f us</span><span class=\"count\">%.1f</span>", 1'000'000.0 * cost.time / frames, cost.calls / frames);
+		rml += StringUtilities::EncodeRml(name) + "</p>";
+	}
+	if (handler_costs.empty())
+		rml += "<p><em>None</em></p>";
+	rml += "</div>";
+
+	scripts_element->SetInnerRML(rml);
+}
+
+void ElementPerformance::ResetStatistics()
+{
+	num_frames = 0;
+	total_statistics = FrameStatistics();
+	element_costs.clear();
+	heatmap.clear();
+	flashes.clear();
+
+	// Only rank the time spent in script handlers from now on.
+	script_handler_totals.clear();
+	for (ScriptHandlerStatistics& handler : GetScriptHandlerStatistics())
+	{
+		String name = handler.name;
+		script_handler_totals.emplace(std::move(name), std::move(handler));
+	}
+}
+
+bool ElementPerformance::IsDebuggerElement(Element* element) const
+{
+	ElementDocument* document = element->GetOwnerDocument();
+	return !document || document->GetId().find("rmlui-debug-") == 0;
+}
+
+}
+}
@@ -0,0 +1,125 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#ifndef RMLUI_DEBUGGER_ELEMENTPERFORMANCE_H
+#define RMLUI_DEBUGGER_ELEMENTPERFORMANCE_H
+
+#include "../../Include/RmlUi/Core/ElementDocument.h"
+#include "../../Include/RmlUi/Core/EventListener.h"
+#include "../../Include/RmlUi/Core/FrameStatistics.h"
+
+namespace Rml {
+namespace Debugger {
+
+/**
+	Shows the frame statistics of the debugged context, and ranks its elements by the time spent updating and
+	rendering them, and ranks the script handlers reported by scripting plugins. Elements that had their definition, layout, geometry or data views recomputed can be flashed, and
+	the cost of each element can be displayed as a heatmap.
+ */
+
+class ElementPerformance : public ElementDocument, public EventListener
+{
+public:
+	RMLUI_RTTI_DefineWithParent(ElementPerformance, ElementDocument)
+
+	ElementPerformance(const String& tag);
+	~ElementPerformance();
+
+	/// Initialises the performance element.
+	/// @return True if the element initialised successfully, false otherwise.
+	bool Initialise();
+
+	/// Sets the context to record statistics from.
+	void SetDebugContext(Context* context);
+
+	/// Accumulates the statistics of the most recent frame of the debugged context.
+	void RecordFrame();
+	/// Renders the invalidation flashes and the heatmap over the debugged context.
+	void RenderOverlay();
+
+protected:
+	void ProcessEvent(Event& event) override;
+	void OnUpdate() override;
+
+private:
+	struct ElementCost
+	{
+		ObserverPtr<Element> element;
+		double update_time = 0;
+		double render_time = 0;
+		int num_layout_dirtied = 0;
+	};
+
+	struct HeatmapEntry
+	{
+		ObserverPtr<Element> element;
+		float intensity;
+	};
+
+	struct Flash
+	{
+		ObserverPtr<Element> element;
+		int flags = 0;
+		double time = 0;
+	};
+
+	// Enables per-element statistics in the debugged context while they are needed, or disables them otherwise.
+	void UpdateRecording();
+	// Rebuilds the contents of the panel and the heatmap from the accumulated statistics.
+	void UpdateContents();
+	// Rebuilds the ranking of script handlers by the time spent in them since the previous refresh.
+	void UpdateScriptHandlers();
+	// Clears all accumulated statistics.
+	void ResetStatistics();
+
+	bool IsDebuggerElement(Element* element) const;
+
+	Context* debug_context = nullptr;
+	// True while the statistics of the debugged context are being recorded.
+	bool recording = false;
+	// True if we enabled the per-element statistics of the debugged context, as opposed to the application.
+	bool owns_recording = false;
+
+	bool show_flash = true;
+	bool show_heatmap = false;
+
+	double previous_update_time = 0;
+	int num_frames = 0;
+	FrameStatistics total_statistics;
+	UnorderedMap<Element*, ElementCost> element_costs;
+	// The script handler totals at the previous refresh, as reported by the scripting plugin.
+	UnorderedMap<String, ScriptHandlerStatistics> script_handler_totals;
+
+	Vector<HeatmapEntry> heatmap;
+	UnorderedMap<Element*, Flash> flashes;
+};
+
+}
+} // namespace Rml
+
+#endif
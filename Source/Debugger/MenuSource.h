@@ -88,6 +88,7 @@ static const char* menu_rml = R"RML(
 <div id="button-group">
 	<button id="event-log-button">Event Log</button>
 	<button id="debug-info-button">Element Info</button>
+	<button id="performance-button">Performance</button>
 	<button id="outlines-button">Outlines</button>
 </div>
 )RML";
@@ -0,0 +1,127 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+static const char* performance_rcss = R"RCSS(
+body
+{
+	width: 380dp;
+	height: 420dp;
+	min-width: 250dp;
+	min-height: 150dp;
+	top: 42dp;
+	left: 440dp;
+}
+div#tools
+{
+	float: right;
+	width: 170dp;
+}
+div.button
+{
+	display: inline-block;
+	width: 80dp;
+	font-size: 13dp;
+	line-height: 20dp;
+	text-align: center;
+	border-width: 1px;
+	border-color: #666;
+	background-color: #aaa;
+	color: #111;
+	margin-right: 3dp;
+}
+div.button.on
+{
+	background-color: #3fab2a;
+	color: white;
+}
+div.button:hover
+{
+	border-color: #ddd;
+}
+div.button:active
+{
+	border-color: #fff;
+}
+div#content div h2
+{
+	padding-left: 5dp;
+}
+div#content div div
+{
+	font-size: 12dp;
+	padding-left: 10dp;
+}
+div#content .time
+{
+	display: inline-block;
+	width: 70dp;
+	color: #610;
+}
+div#content .count
+{
+	display: inline-block;
+	width: 40dp;
+	color: #610;
+}
+div#content .legend
+{
+	display: inline-block;
+	width: 10dp;
+	height: 10dp;
+	margin-right: 5dp;
+}
+)RCSS";
+
+static const char* performance_rml = R"RML(
+<h1>
+	<handle id="position_handle" move_target="#document"/>
+	<div id="close_button">X</div>
+	<div id="tools">
+		<div id="flash_button" class="button on">Flash</div>
+		<div id="heatmap_button" class="button">Heatmap</div>
+	</div>
+	<div style="width: 100dp;">Performance</div>
+</h1>
+<div id="content">
+	<div id="frame"></div>
+	<div id="legend">
+		<h2>Flash</h2>
+		<div>
+			<span class="legend" style="background-color: #ff3030;"></span>Layout
+			<span class="legend" style="background-color: #ffd700; margin-left: 10dp;"></span>Definition
+			<span class="legend" style="background-color: #30c030; margin-left: 10dp;"></span>Geometry
+			<span class="legend" style="background-color: #3080ff; margin-left: 10dp;"></span>Data view
+		</div>
+	</div>
+	<div id="update"></div>
+	<div id="render"></div>
+	<div id="layout"></div>
+	<div id="scripts"></div>
+</div>
+<handle id="size_handle" size_target="#document" />
+)RML";
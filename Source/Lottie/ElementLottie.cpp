@@ -27,11 +27,13 @@
  */
 
 #include "../../Include/RmlUi/Lottie/ElementLottie.h"
+#include "../../Include/RmlUi/Core/Context.h"
 #include "../../Include/RmlUi/Core/Core.h"
 #include "../../Include/RmlUi/Core/PropertyIdSet.h"
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/TaskInterface.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include <cmath>
 #include <rlottie.h>
@@ -135,6 +137,7 @@ bool ElementLottie::LoadAnimation()
 	animation.reset();
 	prev_animation_frame = size_t(-1);
 	time_animation_start = -1;
+	SetUpdateEveryFrame(false);
 
 	const String attribute_src = GetAttribute<String>("src", "");
 
@@ -172,6 +175,9 @@ bool ElementLottie::LoadAnimation()
 	intrinsic_dimensions.x = float(width);
 	intrinsic_dimensions.y = float(height);
 
+	// Keep the context updating and rendering while the animation plays.
+	SetUpdateEveryFrame(true);
+
 	return true;
 }
 
@@ -180,7 +186,8 @@ void ElementLottie::UpdateTexture()
 	if (!animation)
 		return;
 
-	const double t = GetSystemInterface()->GetElapsedTime();
+	Context* context = GetContext();
+	const double t = (context ? context->GetElapsedTime() : GetSystemInterface()->GetElapsedTime());
 
 	if (time_animation_start < 0.0)
 		time_animation_start = t;
@@ -211,21 +218,29 @@ void ElementLottie::UpdateTexture()
 		animation->renderSync(next_frame, surface);
 
 		// Swizzle the channel order from rlottie's BGRA to RmlUi's RGBA, and change pre-multiplied to post-multiplied alpha.
-		for (size_t i = 0; i < total_bytes; i += 4)
-		{
-			// Swap the RB order for correct color channels.
-			std::swap(p_data[i], p_data[i + 2]);
+		// Each row is converted independently, so the rows are processed in parallel.
+		constexpr int rows_per_task = 32;
 
-			const byte a = p_data[i + 3];
+		GetTaskInterface()->ParallelFor(0, render_dimensions.y, rows_per_task, [p_data, bytes_per_line](int begin, int end) {
+			const size_t row_begin = size_t(begin) * bytes_per_line;
+			const size_t row_end = size_t(end) * bytes_per_line;
 
-			// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
-			// Here, we un-premultiply the colors.
-			if (a > 0 && a < 255)
+			for (size_t i = row_begin; i < row_end; i += 4)
 			{
-				for (size_t j = 0; j < 3; j++)
-					p_data[i + j] = (p_data[i + j] * 255) / a;
+				// Swap the RB order for correct color channels.
+				std::swap(p_data[i], p_data[i + 2]);
+
+				const byte a = p_data[i + 3];
+
+				// The RmlUi samples shell uses post-multiplied alpha, while rlottie serves pre-multiplied alpha.
+				// Here, we un-premultiply the colors.
+				if (a > 0 && a < 255)
+				{
+					for (size_t j = 0; j < 3; j++)
+						p_data[i + j] = (p_data[i + j] * 255) / a;
+				}
 			}
-		}
+		});
 
 		data.reset(p_data);
 		dimensions = render_dimensions;
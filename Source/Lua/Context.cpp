@@ -124,7 +124,7 @@ int ContextUpdate(lua_State* L, Context* obj)
 
 int ContextOpenDataModel(lua_State *L, Context *obj)
 {
-	if (!OpenLuaDataModel(L, obj, 1, 2)) {
+	if (!OpenLuaDataModel(L, obj, 1, 2, 3)) {
 		// Open fails
 		lua_pushboolean(L, false);
 	}
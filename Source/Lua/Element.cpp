@@ -32,12 +32,147 @@
 #include "ElementAttributesProxy.h"
 #include "ElementChildNodesProxy.h"
 #include <RmlUi/Lua/Utilities.h>
+#include <RmlUi/Core/ElementText.h>
+#include <RmlUi/Core/Factory.h>
 
 
 namespace Rml {
 namespace Lua {
 typedef ElementDocument Document;
 
+// Sets the style properties from the string keys and values of the table at 'index'. A value of false removes the
+// property. Returns false if any of the values could not be parsed.
+static bool SetPropertiesFromTable(lua_State* L, int index, Element* element)
+{
+    bool result = true;
+    lua_pushnil(L);
+    while (lua_next(L, index) != 0)
+    {
+        if (lua_type(L, -2) == LUA_TSTRING)
+        {
+            const char* name = lua_tostring(L, -2);
+            if (lua_type(L, -1) == LUA_TBOOLEAN && !lua_toboolean(L, -1))
+                element->RemoveProperty(name);
+            else if (const char* value = lua_tostring(L, -1))
+                result &= element->SetProperty(name, value);
+            else
+                result = false;
+        }
+        lua_pop(L, 1);
+    }
+    return result;
+}
+
+// Instances the element described by the value at 'index', including its children. A string describes a text node,
+// a table describes an element with the fields 'tag', 'attributes', 'style', and 'text', and its children in the array
+// part.
+static ElementPtr InstanceTree(lua_State* L, int index, Element* parent)
+{
+    luaL_checkstack(L, 4, "element tree too deep");
+
+    if (lua_type(L, index) == LUA_TSTRING)
+    {
+        ElementPtr element = Factory::InstanceElement(parent, "#text", "#text", XMLAttributes());
+        if (ElementText* element_text = rmlui_dynamic_cast<ElementText*>(element.get()))
+            element_text->SetText(lua_tostring(L, index));
+        return element;
+    }
+    if (lua_type(L, index) != LUA_TTABLE)
+    {
+        Log::Message(Log::LT_WARNING, "Element tree descriptions can only contain tables and strings, found a %s.", luaL_typename(L, index));
+        return nullptr;
+    }
+
+    int top = lua_gettop(L);
+
+    lua_getfield(L, index, "tag");
+    const char* tag_str = lua_tostring(L, -1);
+    const String tag = (tag_str ? tag_str : "div");
+
+    // Pass the attributes to the instancer, as they may determine the kind of element to create.
+    XMLAttributes attributes;
+    lua_getfield(L, index, "attributes");
+    if (lua_type(L, -1) == LUA_TTABLE)
+    {
+        lua_pushnil(L);
+        while (lua_next(L, -2) != 0)
+        {
+            if (lua_type(L, -2) == LUA_TSTRING)
+            {
+                const char* key = lua_tostring(L, -2);
+                int type = lua_type(L, -1);
+                if (type == LUA_TBOOLEAN)
+                    attributes[key] = (bool)lua_toboolean(L, -1);
+                else if (type == LUA_TNUMBER)
+                    attributes[key] = (float)lua_tonumber(L, -1);
+                else if (type == LUA_TSTRING)
+                    attributes[key] = String(lua_tostring(L, -1));
+            }
+            lua_pop(L, 1);
+        }
+    }
+
+    ElementPtr element = Factory::InstanceElement(parent, tag, tag, attributes);
+    if (!element)
+    {
+        Log::Message(Log::LT_WARNING, "Could not instance element with tag '%s' from element tree description.", tag.c_str());
+        lua_settop(L, top);
+        return nullptr;
+    }
+
+    lua_getfield(L, index, "style");
+    if (lua_type(L, -1) == LUA_TTABLE)
+        SetPropertiesFromTable(L, lua_gettop(L), element.get());
+
+    lua_getfield(L, index, "text");
+    if (lua_type(L, -1) == LUA_TSTRING)
+    {
+        if (ElementPtr text = InstanceTree(L, lua_gettop(L), element.get()))
+            element->AppendChild(std::move(text));
+    }
+
+    const int num_children = (int)lua_rawlen(L, index);
+    for (int i = 1; i <= num_children; i++)
+    {
+        lua_rawgeti(L, index, i);
+        if (ElementPtr child = InstanceTree(L, lua_gettop(L), element.get()))
+            element->AppendChild(std::move(child));
+        lua_pop(L, 1);
+    }
+
+    lua_settop(L, top);
+    return element;
+}
+
+// Replaces the contents of the element with the given text, reusing its text node when possible.
+static void SetElementText(Element* element, const String& text)
+{
+    if (ElementText* element_text = rmlui_dynamic_cast<ElementText*>(element))
+    {
+        element_text->SetText(text);
+        return;
+    }
+
+    if (element->GetNumChildren() == 1)
+    {
+        if (ElementText* element_text = rmlui_dynamic_cast<ElementText*>(element->GetFirstChild()))
+        {
+            element_text->SetText(text);
+            return;
+        }
+    }
+
+    while (element->HasChildNodes())
+        element->RemoveChild(element->GetFirstChild());
+
+    ElementPtr text_element = Factory::InstanceElement(element, "#text", "#text", XMLAttributes());
+    if (ElementText* element_text = rmlui_dynamic_cast<ElementText*>(text_element.get()))
+    {
+        element_text->SetText(text);
+        element->AppendChild(std::move(text_element));
+    }
+}
+
 template<> void ExtraInit<Element>(lua_State* L, int metatable_index)
 {
     int top = lua_gettop(L);
@@ -106,6 +241,20 @@ int ElementAppendChild(lua_State* L, Element* obj)
     return 0;
 }
 
+int ElementAppendTree(lua_State* L, Element* obj)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    ElementPtr element = InstanceTree(L, 1, obj);
+    if (!element)
+    {
+        lua_pushnil(L);
+        return 1;
+    }
+    Element* result = obj->AppendChild(std::move(element));
+    LuaType<Element>::push(L, result, false);
+    return 1;
+}
+
 int ElementBlur(lua_State* /*L*/, Element* obj)
 {
     obj->Blur();
@@ -268,6 +417,39 @@ int ElementSetClass(lua_State* L, Element* obj)
     return 0;
 }
 
+int ElementSetProperties(lua_State* L, Element* obj)
+{
+    luaL_checktype(L, 1, LUA_TTABLE);
+    lua_pushboolean(L, SetPropertiesFromTable(L, 1, obj));
+    return 1;
+}
+
+int ElementSetTexts(lua_State* L, Element* obj)
+{
+    // Keys are element ids of descendants, or the elements themselves.
+    luaL_checktype(L, 1, LUA_TTABLE);
+    String text;
+    lua_pushnil(L);
+    while (lua_next(L, 1) != 0)
+    {
+        Element* element = nullptr;
+        if (lua_type(L, -2) == LUA_TSTRING)
+            element = obj->GetElementById(lua_tostring(L, -2));
+        else if (lua_type(L, -2) == LUA_TUSERDATA)
+            element = LuaType<Element>::check(L, -2);
+
+        size_t length = 0;
+        const char* value = (lua_type(L, -1) == LUA_TSTRING || lua_type(L, -1) == LUA_TNUMBER ? lua_tolstring(L, -1, &length) : nullptr);
+        if (element && value)
+        {
+            text.assign(value, length);
+            SetElementText(element, text);
+        }
+        lua_pop(L, 1);
+    }
+    return 0;
+}
+
 //getters
 int ElementGetAttrattributes(lua_State* L)
 {
@@ -558,6 +740,7 @@ RegType<Element> ElementMethods[] =
 {
     RMLUI_LUAMETHOD(Element,AddEventListener)
     RMLUI_LUAMETHOD(Element,AppendChild)
+    RMLUI_LUAMETHOD(Element,AppendTree)
     RMLUI_LUAMETHOD(Element,Blur)
     RMLUI_LUAMETHOD(Element,Click)
     RMLUI_LUAMETHOD(Element,DispatchEvent)
@@ -575,6 +758,8 @@ RegType<Element> ElementMethods[] =
     RMLUI_LUAMETHOD(Element,ScrollIntoView)
     RMLUI_LUAMETHOD(Element,SetAttribute)
     RMLUI_LUAMETHOD(Element,SetClass)
+    RMLUI_LUAMETHOD(Element,SetProperties)
+    RMLUI_LUAMETHOD(Element,SetTexts)
     { nullptr, nullptr },
 };
 
@@ -41,6 +41,7 @@ int Elementnew(lua_State* L);
 //methods
 int ElementAddEventListener(lua_State* L, Element* obj);
 int ElementAppendChild(lua_State* L, Element* obj);
+int ElementAppendTree(lua_State* L, Element* obj);
 int ElementBlur(lua_State* L, Element* obj);
 int ElementClick(lua_State* L, Element* obj);
 int ElementDispatchEvent(lua_State* L, Element* obj);
@@ -58,6 +59,8 @@ int ElementReplaceChild(lua_State* L, Element* obj);
 int ElementScrollIntoView(lua_State* L, Element* obj);
 int ElementSetAttribute(lua_State* L, Element* obj);
 int ElementSetClass(lua_State* L, Element* obj);
+int ElementSetProperties(lua_State* L, Element* obj);
+int ElementSetTexts(lua_State* L, Element* obj);
 
 //getters
 int ElementGetAttrattributes(lua_State* L);
@@ -27,12 +27,19 @@
  */
  
 #include "LuaDataModel.h"
+#include "ProfilerScope.h"
 #include <RmlUi/Lua/Utilities.h>
 #include <RmlUi/Core/DataVariable.h>
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/DataModelHandle.h>
 
 #define RMLDATAMODEL "RMLDATAMODEL"
+#define RMLDATAMODELPROXY "RMLDATAMODELPROXY"
+
+// Indices into the user value table of the data model object.
+enum { MODEL_THREAD = 1, MODEL_PROXIES = 2, MODEL_PENDING = 3 };
+// Indices into the user value table of the table proxy objects.
+enum { PROXY_TARGET = 1, PROXY_NAME = 2, PROXY_MODEL = 3 };
 
 namespace Rml {
 namespace Lua {
@@ -113,6 +120,14 @@ struct LuaDataModel {
 	LuaScalarDef *scalarDef;
 	LuaTableDef *tableDef;
 	int top;
+	int batch_depth;
+	bool track_nested_writes;
+};
+
+// When enabled for a model, its tables are handed to scripts through proxies, so that writes to nested values are
+// tracked.
+struct LuaDataModelProxy {
+	struct LuaDataModel *model;
 };
 
 class LuaTableDef : public VariableDefinition {
@@ -245,7 +260,9 @@ BindVariable(struct LuaDataModel* D, lua_State* L) {
 	lua_rawset(dataL, 1);
 	const char* key = lua_tostring(L, -1);
 	if (lua_type(dataL, D->top) == LUA_TFUNCTION) {
+		String name = key;
 		D->constructor.BindEventCallback(key, [=](DataModelHandle, Event& event, const VariantList& varlist) {
+			ProfilerScope profiler_scope(Profiler::Category::DataModelCallback, name);
 			lua_pushvalue(dataL, id);
 			lua_xmove(dataL, L, 1);
 			luabind::invoke(L, [&](){
@@ -264,18 +281,181 @@ BindVariable(struct LuaDataModel* D, lua_State* L) {
 	}
 }
 
-static int
-getId(lua_State *L, lua_State *dataL) {
-	lua_pushvalue(dataL, 1);
-	lua_xmove(dataL, L, 1);
-	lua_pushvalue(L, 2);
+// Marks the top-level variable with the name at 'name' dirty. Inside model:batch(), the variable is only recorded and
+// dirtied once the outermost batch completes.
+static void
+DirtyModelVariable(lua_State *L, struct LuaDataModel *D, int model, int name) {
+	if (D->batch_depth > 0) {
+		lua_getuservalue(L, model);
+		lua_rawgeti(L, -1, MODEL_PENDING);
+		lua_pushvalue(L, name);
+		lua_pushboolean(L, 1);
+		lua_rawset(L, -3);
+		lua_pop(L, 2);
+	}
+	else {
+		D->handle.DirtyVariable(lua_tostring(L, name));
+	}
+}
+
+static void
+FlushPendingVariables(lua_State *L, struct LuaDataModel *D, int model) {
+	lua_getuservalue(L, model);
+	lua_rawgeti(L, -1, MODEL_PENDING);
+	lua_pushnil(L);
+	while (lua_next(L, -2) != 0) {
+		lua_pop(L, 1);
+		D->handle.DirtyVariable(lua_tostring(L, -1));
+	}
+	lua_pop(L, 1);
+	lua_newtable(L);
+	lua_rawseti(L, -2, MODEL_PENDING);
+	lua_pop(L, 1);
+}
+
+// Pushes the proxy of the table at 'table', which belongs to the top-level variable with the name at 'name'. Proxies
+// are cached per table and variable, so repeated reads return the same object, and a table shared by several variables
+// dirties the one it was read from.
+static void
+PushProxy(lua_State *L, int model, int name, int table) {
+	lua_getuservalue(L, model);
+	lua_rawgeti(L, -1, MODEL_PROXIES);
+	lua_pushvalue(L, table);
 	lua_rawget(L, -2);
-	if (lua_type(L, -1) != LUA_TNUMBER) {
-		luaL_error(L, "DataModel has no key : %s", lua_tostring(L, 2));
+	if (lua_isnil(L, -1)) {
+		lua_pop(L, 1);
+		lua_newtable(L);
+		lua_pushvalue(L, table);
+		lua_pushvalue(L, -2);
+		lua_rawset(L, -4);
 	}
-	int id = (int)lua_tointeger(L, -1);
+	lua_pushvalue(L, name);
+	lua_rawget(L, -2);
+	if (lua_isnil(L, -1)) {
+		lua_pop(L, 1);
+		struct LuaDataModelProxy *P = (struct LuaDataModelProxy *)lua_newuserdata(L, sizeof(*P));
+		P->model = (struct LuaDataModel *)lua_touserdata(L, model);
+		luaL_setmetatable(L, RMLDATAMODELPROXY);
+		lua_createtable(L, 3, 0);
+		lua_pushvalue(L, table);
+		lua_rawseti(L, -2, PROXY_TARGET);
+		lua_pushvalue(L, name);
+		lua_rawseti(L, -2, PROXY_NAME);
+		lua_pushvalue(L, model);
+		lua_rawseti(L, -2, PROXY_MODEL);
+		lua_setuservalue(L, -2);
+		lua_pushvalue(L, name);
+		lua_pushvalue(L, -2);
+		lua_rawset(L, -4);
+	}
+	lua_replace(L, -4);
 	lua_pop(L, 2);
-	return id;
+}
+
+// Replaces a proxy at 'index' with the table it represents, so that only plain tables are stored in the model.
+static void
+UnwrapProxy(lua_State *L, int index) {
+	if (luaL_testudata(L, index, RMLDATAMODELPROXY)) {
+		lua_getuservalue(L, index);
+		lua_rawgeti(L, -1, PROXY_TARGET);
+		lua_replace(L, index);
+		lua_pop(L, 1);
+	}
+}
+
+static int
+lDataModelProxyGet(lua_State *L) {
+	struct LuaDataModelProxy *P = (struct LuaDataModelProxy *)luaL_checkudata(L, 1, RMLDATAMODELPROXY);
+	lua_settop(L, 2);
+	lua_getuservalue(L, 1);
+	lua_rawgeti(L, 3, PROXY_TARGET);
+	lua_pushvalue(L, 2);
+	lua_gettable(L, 4);
+	if (lua_type(L, 5) == LUA_TTABLE && P->model->dataL) {
+		lua_rawgeti(L, 3, PROXY_MODEL);
+		lua_rawgeti(L, 3, PROXY_NAME);
+		PushProxy(L, 6, 7, 5);
+	}
+	return 1;
+}
+
+static int
+lDataModelProxySet(lua_State *L) {
+	struct LuaDataModelProxy *P = (struct LuaDataModelProxy *)luaL_checkudata(L, 1, RMLDATAMODELPROXY);
+	if (P->model->dataL == nullptr)
+		luaL_error(L, "DataModel released");
+	lua_settop(L, 3);
+	UnwrapProxy(L, 3);
+	lua_getuservalue(L, 1);
+	lua_rawgeti(L, 4, PROXY_TARGET);
+	lua_pushvalue(L, 2);
+	lua_gettable(L, 5);
+	// Views only need to be updated when the value actually changed. Tables may have been modified in place, so
+	// assigning a table to itself still dirties the variable.
+	if (lua_type(L, 3) != LUA_TTABLE && lua_rawequal(L, 3, 6))
+		return 0;
+	lua_pushvalue(L, 2);
+	lua_pushvalue(L, 3);
+	lua_settable(L, 5);
+	lua_rawgeti(L, 4, PROXY_MODEL);
+	lua_rawgeti(L, 4, PROXY_NAME);
+	DirtyModelVariable(L, P->model, 7, 8);
+	return 0;
+}
+
+static int
+lDataModelProxyLen(lua_State *L) {
+	luaL_checkudata(L, 1, RMLDATAMODELPROXY);
+	lua_getuservalue(L, 1);
+	lua_rawgeti(L, -1, PROXY_TARGET);
+	lua_pushinteger(L, luaL_len(L, -1));
+	return 1;
+}
+
+static int
+lDataModelProxyNext(lua_State *L) {
+	struct LuaDataModelProxy *P = (struct LuaDataModelProxy *)luaL_checkudata(L, 1, RMLDATAMODELPROXY);
+	lua_settop(L, 2);
+	lua_getuservalue(L, 1);
+	lua_rawgeti(L, 3, PROXY_TARGET);
+	lua_pushvalue(L, 2);
+	if (lua_next(L, 4) == 0)
+		return 0;
+	if (lua_type(L, 6) == LUA_TTABLE && P->model->dataL) {
+		lua_rawgeti(L, 3, PROXY_MODEL);
+		lua_rawgeti(L, 3, PROXY_NAME);
+		PushProxy(L, 7, 8, 6);
+		lua_replace(L, 6);
+		lua_settop(L, 6);
+	}
+	return 2;
+}
+
+static int
+lDataModelProxyPairs(lua_State *L) {
+	luaL_checkudata(L, 1, RMLDATAMODELPROXY);
+	lua_pushcfunction(L, lDataModelProxyNext);
+	lua_pushvalue(L, 1);
+	lua_pushnil(L);
+	return 3;
+}
+
+// model:batch(fn) calls fn, and dirties each variable changed during the call only once it returns.
+static int
+lDataModelBatch(lua_State *L) {
+	struct LuaDataModel *D = (struct LuaDataModel *)luaL_checkudata(L, 1, RMLDATAMODEL);
+	if (D->dataL == nullptr)
+		luaL_error(L, "DataModel released");
+	luaL_checktype(L, 2, LUA_TFUNCTION);
+	lua_settop(L, 2);
+	D->batch_depth += 1;
+	int status = lua_pcall(L, 0, 0, 0);
+	D->batch_depth -= 1;
+	if (D->batch_depth == 0 && D->dataL)
+		FlushPendingVariables(L, D, 1);
+	if (status != LUA_OK)
+		return lua_error(L);
+	return 0;
 }
 
 static int
@@ -284,9 +464,27 @@ lDataModelGet(lua_State *L) {
 	lua_State *dataL = D->dataL;
 	if (dataL == nullptr)
 		luaL_error(L, "DataModel closed");
-	int id = getId(L, dataL);
+	lua_settop(L, 2);
+	lua_pushvalue(dataL, 1);
+	lua_xmove(dataL, L, 1);
+	lua_pushvalue(L, 2);
+	lua_rawget(L, 3);
+	if (lua_type(L, -1) != LUA_TNUMBER) {
+		// Not a variable, look for a method of the data model.
+		if (luaL_getmetafield(L, 1, "__methods") != 0) {
+			lua_pushvalue(L, 2);
+			lua_rawget(L, -2);
+			if (!lua_isnil(L, -1))
+				return 1;
+		}
+		luaL_error(L, "DataModel has no key : %s", lua_tostring(L, 2));
+	}
+	int id = (int)lua_tointeger(L, -1);
+	lua_settop(L, 2);
 	lua_pushvalue(dataL, id);
 	lua_xmove(dataL, L, 1);
+	if (D->track_nested_writes && lua_type(L, 3) == LUA_TTABLE)
+		PushProxy(L, 1, 2, 3);
 	return 1;
 }
 
@@ -296,6 +494,8 @@ lDataModelSet(lua_State *L) {
 	lua_State *dataL = D->dataL;
 	if (dataL == NULL)
 		luaL_error(L, "DataModel released");
+	lua_settop(L, 3);
+	UnwrapProxy(L, 3);
 	lua_settop(dataL, D->top);
 
 	lua_pushvalue(L, 2);
@@ -305,8 +505,14 @@ lDataModelSet(lua_State *L) {
 		int id = (int)lua_tointeger(dataL, -1);
 		lua_pop(dataL, 1);
 		lua_xmove(L, dataL, 1);
+		// Views only need to be updated when the value actually changed. Tables may have been modified in place, such as
+		// through a reference kept from before they were proxied, so 'model.list = model.list' still dirties the variable.
+		if (lua_type(dataL, -1) != LUA_TTABLE && lua_rawequal(dataL, -1, id)) {
+			lua_pop(dataL, 1);
+			return 0;
+		}
 		lua_replace(dataL, id);
-		D->handle.DirtyVariable(lua_tostring(L, 2));
+		DirtyModelVariable(L, D, 1, 2);
 		return 0;
 	}
 	lua_pop(dataL, 1);
@@ -315,9 +521,16 @@ lDataModelSet(lua_State *L) {
 }
 
 bool
-OpenLuaDataModel(lua_State *L, Context *context, int name_index, int table_index) {
+OpenLuaDataModel(lua_State *L, Context *context, int name_index, int table_index, int options_index) {
 	String name = luaL_checkstring(L, name_index);
 	luaL_checktype(L, table_index, LUA_TTABLE);
+	bool track_nested_writes = false;
+	if (!lua_isnoneornil(L, options_index)) {
+		luaL_checktype(L, options_index, LUA_TTABLE);
+		lua_getfield(L, options_index, "track_nested_writes");
+		track_nested_writes = lua_toboolean(L, -1) != 0;
+		lua_pop(L, 1);
+	}
 
 	DataModelConstructor constructor = context->CreateDataModel(name);
 	if (!constructor) {
@@ -331,6 +544,8 @@ OpenLuaDataModel(lua_State *L, Context *context, int name_index, int table_index
 	D->dataL = nullptr;
 	D->scalarDef = nullptr;
 	D->tableDef = nullptr;
+	D->batch_depth = 0;
+	D->track_nested_writes = track_nested_writes;
 	D->constructor = constructor;
 	D->handle = constructor.GetModelHandle();
 
@@ -343,6 +558,17 @@ OpenLuaDataModel(lua_State *L, Context *context, int name_index, int table_index
 	while (lua_next(L, table_index) != 0) {
 		BindVariable(D, L);
 	}
+	lua_createtable(L, 3, 0);
+	lua_insert(L, -2);
+	lua_rawseti(L, -2, MODEL_THREAD);
+	lua_newtable(L);
+	lua_newtable(L);
+	lua_pushstring(L, "k");
+	lua_setfield(L, -2, "__mode");
+	lua_setmetatable(L, -2);
+	lua_rawseti(L, -2, MODEL_PROXIES);
+	lua_newtable(L);
+	lua_rawseti(L, -2, MODEL_PENDING);
 	lua_setuservalue(L, -2);
 
 	if (luaL_newmetatable(L, RMLDATAMODEL)) {
@@ -352,9 +578,28 @@ OpenLuaDataModel(lua_State *L, Context *context, int name_index, int table_index
 			{ nullptr, nullptr },
 		};
 		luaL_setfuncs(L, l, 0);
+		luaL_Reg methods[] = {
+			{ "batch", lDataModelBatch },
+			{ nullptr, nullptr },
+		};
+		lua_newtable(L);
+		luaL_setfuncs(L, methods, 0);
+		lua_setfield(L, -2, "__methods");
 	}
 	lua_setmetatable(L, -2);
 
+	if (luaL_newmetatable(L, RMLDATAMODELPROXY)) {
+		luaL_Reg l[] = {
+			{ "__index", lDataModelProxyGet },
+			{ "__newindex", lDataModelProxySet },
+			{ "__len", lDataModelProxyLen },
+			{ "__pairs", lDataModelProxyPairs },
+			{ nullptr, nullptr },
+		};
+		luaL_setfuncs(L, l, 0);
+	}
+	lua_pop(L, 1);
+
 	return true;
 }
 
@@ -38,8 +38,9 @@ namespace Lua {
 
 struct LuaDataModel;
 
-// Create or Get a DataModel in L, return false on fail
-bool OpenLuaDataModel(lua_State *L, Rml::Context *context, int name_index, int table_index);
+// Create or Get a DataModel in L, return false on fail. The optional options table at options_index may enable
+// 'track_nested_writes', see Lua.h.
+bool OpenLuaDataModel(lua_State *L, Rml::Context *context, int name_index, int table_index, int options_index);
 // Should Close object (on L top) after DataModel released (Context::RemoveDataModel)
 void CloseLuaDataModel(lua_State *L);
 
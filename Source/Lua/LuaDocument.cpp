@@ -27,6 +27,7 @@
  */
  
 #include "LuaDocument.h"
+#include "ProfilerScope.h"
 #include <RmlUi/Core/Stream.h>
 #include <RmlUi/Lua/IncludeLua.h>
 #include <RmlUi/Lua/Interpreter.h>
@@ -48,11 +49,15 @@ void LuaDocument::LoadInlineScript(const String& context, const String& source_p
     buffer += Rml::ToString(source_line);
     buffer += "\n";
     buffer += context;
+
+    const String profiler_name = source_path + ":" + Rml::ToString(source_line);
+    ProfilerScope profiler_scope(Profiler::Category::DocumentScript, profiler_name);
     Interpreter::DoString(buffer, buffer);
 }
 
 void LuaDocument::LoadExternalScript(const String& source_path)
 {
+    ProfilerScope profiler_scope(Profiler::Category::DocumentScript, source_path);
     Interpreter::LoadFile(source_path);
 }
 
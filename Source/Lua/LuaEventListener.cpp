@@ -27,10 +27,12 @@
  */
  
 #include "LuaEventListener.h"
+#include "ProfilerScope.h"
 #include <RmlUi/Lua/Interpreter.h>
 #include <RmlUi/Lua/LuaType.h>
 #include <RmlUi/Lua/Utilities.h>
 #include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/StringUtilities.h>
 
 namespace Rml {
 namespace Lua {
@@ -38,11 +40,6 @@ typedef ElementDocument Document;
 
 LuaEventListener::LuaEventListener(const String& code, Element* element) : EventListener()
 {
-    //compose function
-    String function = "return function (event,element,document) ";
-    function.append(code);
-    function.append(" end");
-
     //make sure there is an area to save the function
     lua_State* L = Interpreter::GetLuaState();
     int top = lua_gettop(L);
@@ -56,21 +53,53 @@ LuaEventListener::LuaEventListener(const String& code, Element* element) : Event
     }
     int tbl = lua_gettop(L);
 
-    //compile,execute,and save the function
-    if (!Interpreter::LoadString(function, code) || !Interpreter::ExecuteCall(0, 1))
+    //identical inline handlers, such as on the elements generated by a data-for loop, share the same compiled function
+    //the values are weak so that functions are collected once no listener references them anymore
+    lua_getfield(L,LUA_REGISTRYINDEX,"EVENTLISTENERCODE");
+    if(lua_isnoneornil(L,-1))
     {
-        return;
+        lua_pop(L,1); //pop the unsucessful getfield
+        lua_newtable(L);
+        lua_newtable(L); //metatable of the cache
+        lua_pushstring(L,"v");
+        lua_setfield(L,-2,"__mode");
+        lua_setmetatable(L,-2);
+        lua_pushvalue(L,-1);
+        lua_setfield(L,LUA_REGISTRYINDEX,"EVENTLISTENERCODE");
+    }
+    int cache = lua_gettop(L);
+
+    lua_pushlstring(L,code.c_str(),code.size());
+    lua_rawget(L,cache);
+    if(lua_isnil(L,-1))
+    {
+        lua_pop(L,1); //pop the cache miss
+
+        //compose function
+        String function = "return function (event,element,document) ";
+        function.append(code);
+        function.append(" end");
+
+        //compile and execute the function, and save it in the cache
+        if (!Interpreter::LoadString(function, code) || !Interpreter::ExecuteCall(0, 1))
+        {
+            lua_settop(L,top);
+            return;
+        }
+
+        lua_pushlstring(L,code.c_str(),code.size());
+        lua_pushvalue(L,-2);
+        lua_rawset(L,cache);
     }
 
     luaFuncRef = luaL_ref(L,tbl); //creates a reference to the item at the top of the stack in to the table we just created
-    lua_pop(L,1); //pop the EVENTLISTENERFUNCTIONS table
 
     attached = element;
 	if(element)
 		owner_document = element->GetOwnerDocument();
 	else
 		owner_document = nullptr;
-    strFunc = function;
+    strFunc = code;
     lua_settop(L,top);
 }
 
@@ -90,6 +119,11 @@ LuaEventListener::LuaEventListener(lua_State* L, int narg, Element* element)
 	luaFuncRef = luaL_ref(L,-2); //put the funtion as a ref in to that table
 	lua_pop(L,1); //pop the EVENTLISTENERFUNCTIONS table
 
+	lua_Debug ar;
+	lua_pushvalue(L,narg);
+	if(lua_getinfo(L,">S",&ar)) //pops the function
+		strFunc = CreateString(LUA_IDSIZE + 32, "%s:%d", ar.short_src, ar.linedefined);
+
 	attached = element;
 	if(element)
 		owner_document = element->GetOwnerDocument();
@@ -131,6 +165,7 @@ void LuaEventListener::ProcessEvent(Event& event)
 	LuaType<Element>::push(L,attached,false);
     LuaType<Document>::push(L,owner_document,false);
     
+    ProfilerScope profiler_scope(Profiler::Category::EventHandler, strFunc);
     Interpreter::ExecuteCall(3,0); //call the function at the top of the stack with 3 arguments
 
     lua_settop(L,top); //balanced stack makes Lua happy
@@ -65,7 +65,7 @@ private:
 
     Element* attached = nullptr;
     ElementDocument* owner_document = nullptr;
-    String strFunc; //for debugging purposes
+    String strFunc; //for debugging and profiling purposes, the code or the source location of the function
 };
 
 } // namespace Lua
@@ -55,6 +55,7 @@ int LuaTypeImpl::index(lua_State* L, const char* class_name)
             lua_rawget(L, -2); //[-2 = __getters] -> __getters[key], result to [5]
             if (lua_type(L, -1) == LUA_TFUNCTION) //[-1 = 5]
             {
+                RecordBindingCall();
                 lua_pushvalue(L, 1); //push the userdata to the stack [6]
                 lua_call(L, 1, 1); //remove one, result is at [6]
             }
@@ -105,6 +106,7 @@ int LuaTypeImpl::newindex(lua_State* L, const char* class_name)
     lua_rawget(L, -2); //[-2 = __setters] -> __setters[key] to [6]
     if (lua_type(L, -1) == LUA_TFUNCTION)
     {
+        RecordBindingCall();
         lua_pushvalue(L, 1); //userdata at [7]
         lua_pushvalue(L, 3); //[8] = copy of [3]
         lua_call(L, 2, 0); //call function, pop 2 off push 0 on
@@ -0,0 +1,175 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+ 
+ 
+#include <RmlUi/Lua/Profiler.h>
+#include <RmlUi/Lua/LuaType.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/FrameStatistics.h>
+#include "ProfilerScope.h"
+#include <algorithm>
+#include <chrono>
+
+namespace Rml {
+namespace Lua {
+
+static constexpr int num_categories = 3;
+
+static bool profiler_enabled = false;
+static Profiler::Statistics statistics;
+static UnorderedMap<String, Profiler::Entry> entries[num_categories];
+
+// The number of scopes currently measuring, and the time spent in scopes nested in the innermost one.
+static int scope_depth = 0;
+static double nested_time = 0;
+
+// Handlers are timed with a monotonic clock, as the application's clock may be coarse, paused, or replayed.
+static double GetElapsedTime()
+{
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+static ScriptHandlerStatisticsList GetHandlerStatistics()
+{
+    static const char* category_names[num_categories] = { "Event", "Script", "Data model" };
+
+    ScriptHandlerStatisticsList result;
+    for (const Profiler::Entry& entry : Profiler::GetEntries())
+    {
+        ScriptHandlerStatistics handler;
+        handler.name = String(category_names[(int)entry.category]) + ": " + entry.name;
+        handler.calls = entry.calls;
+        handler.time = entry.time;
+        result.push_back(std::move(handler));
+    }
+    return result;
+}
+
+void Profiler::SetEnabled(bool enable)
+{
+    if (enable != profiler_enabled)
+        SetScriptHandlerStatisticsFunction(enable ? ScriptHandlerStatisticsFunction(&GetHandlerStatistics) : nullptr);
+
+    profiler_enabled = enable;
+}
+
+bool Profiler::IsEnabled()
+{
+    return profiler_enabled;
+}
+
+const Profiler::Statistics& Profiler::GetStatistics()
+{
+    return statistics;
+}
+
+Profiler::EntryList Profiler::GetEntries()
+{
+    EntryList result;
+    for (const auto& category_entries : entries)
+    {
+        for (const auto& entry : category_entries)
+            result.push_back(entry.second);
+    }
+    std::sort(result.begin(), result.end(), [](const Entry& a, const Entry& b) { return a.time > b.time; });
+    return result;
+}
+
+void Profiler::Reset()
+{
+    statistics = Statistics();
+    for (auto& category_entries : entries)
+        category_entries.clear();
+}
+
+ProfilerScope::ProfilerScope(Profiler::Category category, const String& _name) : active(profiler_enabled), category(category)
+{
+    if (active)
+    {
+        name = _name;
+        scope_depth += 1;
+        previous_nested_time = nested_time;
+        nested_time = 0;
+        start_time = GetElapsedTime();
+    }
+}
+
+ProfilerScope::~ProfilerScope()
+{
+    if (!active)
+        return;
+
+    const double elapsed_time = GetElapsedTime() - start_time;
+    const double time = elapsed_time - nested_time;
+
+    Profiler::Entry& entry = entries[(int)category][name];
+    if (entry.calls == 0)
+    {
+        entry.category = category;
+        entry.name = name;
+    }
+    entry.calls += 1;
+    entry.time += time;
+
+    switch (category)
+    {
+    case Profiler::Category::EventHandler:
+        statistics.event_handler_time += time;
+        statistics.event_handler_calls += 1;
+        break;
+    case Profiler::Category::DocumentScript:
+        statistics.document_script_time += time;
+        statistics.document_script_calls += 1;
+        break;
+    case Profiler::Category::DataModelCallback:
+        statistics.data_model_time += time;
+        statistics.data_model_calls += 1;
+        break;
+    }
+
+    nested_time = previous_nested_time + elapsed_time;
+    scope_depth -= 1;
+    if (scope_depth == 0)
+        RecordScriptTime(elapsed_time);
+}
+
+void LuaTypeImpl::RecordBindingCall()
+{
+    if (profiler_enabled)
+        statistics.binding_calls += 1;
+}
+
+void LuaTypeImpl::RecordUserdataAllocation()
+{
+    if (profiler_enabled)
+        statistics.userdata_allocations += 1;
+}
+
+} // namespace Lua
+} // namespace Rml
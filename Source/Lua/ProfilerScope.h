@@ -0,0 +1,59 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+ 
+ 
+#ifndef RMLUI_LUA_PROFILERSCOPE_H
+#define RMLUI_LUA_PROFILERSCOPE_H 
+
+#include <RmlUi/Lua/Profiler.h>
+
+namespace Rml {
+namespace Lua {
+
+/**
+    Measures the call from C++ into Lua made during the lifetime of the scope, does nothing unless the profiler is
+    enabled. The time of the outermost scope is reported to the frame statistics of the active context.
+*/
+class ProfilerScope
+{
+public:
+    ProfilerScope(Profiler::Category category, const String& name);
+    ~ProfilerScope();
+
+private:
+    bool active;
+    Profiler::Category category;
+    // Copied, as the call may destroy the owner of the name, such as an event listener removing its own element.
+    String name;
+    double start_time = 0;
+    double previous_nested_time = 0;
+};
+
+} // namespace Lua
+} // namespace Rml
+#endif
@@ -32,6 +32,7 @@
 #include "../../Include/RmlUi/Core/GeometryUtilities.h"
 #include "../../Include/RmlUi/Core/ElementDocument.h"
 #include "../../Include/RmlUi/Core/SystemInterface.h"
+#include "../../Include/RmlUi/Core/TaskInterface.h"
 #include "../../Include/RmlUi/Core/FileInterface.h"
 #include "../../Include/RmlUi/Core/Math.h"
 #include <cmath>
@@ -168,6 +169,8 @@ bool ElementSVG::LoadSource()
 		return false;
 	}
 
+	svg_source = std::move(svg_data);
+
 	intrinsic_dimensions.x = Math::Max(float(svg_document->width()), 1.0f);
 	intrinsic_dimensions.y = Math::Max(float(svg_document->height()), 1.0f);
 
@@ -183,12 +186,43 @@ void ElementSVG::UpdateTexture()
 	auto p_callback = [this](const String& /*name*/, UniquePtr<const byte[]>& data, Vector2i& dimensions) -> bool {
 		RMLUI_ASSERT(svg_document);
 
-		const size_t total_bytes = 4 * render_dimensions.x * render_dimensions.y;
-
-		lunasvg::Bitmap bitmap = svg_document->renderToBitmap(render_dimensions.x, render_dimensions.y);
-
-		data.reset(new byte[total_bytes]);
-		memcpy((void*)data.get(), bitmap.data(), total_bytes);
+		const size_t stride = 4 * render_dimensions.x;
+		const size_t total_bytes = stride * render_dimensions.y;
+
+		// Zero-initialize the data, the document is rendered on top of a transparent background.
+		byte* p_data = new byte[total_bytes]();
+
+		if (svg_document->width() > 0 && svg_document->height() > 0)
+		{
+			const double scale_x = double(render_dimensions.x) / svg_document->width();
+			const double scale_y = double(render_dimensions.y) / svg_document->height();
+
+			// Rasterize horizontal bands of the image in parallel. Each band renders the document translated such that
+			// only its own rows end up in its part of the texture data. Rendering is not guaranteed to be safe on the
+			// same document from several threads, thus each band but the top one loads its own copy of the document.
+			// Use at most one band per parallel task, so that the document is loaded no more times than necessary.
+			TaskInterface* task_interface = GetTaskInterface();
+			const int num_bands = Math::Max(task_interface->GetConcurrency(), 1);
+			const int rows_per_band = Math::Max((render_dimensions.y + num_bands - 1) / num_bands, 64);
+
+			task_interface->ParallelFor(0, render_dimensions.y, rows_per_band, [&](int begin, int end) {
+				std::unique_ptr<lunasvg::Document> band_document;
+				const lunasvg::Document* document = svg_document.get();
+				if (begin != 0)
+				{
+					band_document = lunasvg::Document::loadFromData(svg_source);
+					document = band_document.get();
+					if (!document)
+						return;
+				}
+
+				lunasvg::Bitmap bitmap(p_data + begin * stride, std::uint32_t(render_dimensions.x), std::uint32_t(end - begin), std::uint32_t(stride));
+				const lunasvg::Matrix matrix(scale_x, 0, 0, scale_y, 0, -double(begin));
+				document->render(bitmap, matrix);
+			});
+		}
+
+		data.reset(p_data);
 		dimensions = render_dimensions;
 
 		return true;
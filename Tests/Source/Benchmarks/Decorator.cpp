@@ -0,0 +1,132 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include "../../../Source/Core/GeometryDatabase.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static String document_decorator_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/../Tests/Data/style.rcss"/>
+	<style>
+		button {
+			display: block;
+			width: 200px;
+			height: 30px;
+			margin: 2px;
+		}
+		#image > button {
+			decorator: image(/assets/high_scores_alien_1.tga);
+		}
+		#gradient > button {
+			decorator: gradient(horizontal #ff0000 #00ff00);
+		}
+	</style>
+</head>
+
+<body>
+<div id="image"/>
+<div id="gradient"/>
+</body>
+</rml>
+)";
+
+static String GetGeometryStats()
+{
+	size_t buffer_size = 0;
+	const int num_geometries = GeometryDatabase::GetNumGeometries(buffer_size);
+	return CreateString(128, "Geometries: %d  Vertex and index buffers: %zu bytes", num_geometries, buffer_size);
+}
+
+TEST_CASE("decorator.shared_element_data")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_decorator_rml);
+	REQUIRE(document);
+	document->Show();
+
+	constexpr int num_buttons = 200;
+
+	nanobench::Bench bench;
+	bench.title("Decorator element data");
+	bench.relative(true);
+	bench.minEpochIterations(20);
+	bench.warmup(5);
+
+	// Buttons with equal sizes can share their decorator data, while buttons with distinct widths need their own.
+	for (const bool equal_size : {true, false})
+	{
+		ElementList buttons;
+
+		for (const String id : {"image", "gradient"})
+		{
+			Element* parent = document->GetElementById(id);
+			REQUIRE(parent);
+			parent->SetInnerRML("");
+
+			for (int i = 0; i < num_buttons; i++)
+			{
+				Element* button = parent->AppendChild(document->CreateElement("button"));
+				if (!equal_size)
+					button->SetProperty(PropertyId::Width, Property(float(100 + i), Property::PX));
+				buttons.push_back(button);
+			}
+		}
+
+		context->Update();
+		context->Render();
+
+		const String name = (equal_size ? "Equal size" : "Distinct size");
+		MESSAGE(name << ": " << GetGeometryStats());
+
+		bool toggle = false;
+		bench.run(name + " (regenerate decorators)", [&] {
+			// Force regeneration of the decorator data without changing layout.
+			toggle = !toggle;
+			const Colourb image_color = (toggle ? Colourb(255, 255, 255) : Colourb(255, 255, 254));
+			for (Element* button : buttons)
+				button->SetProperty(PropertyId::ImageColor, Property(image_color, Property::COLOUR));
+			context->Update();
+			context->Render();
+		});
+	}
+
+	document->Close();
+}
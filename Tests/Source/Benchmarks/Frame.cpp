@@ -0,0 +1,247 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FileInterface.h>
+#include <RmlUi/Core/InputRecording.h>
+#include <RmlUi/Core/Math.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+#include <algorithm>
+#include <chrono>
+#include <stdlib.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+// Plays back the same input on every run: the mouse sweeps across the context while clicking and scrolling.
+class ScriptedInput {
+public:
+	ScriptedInput(Context* context) : context(context) {}
+
+	void NextFrame()
+	{
+		const Vector2f dimensions = Vector2f(context->GetDimensions());
+		const float t = float(frame);
+		const int x = int(dimensions.x * (0.5f + 0.45f * Math::Sin(0.05f * t)));
+		const int y = int(dimensions.y * (0.5f + 0.45f * Math::Sin(0.037f * t)));
+
+		context->ProcessMouseMove(x, y, 0);
+
+		if (frame % 20 == 0)
+			context->ProcessMouseButtonDown(0, 0);
+		else if (frame % 20 == 2)
+			context->ProcessMouseButtonUp(0, 0);
+
+		if (frame % 50 == 25)
+			context->ProcessMouseWheel(1.f, 0);
+		else if (frame % 50 == 45)
+			context->ProcessMouseWheel(-1.f, 0);
+
+		frame += 1;
+	}
+
+private:
+	Context* context;
+	int frame = 0;
+};
+
+static void BenchmarkFrames(const String& title, const StringList& document_paths)
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	nanobench::Bench bench;
+	bench.title(title);
+	bench.relative(true);
+	bench.warmup(20);
+	bench.minEpochIterations(50);
+
+	for (bool compiled_geometry : {false, true})
+	{
+		const String mode = (compiled_geometry ? "compiled geometry" : "immediate");
+		render_interface->EnableCompiledGeometry(compiled_geometry);
+
+		Vector<ElementDocument*> documents;
+		for (const String& path : document_paths)
+		{
+			ElementDocument* document = context->LoadDocument(path);
+			REQUIRE(document);
+			document->Show();
+			documents.push_back(document);
+		}
+
+		ScriptedInput input(context);
+
+		auto frame = [&] {
+			input.NextFrame();
+			context->Update();
+			context->Render();
+		};
+
+		// Record the render counters over a fixed number of frames, after the initial frames have settled.
+		for (int i = 0; i < 10; i++)
+			frame();
+
+		const int num_frames = 200;
+		render_interface->ResetCounters();
+		for (int i = 0; i < num_frames; i++)
+			frame();
+
+		const TestsRenderInterface::Counters& counters = render_interface->GetCounters();
+		MESSAGE(CreateString(512,
+			"%s (%s), average per frame:\n"
+			"  Render calls: %.1f\n"
+			"  Vertices: %.1f\n"
+			"  Indices: %.1f\n"
+			"  Texture binds: %.1f\n"
+			"  Scissor set: %.1f\n"
+			"  Transform set: %.1f\n"
+			"  Geometry compile: %.1f\n"
+			"  Compiled geometry release: %.1f\n"
+			"  Texture load + generate: %.1f",
+			title.c_str(), mode.c_str(),
+			double(counters.render_calls) / num_frames,
+			double(counters.vertices) / num_frames,
+			double(counters.indices) / num_frames,
+			double(counters.texture_binds) / num_frames,
+			double(counters.set_scissor) / num_frames,
+			double(counters.set_transform) / num_frames,
+			double(counters.compile_geometry) / num_frames,
+			double(counters.release_compiled_geometry) / num_frames,
+			double(counters.load_texture + counters.generate_texture) / num_frames
+		));
+
+		bench.run("Update + Render (" + mode + ")", frame);
+
+		for (ElementDocument* document : documents)
+			document->Close();
+		context->Update();
+	}
+
+	render_interface->EnableCompiledGeometry(false);
+}
+
+TEST_CASE("frame.demo")
+{
+	BenchmarkFrames("Frame demo", {"basic/demo/data/demo.rml"});
+}
+
+TEST_CASE("frame.invaders")
+{
+	BenchmarkFrames("Frame invaders", {"invaders/data/logo.rml", "invaders/data/main_menu.rml", "invaders/data/options.rml"});
+}
+
+// Replays a recorded session and reports the distribution of frame times. By default, a session with the scripted
+// input over the demo document is recorded first. Set the environment variable RMLUI_REPLAY_RECORDING to the path of
+// a recording made with Rml::InputRecorder to replay it instead, and RMLUI_REPLAY_DOCUMENTS to a comma-separated list
+// of the documents to load for it.
+TEST_CASE("frame.replay")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	StringList document_paths = {"basic/demo/data/demo.rml"};
+	String recording;
+
+	if (const char* recording_path = getenv("RMLUI_REPLAY_RECORDING"))
+	{
+		REQUIRE(GetFileInterface()->LoadFile(recording_path, recording));
+		if (const char* documents = getenv("RMLUI_REPLAY_DOCUMENTS"))
+			StringUtilities::ExpandString(document_paths, documents);
+	}
+
+	Vector<ElementDocument*> documents;
+	for (const String& path : document_paths)
+	{
+		ElementDocument* document = context->LoadDocument(path);
+		REQUIRE(document);
+		document->Show();
+		documents.push_back(document);
+	}
+
+	if (recording.empty())
+	{
+		InputRecorder recorder(context);
+		ScriptedInput input(context);
+		for (int i = 0; i < 300; i++)
+		{
+			input.NextFrame();
+			context->Update();
+			context->Render();
+		}
+		recording = recorder.GetRecording();
+	}
+
+	using Clock = std::chrono::high_resolution_clock;
+	Vector<double> frame_times;
+
+	auto replay = [&] {
+		InputReplayer replayer(context, recording);
+		REQUIRE(replayer.IsValid());
+		while (replayer.NextFrame())
+		{
+			const auto start = Clock::now();
+			context->Update();
+			context->Render();
+			frame_times.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+		}
+	};
+
+	nanobench::Bench bench;
+	bench.title("Frame replay");
+	bench.run("Replay session", replay);
+
+	REQUIRE(!frame_times.empty());
+	std::sort(frame_times.begin(), frame_times.end());
+	auto percentile = [&](double p) { return frame_times[size_t(p * double(frame_times.size() - 1))]; };
+
+	MESSAGE(CreateString(256,
+		"Replayed %zu frames, Update + Render frame times (us):\n"
+		"  Median: %.1f\n"
+		"  90th percentile: %.1f\n"
+		"  99th percentile: %.1f\n"
+		"  Max: %.1f",
+		frame_times.size(), percentile(0.5), percentile(0.9), percentile(0.99), frame_times.back()
+	));
+
+	for (ElementDocument* document : documents)
+		document->Close();
+	context->Update();
+}
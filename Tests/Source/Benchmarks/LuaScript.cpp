@@ -0,0 +1,325 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+
+#ifdef RMLUI_BENCHMARKS_LUA
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Types.h>
+#include <RmlUi/Lua/IncludeLua.h>
+#include <RmlUi/Lua/Interpreter.h>
+#include <RmlUi/Lua/Lua.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+static const String document_rml = R"(
+<rml>
+<head>
+	<title>Lua Benchmark</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+	</style>
+</head>
+<body id="lua_benchmark">
+<div id="performance"/>
+</body>
+</rml>
+)";
+
+static const String script = R"(
+local document = rmlui.contexts["main"].documents["lua_benchmark"]
+
+local function count_descendants(element)
+	local count = 0
+	local child = element.first_child
+	while child do
+		count = count + 1 + count_descendants(child)
+		child = child.next_sibling
+	end
+	return count
+end
+
+function benchmark_sibling_traversal()
+	return count_descendants(document)
+end
+
+function benchmark_child_nodes()
+	local count = 0
+	local rows = document:GetElementById("performance").child_nodes
+	local i = 1
+	while rows[i] do
+		local cells = rows[i].child_nodes
+		local j = 1
+		while cells[j] do
+			count = count + 1
+			j = j + 1
+		end
+		i = i + 1
+	end
+	return count
+end
+
+function benchmark_parent_traversal()
+	local count = 0
+	local element = document:GetElementById("deepest")
+	while element do
+		count = count + 1
+		element = element.parent_node
+	end
+	return count
+end
+)";
+
+static void CallGlobal(lua_State* L, const char* name)
+{
+	lua_getglobal(L, name);
+	if (lua_pcall(L, 0, 1, 0) != 0)
+		FAIL(lua_tostring(L, -1));
+	lua_pop(L, 1);
+}
+
+TEST_CASE("lua.dom_traversal")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	if (!Rml::Lua::Interpreter::GetLuaState())
+		Rml::Lua::Initialise();
+	lua_State* L = Rml::Lua::Interpreter::GetLuaState();
+	REQUIRE(L);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	String rml;
+	for (int i = 0; i < 200; i++)
+		rml += "<div class=\"row\"><span>A</span><span>B</span><span>C</span><span>D</span></div>";
+	for (int i = 0; i < 50; i++)
+		rml += "<div>";
+	rml += "<div id=\"deepest\"/>";
+	for (int i = 0; i < 50; i++)
+		rml += "</div>";
+
+	el->SetInnerRML(rml);
+	context->Update();
+	context->Render();
+
+	REQUIRE(Rml::Lua::Interpreter::DoString(script, "benchmark"));
+
+	nanobench::Bench bench;
+	bench.title("Lua DOM traversal");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("first_child / next_sibling", [&] {
+		CallGlobal(L, "benchmark_sibling_traversal");
+	});
+
+	bench.run("child_nodes[i]", [&] {
+		CallGlobal(L, "benchmark_child_nodes");
+	});
+
+	bench.run("parent_node", [&] {
+		CallGlobal(L, "benchmark_parent_traversal");
+	});
+
+	document->Close();
+	context->Update();
+}
+
+TEST_CASE("lua.inline_event_handlers")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	if (!Rml::Lua::Interpreter::GetLuaState())
+		Rml::Lua::Initialise();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	// Identical inline handlers, as generated by e.g. a data-for loop.
+	String rml;
+	for (int i = 0; i < 1000; i++)
+		rml += "<button onclick=\"element:SetClass('clicked', not element:IsClassSet('clicked'))\">Button</button>";
+
+	nanobench::Bench bench;
+	bench.title("Lua inline event handlers");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("SetInnerRML", [&] {
+		el->SetInnerRML(rml);
+	});
+
+	document->Close();
+	context->Update();
+}
+
+static const String bulk_script = R"(
+local function performance_element()
+	return rmlui.contexts["main"].documents["lua_benchmark"]:GetElementById("performance")
+end
+
+function benchmark_build_per_call()
+	local el = performance_element()
+	local document = el.owner_document
+	el.inner_rml = ""
+	for i = 1, 100 do
+		local row = document:CreateElement("div")
+		row:SetAttribute("class", "row")
+		row.style["height"] = "20px"
+		row.style["color"] = "red"
+		for j = 1, 4 do
+			local cell = document:CreateElement("span")
+			cell:AppendChild(document:CreateTextNode("cell"))
+			row:AppendChild(cell)
+		end
+		el:AppendChild(row)
+	end
+end
+
+function benchmark_build_tree()
+	local el = performance_element()
+	el.inner_rml = ""
+	for i = 1, 100 do
+		el:AppendTree({
+			tag = "div", attributes = { class = "row" }, style = { height = "20px", color = "red" },
+			{ tag = "span", text = "cell" }, { tag = "span", text = "cell" },
+			{ tag = "span", text = "cell" }, { tag = "span", text = "cell" },
+		})
+	end
+end
+
+local texts = {}
+for i = 1, 100 do
+	texts["text" .. i] = "Value " .. i
+end
+
+function benchmark_texts_per_call()
+	local el = performance_element()
+	for id, text in pairs(texts) do
+		el:GetElementById(id).inner_rml = text
+	end
+end
+
+function benchmark_texts_bulk()
+	performance_element():SetTexts(texts)
+end
+
+function benchmark_style_per_call()
+	local style = performance_element().style
+	style["width"] = "200px"
+	style["height"] = "100px"
+	style["color"] = "blue"
+	style["background-color"] = "green"
+	style["padding-left"] = "5px"
+end
+
+function benchmark_style_bulk()
+	performance_element():SetProperties({
+		["width"] = "200px", ["height"] = "100px", ["color"] = "blue",
+		["background-color"] = "green", ["padding-left"] = "5px",
+	})
+end
+)";
+
+TEST_CASE("lua.bulk_dom")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	if (!Rml::Lua::Interpreter::GetLuaState())
+		Rml::Lua::Initialise();
+	lua_State* L = Rml::Lua::Interpreter::GetLuaState();
+	REQUIRE(L);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	Element* el = document->GetElementById("performance");
+	REQUIRE(el);
+
+	REQUIRE(Rml::Lua::Interpreter::DoString(bulk_script, "benchmark"));
+
+	nanobench::Bench bench;
+	bench.title("Lua bulk DOM operations");
+	bench.timeUnit(std::chrono::microseconds(1), "us");
+	bench.relative(true);
+
+	bench.run("Build per call", [&] {
+		CallGlobal(L, "benchmark_build_per_call");
+	});
+	bench.run("Build with AppendTree", [&] {
+		CallGlobal(L, "benchmark_build_tree");
+	});
+
+	String rml;
+	for (int i = 1; i <= 100; i++)
+		rml += CreateString(64, "<p id=\"text%d\">Text</p>", i);
+	el->SetInnerRML(rml);
+
+	bench.run("Texts per call", [&] {
+		CallGlobal(L, "benchmark_texts_per_call");
+	});
+	bench.run("Texts with SetTexts", [&] {
+		CallGlobal(L, "benchmark_texts_bulk");
+	});
+
+	bench.run("Style per call", [&] {
+		CallGlobal(L, "benchmark_style_per_call");
+	});
+	bench.run("Style with SetProperties", [&] {
+		CallGlobal(L, "benchmark_style_bulk");
+	});
+
+	document->Close();
+	context->Update();
+}
+
+#endif
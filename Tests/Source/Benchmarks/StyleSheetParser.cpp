@@ -0,0 +1,117 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+ 
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/StreamMemory.h>
+#include <RmlUi/Core/StyleSheetContainer.h>
+#include <RmlUi/Core/Types.h>
+
+#include <doctest.h>
+#include <nanobench.h>
+
+using namespace ankerl;
+using namespace Rml;
+
+// Generates a style sheet with a mix of selectors, properties, comments and at-rules similar to hand-written ones.
+static String GenerateStyleSheet(int num_rules)
+{
+	String rcss;
+	rcss.reserve(num_rules * 200);
+
+	for (int i = 0; i < num_rules; i++)
+	{
+		if (i % 50 == 0)
+			rcss += CreateString(128, "/* Section %d\n   of the generated style sheet. */\n", i / 50);
+
+		if (i % 200 == 199)
+		{
+			rcss += CreateString(128, "@keyframes anim%d {\n\tfrom { opacity: 0; }\n\tto { opacity: 1; }\n}\n", i);
+			continue;
+		}
+
+		switch (i % 4)
+		{
+		case 0: rcss += CreateString(128, "div.panel%d > p.text, #item%d", i, i); break;
+		case 1: rcss += CreateString(128, "ul.list%d li:nth-child(2n+1)", i); break;
+		case 2: rcss += CreateString(128, "button.action%d:hover", i); break;
+		case 3: rcss += CreateString(128, "tabset tab.tab%d:selected", i); break;
+		}
+
+		rcss += CreateString(512,
+			" {\n"
+			"\tdisplay: block;\n"
+			"\twidth: %dpx;\n"
+			"\tmargin: 2px 4px %ddp 1em;\n"
+			"\tcolor: #%06x;\n"
+			"\tbackground-color: rgba(%d, 50, 100, 200); /* Semi-transparent */\n"
+			"\tfont-family: \"LatoLatin\";\n"
+			"\ttransition: color background-color 0.2s cubic-in-out;\n"
+			"}\n",
+			i % 500, i % 20, (i * 2654435761u) & 0xffffff, i % 256);
+	}
+
+	return rcss;
+}
+
+TEST_CASE("style_sheet_parser")
+{
+	// Initializes the property specification used by the parser.
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const String rcss = GenerateStyleSheet(5000);
+
+	nanobench::Bench bench;
+	bench.title("Style sheet parser");
+	bench.timeUnit(std::chrono::milliseconds(1), "ms");
+
+	bench.run("Parse large style sheet", [&] {
+		StreamMemory stream((const byte*)rcss.data(), rcss.size());
+		StyleSheetContainer style_sheet_container;
+		bool result = style_sheet_container.LoadStyleSheetContainer(&stream);
+		nanobench::doNotOptimizeAway(result);
+	});
+
+	String style_attribute;
+	for (int i = 0; i < 20; i++)
+		style_attribute += CreateString(64, "width: %dpx; height: %dpx; color: #%06x;", i, i, i * 1000);
+
+	ElementDocument* document = context->LoadDocumentFromMemory("<rml><body/></rml>");
+	REQUIRE(document);
+
+	bench.run("Parse style attribute", [&] {
+		document->SetAttribute("style", style_attribute);
+	});
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -72,9 +72,37 @@ void TestsSystemInterface::SetNumExpectedWarnings(int in_num_expected_warnings)
 	num_expected_warnings = in_num_expected_warnings;
 }
 
-void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int /*num_vertices*/, int* /*indices*/, int /*num_indices*/, const Rml::TextureHandle /*texture*/, const Rml::Vector2f& /*translation*/)
+void TestsRenderInterface::RenderGeometry(Rml::Vertex* /*vertices*/, int num_vertices, int* /*indices*/, int num_indices, const Rml::TextureHandle texture, const Rml::Vector2f& /*translation*/)
 {
-	counters.render_calls += 1;
+	RecordDrawCall(num_vertices, num_indices, texture);
+}
+
+Rml::CompiledGeometryHandle TestsRenderInterface::CompileGeometry(Rml::Vertex* /*vertices*/, int num_vertices, int* /*indices*/, int num_indices, Rml::TextureHandle texture)
+{
+	if (!compiled_geometry_enabled)
+		return 0;
+
+	counters.compile_geometry += 1;
+
+	const Rml::CompiledGeometryHandle handle = ++last_handle;
+	compiled_geometries[handle] = CompiledGeometry{num_vertices, num_indices, texture};
+	return handle;
+}
+
+void TestsRenderInterface::RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& /*translation*/)
+{
+	counters.render_compiled_geometry += 1;
+
+	auto it = compiled_geometries.find(geometry);
+	CHECK_MESSAGE(it != compiled_geometries.end(), "Rendering unknown compiled geometry.");
+	if (it != compiled_geometries.end())
+		RecordDrawCall(it->second.num_vertices, it->second.num_indices, it->second.texture);
+}
+
+void TestsRenderInterface::ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry)
+{
+	counters.release_compiled_geometry += 1;
+	CHECK_MESSAGE(compiled_geometries.erase(geometry) == 1, "Releasing unknown compiled geometry.");
 }
 
 void TestsRenderInterface::EnableScissorRegion(bool /*enable*/)
@@ -90,25 +118,39 @@ void TestsRenderInterface::SetScissorRegion(int /*x*/, int /*y*/, int /*width*/,
 bool TestsRenderInterface::LoadTexture(Rml::TextureHandle& texture_handle, Rml::Vector2i& texture_dimensions, const Rml::String& /*source*/)
 {
 	counters.load_texture += 1;
-	texture_handle = 1;
+	texture_handle = ++last_handle;
 	texture_dimensions.x = 512;
 	texture_dimensions.y = 256;
+	textures.insert(texture_handle);
 	return true;
 }
 
 bool TestsRenderInterface::GenerateTexture(Rml::TextureHandle& texture_handle, const Rml::byte* /*source*/, const Rml::Vector2i& /*source_dimensions*/)
 {
 	counters.generate_texture += 1;
-	texture_handle = 1;
+	texture_handle = ++last_handle;
+	textures.insert(texture_handle);
 	return true;
 }
 
-void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle /*texture_handle*/)
+void TestsRenderInterface::ReleaseTexture(Rml::TextureHandle texture_handle)
 {
 	counters.release_texture += 1;
+	CHECK_MESSAGE(textures.erase(texture_handle) == 1, "Releasing unknown texture.");
 }
 
 void TestsRenderInterface::SetTransform(const Rml::Matrix4f* /*transform*/)
 {
 	counters.set_transform += 1;
 }
+
+void TestsRenderInterface::RecordDrawCall(int num_vertices, int num_indices, Rml::TextureHandle texture)
+{
+	counters.render_calls += 1;
+	counters.vertices += (size_t)num_vertices;
+	counters.indices += (size_t)num_indices;
+
+	if (texture && texture != last_texture)
+		counters.texture_binds += 1;
+	last_texture = texture;
+}
@@ -50,21 +50,34 @@ private:
 };
 
 
+// A headless render interface which does not render anything, but records statistics about all calls made to it.
 class TestsRenderInterface : public Rml::RenderInterface
 {
 public:
 	struct Counters {
+		// Immediate and compiled draw calls, and their total number of vertices and indices.
 		size_t render_calls;
+		size_t vertices;
+		size_t indices;
+		// Number of textured draw calls using a different texture than the previous draw call.
+		size_t texture_binds;
 		size_t enable_scissor;
 		size_t set_scissor;
 		size_t load_texture;
 		size_t generate_texture;
 		size_t release_texture;
 		size_t set_transform;
+		size_t compile_geometry;
+		size_t render_compiled_geometry;
+		size_t release_compiled_geometry;
 	};
 
 	void RenderGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture, const Rml::Vector2f& translation) override;
 
+	Rml::CompiledGeometryHandle CompileGeometry(Rml::Vertex* vertices, int num_vertices, int* indices, int num_indices, Rml::TextureHandle texture) override;
+	void RenderCompiledGeometry(Rml::CompiledGeometryHandle geometry, const Rml::Vector2f& translation) override;
+	void ReleaseCompiledGeometry(Rml::CompiledGeometryHandle geometry) override;
+
 	void EnableScissorRegion(bool enable) override;
 	void SetScissorRegion(int x, int y, int width, int height) override;
 
@@ -74,15 +87,45 @@ public:
 
 	void SetTransform(const Rml::Matrix4f* transform) override;
 
+	// Compiled geometry is disabled by default, making the library render all geometry in immediate mode.
+	void EnableCompiledGeometry(bool enable) {
+		compiled_geometry_enabled = enable;
+	}
+
 	const Counters& GetCounters() const {
 		return counters;
 	}
 
 	void ResetCounters() {
 		counters = {};
+		last_texture = 0;
+	}
+
+	// Returns the number of textures and compiled geometries currently held by the library.
+	int GetNumLiveTextures() const {
+		return (int)textures.size();
+	}
+	int GetNumLiveCompiledGeometries() const {
+		return (int)compiled_geometries.size();
 	}
 
 private:
+	void RecordDrawCall(int num_vertices, int num_indices, Rml::TextureHandle texture);
+
+	struct CompiledGeometry {
+		int num_vertices;
+		int num_indices;
+		Rml::TextureHandle texture;
+	};
+
 	Counters counters = {};
+
+	bool compiled_geometry_enabled = false;
+
+	Rml::TextureHandle last_texture = 0;
+	uintptr_t last_handle = 0;
+
+	Rml::UnorderedSet<Rml::TextureHandle> textures;
+	Rml::UnorderedMap<Rml::CompiledGeometryHandle, CompiledGeometry> compiled_geometries;
 };
 #endif
@@ -185,25 +185,46 @@ Rml::String TestsShell::GetRenderStats()
 	shell_context->Render();
 	auto& counters = shell_render_interface.GetCounters();
 
-	result = Rml::CreateString(256,
+	result = Rml::CreateString(512,
 		"Context::Render() stats:\n"
 		"  Render calls: %zu\n"
+		"  Vertices: %zu\n"
+		"  Indices: %zu\n"
+		"  Texture binds: %zu\n"
 		"  Scissor enable: %zu\n"
 		"  Scissor set: %zu\n"
 		"  Texture load: %zu\n"
 		"  Texture generate: %zu\n"
 		"  Texture release: %zu\n"
-		"  Transform set: %zu",
+		"  Transform set: %zu\n"
+		"  Geometry compile: %zu\n"
+		"  Compiled geometry render: %zu\n"
+		"  Compiled geometry release: %zu",
 		counters.render_calls,
+		counters.vertices,
+		counters.indices,
+		counters.texture_binds,
 		counters.enable_scissor,
 		counters.set_scissor,
 		counters.load_texture,
 		counters.generate_texture,
 		counters.release_texture,
-		counters.set_transform
+		counters.set_transform,
+		counters.compile_geometry,
+		counters.render_compiled_geometry,
+		counters.release_compiled_geometry
 	);
 
 #endif
 
 	return result;
 }
+
+TestsRenderInterface* TestsShell::GetTestsRenderInterface()
+{
+#if defined(RMLUI_TESTS_USE_SHELL)
+	return nullptr;
+#else
+	return &shell_render_interface;
+#endif
+}
@@ -0,0 +1,436 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/FrameStatistics.h>
+#include <doctest.h>
+#include <chrono>
+#include <thread>
+
+using namespace Rml;
+
+static const String update_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		div {
+			display: block;
+			height: 20px;
+		}
+		div.large {
+			height: 40px;
+		}
+		#scroll {
+			height: 50px;
+			overflow-y: auto;
+		}
+		#scroll p {
+			height: 100px;
+		}
+	</style>
+</head>
+<body>
+<div id="left">
+	<div id="a">A</div>
+	<div>B</div>
+	<div>C</div>
+	<div>D</div>
+</div>
+<div id="right">
+	<div>E</div>
+	<div>F</div>
+	<div>G</div>
+	<div>H</div>
+</div>
+<div id="scroll"><p>Scroll</p></div>
+</body>
+</rml>
+)";
+
+// Updates and renders the context, as an application skipping idle frames would.
+static void RunFrame(Context* context)
+{
+	if (context->NeedsUpdate())
+		context->Update();
+	if (context->NeedsRender())
+		context->Render();
+}
+
+TEST_CASE("context.needs_update")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(update_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	CHECK(context->NeedsUpdate());
+	CHECK(context->NeedsRender());
+
+	context->Update();
+	context->Render();
+
+	// Nothing changed, a single update settles everything.
+	CHECK(!context->NeedsUpdate());
+	CHECK(!context->NeedsRender());
+
+	context->Update();
+	CHECK(!context->NeedsRender());
+	context->Render();
+	CHECK(context->GetFrameStatistics().element_updates == 0);
+
+	Element* element_a = document->GetElementById("a");
+
+	SUBCASE("class")
+	{
+		element_a->SetClass("large", true);
+		CHECK(context->NeedsUpdate());
+		// Changes are only reflected in rendering after an update.
+		CHECK(!context->NeedsRender());
+
+		context->Update();
+		CHECK(!context->NeedsUpdate());
+		CHECK(context->NeedsRender());
+		CHECK(element_a->GetBox().GetSize().y == 40.f);
+
+		context->Render();
+		CHECK(!context->NeedsRender());
+	}
+
+	SUBCASE("inline_style")
+	{
+		element_a->SetProperty("height", "30px");
+		CHECK(context->NeedsUpdate());
+		RunFrame(context);
+		CHECK(element_a->GetBox().GetSize().y == 30.f);
+	}
+
+	SUBCASE("text")
+	{
+		element_a->SetInnerRML("Changed");
+		CHECK(context->NeedsUpdate());
+		RunFrame(context);
+		CHECK(!context->NeedsUpdate());
+	}
+
+	SUBCASE("data_model")
+	{
+		int value = 1;
+		DataModelConstructor constructor = context->CreateDataModel("update");
+		REQUIRE(bool(constructor));
+		REQUIRE(constructor.Bind("value", &value));
+		DataModelHandle handle = constructor.GetModelHandle();
+
+		ElementDocument* model_document = context->LoadDocumentFromMemory(R"(
+			<rml><head><link type="text/rcss" href="/assets/rml.rcss"/></head>
+			<body style="font-family: LatoLatin;"><div id="value" data-model="update">{{ value }}</div></body></rml>)");
+		REQUIRE(model_document);
+		model_document->Show();
+		RunFrame(context);
+		CHECK(!context->NeedsUpdate());
+
+		value = 2;
+		handle.DirtyVariable("value");
+		CHECK(context->NeedsUpdate());
+		RunFrame(context);
+		CHECK(model_document->GetElementById("value")->GetInnerRML() == "2");
+
+		model_document->Close();
+		RunFrame(context);
+		context->RemoveDataModel("update");
+	}
+
+	SUBCASE("scroll")
+	{
+		document->GetElementById("scroll")->SetScrollTop(10.f);
+		CHECK(context->NeedsUpdate());
+		context->Update();
+		CHECK(context->NeedsRender());
+	}
+
+	SUBCASE("dimensions")
+	{
+		context->SetDimensions(context->GetDimensions() + Vector2i(10, 0));
+		CHECK(context->NeedsUpdate());
+		CHECK(context->NeedsRender());
+		RunFrame(context);
+	}
+
+	SUBCASE("document_order")
+	{
+		ElementDocument* other_document = context->LoadDocumentFromMemory(update_document_rml);
+		REQUIRE(other_document);
+		other_document->Show();
+		RunFrame(context);
+		CHECK(!context->NeedsRender());
+
+		document->PullToFront();
+		CHECK(context->NeedsRender());
+		RunFrame(context);
+
+		other_document->Close();
+		CHECK(context->NeedsUpdate());
+	}
+
+	RunFrame(context);
+	CHECK(!context->NeedsUpdate());
+	CHECK(!context->NeedsRender());
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.needs_update.request_during_update")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(update_document_rml);
+	REQUIRE(document);
+	document->Show();
+	RunFrame(context);
+
+	// Hiding a focused element blurs it while its properties are being updated, the resulting change to its definition
+	// must not be lost.
+	Element* element_a = document->GetElementById("a");
+	REQUIRE(element_a->Focus());
+	RunFrame(context);
+	CHECK(element_a->IsPseudoClassSet("focus"));
+
+	element_a->SetProperty("display", "none");
+	RunFrame(context);
+	CHECK(!element_a->IsPseudoClassSet("focus"));
+
+	element_a->SetProperty("display", "block");
+	for (int i = 0; i < 3; i++)
+		RunFrame(context);
+
+	CHECK(element_a->IsVisible());
+	CHECK(element_a->GetDisplay() == Style::Display::Block);
+	CHECK(!context->NeedsUpdate());
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.update_skips_clean_subtrees")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(update_document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	// Count all elements of the document.
+	int num_elements = 0;
+	auto count_elements = [&num_elements](Element* element, auto& count_ref) -> void {
+		num_elements += 1;
+		for (int i = 0; i < element->GetNumChildren(true); i++)
+			count_ref(element->GetChild(i), count_ref);
+	};
+	count_elements(document, count_elements);
+
+	// Only the changed element and elements affected by its change should be updated, not its siblings' subtrees.
+	document->GetElementById("a")->SetClass("large", true);
+	context->Update();
+	context->Render();
+
+	const int element_updates = context->GetFrameStatistics().element_updates;
+	CHECK(element_updates >= 1);
+	CHECK(element_updates < num_elements / 2);
+
+	// A change to an inherited property on an ancestor updates its whole subtree.
+	document->GetElementById("right")->SetProperty("color", "#f00");
+	context->Update();
+	context->Render();
+
+	CHECK(context->GetFrameStatistics().element_updates >= 5);
+	CHECK(context->GetFrameStatistics().element_updates < num_elements);
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.needs_update.animation")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(update_document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+	CHECK(!context->NeedsUpdate());
+
+	Element* element_a = document->GetElementById("a");
+	REQUIRE(element_a->Animate("height", Property(60.f, Property::PX), 0.1f));
+
+	// The element keeps requesting updates until the animation completes.
+	CHECK(context->NeedsUpdate());
+
+	int num_frames = 0;
+	for (; num_frames < 1000 && context->NeedsUpdate(); num_frames++)
+	{
+		RunFrame(context);
+		std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+
+	CHECK(num_frames > 1);
+	CHECK(!context->NeedsUpdate());
+	CHECK(element_a->GetBox().GetSize().y == 60.f);
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.update_every_frame")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(update_document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+	CHECK(!context->NeedsUpdate());
+
+	Element* element_a = document->GetElementById("a");
+	element_a->SetUpdateEveryFrame(true);
+	CHECK(element_a->IsUpdatedEveryFrame());
+
+	// The element is updated on every frame, while its siblings are skipped.
+	for (int i = 0; i < 3; i++)
+	{
+		CHECK(context->NeedsUpdate());
+		RunFrame(context);
+		CHECK(context->GetFrameStatistics().element_updates >= 1);
+		CHECK(context->GetFrameStatistics().element_updates <= 4);
+	}
+
+	SUBCASE("disable")
+	{
+		element_a->SetUpdateEveryFrame(false);
+		RunFrame(context);
+		RunFrame(context);
+		CHECK(!context->NeedsUpdate());
+	}
+
+	SUBCASE("remove")
+	{
+		// Removing the element must unregister it from the context.
+		ElementPtr removed = element_a->GetParentNode()->RemoveChild(element_a);
+		removed.reset();
+		RunFrame(context);
+		RunFrame(context);
+		CHECK(!context->NeedsUpdate());
+	}
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+// Updated every frame, closes its document from its update when requested.
+class ElementCloseOnUpdate : public Element
+{
+public:
+	ElementCloseOnUpdate(const String& tag) : Element(tag) { SetUpdateEveryFrame(true); }
+
+	bool close_document = false;
+
+protected:
+	void OnUpdate() override
+	{
+		if (close_document)
+			GetOwnerDocument()->Close();
+	}
+};
+
+TEST_CASE("context.update_every_frame_close_document")
+{
+	static ElementInstancerGeneric<ElementCloseOnUpdate> instancer;
+	Factory::RegisterElementInstancer("closer", &instancer);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	String rml = update_document_rml;
+	rml.replace(rml.find("</body>"), 0, "<closer id=\"closer\"/><div><closer/></div>");
+
+	ElementDocument* document = context->LoadDocumentFromMemory(rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto closer = static_cast<ElementCloseOnUpdate*>(document->GetElementById("closer"));
+	REQUIRE(closer);
+
+	context->Update();
+	context->Render();
+	CHECK(context->NeedsUpdate());
+
+	closer->close_document = true;
+
+	// The document is closed and released during this update, none of its elements may stay registered with the context.
+	context->Update();
+	context->Render();
+	CHECK(context->GetNumDocuments() == 0);
+
+	// Removing the document dirties the root once more, after that there must be nothing left to update.
+	context->Update();
+	context->Render();
+	CHECK(!context->NeedsUpdate());
+
+	TestsShell::ShutdownShell();
+}
@@ -29,9 +29,14 @@
 #include "../Common/Mocks.h"
 #include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementScroll.h>
+#include <RmlUi/Core/EventListener.h>
 #include <RmlUi/Core/Factory.h>
+#include <RmlUi/Core/FrameStatistics.h>
+#include <RmlUi/Core/SystemInterface.h>
 #include <doctest.h>
 
 using namespace Rml;
@@ -173,3 +178,343 @@ TEST_CASE("Element")
 	document->Close();
 	TestsShell::ShutdownShell();
 }
+
+static const String document_scroll_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		#outer, #inner {
+			display: block;
+			height: 200px;
+			overflow: auto;
+		}
+		#inner {
+			height: 100px;
+		}
+		.row {
+			display: block;
+			width: 200px;
+			height: 50px;
+		}
+		#transformed {
+			transform: rotate(45deg);
+		}
+		#plain {
+			display: block;
+			height: 50px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="plain">
+	<div class="row" id="plain_target"/>
+	<div class="row"/>
+</div>
+<div id="outer">
+	<div class="row"/>
+	<div id="inner">
+		<div class="row"/>
+		<div class="row" id="target"/>
+		<div class="row" id="transformed"/>
+		<div class="row"/>
+	</div>
+	<div class="row"/>
+	<div class="row"/>
+	<div class="row"/>
+	<div class="row"/>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("Element.scroll_offset")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_scroll_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* outer = document->GetElementById("outer");
+	Element* inner = document->GetElementById("inner");
+	Element* target = document->GetElementById("target");
+	Element* transformed = document->GetElementById("transformed");
+	REQUIRE(outer);
+	REQUIRE(inner);
+	REQUIRE(target);
+	REQUIRE(transformed);
+
+	const Vector2f target_offset = target->GetAbsoluteOffset(Box::BORDER);
+	const Vector2f transformed_offset = transformed->GetAbsoluteOffset(Box::BORDER);
+
+	// Scrolling moves the descendants in both nested scroll containers.
+	inner->SetScrollTop(20.f);
+	CHECK(target->GetAbsoluteOffset(Box::BORDER) == target_offset - Vector2f(0, 20));
+	outer->SetScrollTop(30.f);
+	CHECK(target->GetAbsoluteOffset(Box::BORDER) == target_offset - Vector2f(0, 50));
+	CHECK(transformed->GetAbsoluteOffset(Box::BORDER) == transformed_offset - Vector2f(0, 50));
+
+	context->Update();
+	context->Render();
+	{
+		// Scrolling is applied without any new layout.
+		const FrameStatistics& statistics = context->GetFrameStatistics();
+		CHECK(statistics.layout_passes == 0);
+		CHECK(statistics.formatted_elements == 0);
+	}
+
+	// The transform origin follows the scrolled element, so its center is not moved by the rotation.
+	const Vector2f transformed_center = transformed->GetAbsoluteOffset(Box::BORDER) + 0.5f * transformed->GetBox().GetSize(Box::BORDER);
+	REQUIRE(transformed->GetTransformState());
+	Vector2f projected_center = transformed_center;
+	REQUIRE(transformed->Project(projected_center));
+	CHECK(projected_center.x == doctest::Approx(transformed_center.x));
+	CHECK(projected_center.y == doctest::Approx(transformed_center.y));
+
+	inner->SetScrollTop(0.f);
+	outer->SetScrollTop(0.f);
+	CHECK(target->GetAbsoluteOffset(Box::BORDER) == target_offset);
+	CHECK(transformed->GetAbsoluteOffset(Box::BORDER) == transformed_offset);
+
+	// Layout changes of the ancestors are still reflected after scrolling.
+	outer->SetScrollTop(30.f);
+	outer->SetProperty("margin-top", "40px");
+	context->Update();
+	CHECK(target->GetAbsoluteOffset(Box::BORDER) == target_offset + Vector2f(0, 40 - 30));
+
+	// Elements which do not clip their content are not scroll containers, but can still be scrolled.
+	Element* plain = document->GetElementById("plain");
+	Element* plain_target = document->GetElementById("plain_target");
+	REQUIRE(plain);
+	REQUIRE(plain_target);
+
+	const Vector2f plain_target_offset = plain_target->GetAbsoluteOffset(Box::BORDER);
+	plain->SetScrollTop(10.f);
+	REQUIRE(plain->GetScrollTop() == 10.f);
+	CHECK(plain_target->GetAbsoluteOffset(Box::BORDER) == plain_target_offset - Vector2f(0, 10));
+
+	// Descendants find their new scroll container when the overflow changes.
+	plain->SetScrollTop(0.f);
+	CHECK(plain_target->GetAbsoluteOffset(Box::BORDER) == plain_target_offset);
+	plain->SetProperty("overflow", "hidden");
+	context->Update();
+	plain->SetScrollTop(20.f);
+	CHECK(plain_target->GetAbsoluteOffset(Box::BORDER) == plain_target_offset - Vector2f(0, 20));
+	CHECK(target->GetAbsoluteOffset(Box::BORDER) == target_offset + Vector2f(0, 40 - 30));
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+static const String document_smooth_scroll_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		#scroller {
+			display: block;
+			width: 200px;
+			height: 100px;
+			overflow-y: auto;
+			scroll-behavior: smooth;
+		}
+		#content {
+			display: block;
+			height: 1000px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="scroller"><div id="content"/></div>
+</body>
+</rml>
+)";
+
+// Replaces the elapsed time of the application's system interface, forwards everything else used by the tests.
+class ManualClockSystemInterface : public SystemInterface
+{
+public:
+	ManualClockSystemInterface(SystemInterface* system_interface) : system_interface(system_interface) {}
+
+	double GetElapsedTime() override { return time; }
+	void JoinPath(String& translated_path, const String& document_path, const String& path) override { system_interface->JoinPath(translated_path, document_path, path); }
+	bool LogMessage(Log::Type type, const String& message) override { return system_interface->LogMessage(type, message); }
+
+	double time = 0;
+
+private:
+	SystemInterface* system_interface;
+};
+
+TEST_CASE("Element.smooth_scroll")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	SystemInterface* old_system_interface = GetSystemInterface();
+	ManualClockSystemInterface system_interface(old_system_interface);
+	SetSystemInterface(&system_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_smooth_scroll_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	Element* scroller = document->GetElementById("scroller");
+	REQUIRE(scroller);
+	ElementScroll* scroll = scroller->GetElementScroll();
+
+	// Scrolls smoothly to the target with the given time step, returns the scroll offset after 0.1 seconds.
+	auto ScrollWithTimeStep = [&](double time_step) {
+		scroller->SetScrollTop(0.f);
+		context->Update();
+
+		system_interface.time = 0;
+		scroller->ScrollTo(Vector2f(0, 400));
+		CHECK(scroller->GetScrollTop() == 0.f);
+		CHECK(scroll->IsSmoothScrolling());
+		CHECK(context->NeedsUpdate());
+
+		const int num_steps = int(1.0 / time_step + 0.5);
+		const int step_100ms = int(0.1 / time_step + 0.5);
+		float offset_at_100ms = 0;
+		for (int i = 1; i <= num_steps; i++)
+		{
+			system_interface.time = i * time_step;
+			context->Update();
+			if (i == step_100ms)
+				offset_at_100ms = scroller->GetScrollTop();
+		}
+
+		CHECK(scroller->GetScrollTop() == 400.f);
+		CHECK(!scroll->IsSmoothScrolling());
+		return offset_at_100ms;
+	};
+
+	// The motion does not depend on the frame rate, apart from the rounding of the offsets.
+	const float offset_120hz = ScrollWithTimeStep(1.0 / 120.0);
+	const float offset_20hz = ScrollWithTimeStep(1.0 / 20.0);
+	CHECK(offset_120hz > 0.f);
+	CHECK(offset_120hz < 400.f);
+	CHECK(offset_120hz == doctest::Approx(offset_20hz).epsilon(0.01));
+
+	// Setting the offset directly cancels the smooth scroll.
+	system_interface.time = 0;
+	scroller->ScrollTo(Vector2f(0, 0));
+	system_interface.time = 0.05;
+	context->Update();
+	CHECK(scroller->GetScrollTop() < 400.f);
+	scroller->SetScrollTop(50.f);
+	CHECK(!scroll->IsSmoothScrolling());
+	system_interface.time = 0.1;
+	context->Update();
+	CHECK(scroller->GetScrollTop() == 50.f);
+
+	// Mouse wheel steps accumulate on the target of the running scroll.
+	scroller->SetScrollTop(0.f);
+	context->ProcessMouseMove(50, 50, 0);
+	context->ProcessMouseWheel(1.f, 0);
+	CHECK(scroller->GetScrollTop() == 0.f);
+	for (int i = 1; i <= 20; i++)
+	{
+		system_interface.time += 0.05;
+		context->Update();
+	}
+	const float wheel_step = scroller->GetScrollTop();
+	CHECK(wheel_step > 0.f);
+
+	context->ProcessMouseWheel(1.f, 0);
+	system_interface.time += 0.01;
+	context->Update();
+	context->ProcessMouseWheel(1.f, 0);
+	for (int i = 1; i <= 20; i++)
+	{
+		system_interface.time += 0.05;
+		context->Update();
+	}
+	CHECK(scroller->GetScrollTop() == 3.f * wheel_step);
+
+	// Scrolling is applied immediately without smooth scroll behavior.
+	scroller->SetProperty("scroll-behavior", "auto");
+	context->Update();
+	scroller->ScrollTo(Vector2f(0, 20));
+	CHECK(scroller->GetScrollTop() == 20.f);
+	CHECK(!scroll->IsSmoothScrolling());
+
+	document->Close();
+	SetSystemInterface(old_system_interface);
+	TestsShell::ShutdownShell();
+}
+
+static const String document_nested_rml = R"(
+<rml>
+<head>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		div {
+			display: block;
+			width: 100px;
+			height: 100px;
+		}
+	</style>
+</head>
+<body id="body">
+<div id="outer"><div id="middle"><div id="inner"/></div></div>
+<div id="other"/>
+</body>
+</rml>
+)";
+
+// Records the target of each event passing through the element the listener is attached to.
+class EventOrderListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		order += event.GetType() + " " + event.GetTargetElement()->GetId() + "\n";
+	}
+
+	String order;
+};
+
+TEST_CASE("Element.chain_event_order")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_nested_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	EventOrderListener listener;
+	document->AddEventListener(EventId::Mouseover, &listener, true);
+	document->AddEventListener(EventId::Mouseout, &listener, true);
+
+	// Chain events are sent from the innermost element outwards.
+	context->ProcessMouseMove(10, 10, 0);
+	CHECK(listener.order == "mouseover inner\nmouseover middle\nmouseover outer\nmouseover body\n");
+
+	listener.order.clear();
+	context->ProcessMouseMove(10, 150, 0);
+	CHECK(listener.order == "mouseout inner\nmouseout middle\nmouseout outer\nmouseover other\n");
+
+	document->RemoveEventListener(EventId::Mouseover, &listener, true);
+	document->RemoveEventListener(EventId::Mouseout, &listener, true);
+	document->Close();
+	TestsShell::ShutdownShell();
+}
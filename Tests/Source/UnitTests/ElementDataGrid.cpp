@@ -0,0 +1,229 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/DataSource.h>
+#include <RmlUi/Core/Elements/ElementDataGrid.h>
+#include <RmlUi/Core/Elements/ElementDataGridRow.h>
+#include <RmlUi/Core/EventListener.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+namespace {
+
+class LargeDataSource : public DataSource {
+public:
+	LargeDataSource() : DataSource("large") {}
+
+	void GetRow(StringList& row, const String& /*table*/, int row_index, const StringList& columns) override
+	{
+		num_rows_fetched += 1;
+		for (const String& column : columns)
+		{
+			if (column == "name")
+				row.push_back(CreateString(32, "row%d", row_index));
+			else
+				row.push_back("");
+		}
+	}
+
+	int GetNumRows(const String& /*table*/) override { return num_rows; }
+
+	using DataSource::NotifyRowChange;
+
+	int num_rows = 100000;
+	int num_rows_fetched = 0;
+};
+
+class RowChangeListener : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		num_events += 1;
+		first_row_changed = event.GetParameter("first_row_changed", -1);
+		num_rows_changed = event.GetParameter("num_rows_changed", -1);
+	}
+	int num_events = 0;
+	int first_row_changed = -1;
+	int num_rows_changed = -1;
+};
+
+static const String datagrid_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		datagrid {
+			width: 300px;
+			height: 200px;
+		}
+		datagridrow {
+			display: block;
+			height: 20px;
+		}
+		scrollbarvertical {
+			width: 10px;
+		}
+	</style>
+</head>
+<body>
+<datagrid id="grid" source="large.items" virtualize>
+	<col fields="name" width="100%">Name</col>
+</datagrid>
+</body>
+</rml>
+)";
+
+} // namespace
+
+TEST_CASE("datagrid.virtualize")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	LargeDataSource data_source;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(datagrid_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto grid = rmlui_dynamic_cast<ElementDataGrid*>(document->GetElementById("grid"));
+	REQUIRE(grid);
+	CHECK(grid->IsVirtualized());
+
+	auto update = [&]() {
+		// Rows are measured from the previous layout, so let the grid settle over a few updates.
+		for (int i = 0; i < 3; i++)
+			context->Update();
+		context->Render();
+	};
+
+	auto first_visible_row = [&]() {
+		for (int i = 0; i < grid->GetNumRows(); i++)
+		{
+			if (grid->GetRow(i))
+				return i;
+		}
+		return -1;
+	};
+
+	auto cell_text = [&](int row_index) -> String {
+		ElementDataGridRow* row = grid->GetRow(row_index);
+		if (!row || !row->GetChild(0))
+			return String();
+		return row->GetChild(0)->GetInnerRML();
+	};
+
+	grid->SetScrollTop(0);
+	update();
+
+	CHECK(grid->GetNumRows() == data_source.num_rows);
+
+	// Only the rows inside the 200px grid are instanced, and the grid scrolls through the whole table.
+	Element* body = grid->GetChild(1);
+	REQUIRE(body);
+	CHECK(body->GetNumChildren() < 20);
+	CHECK(grid->GetScrollHeight() >= 20.f * data_source.num_rows);
+	CHECK(data_source.num_rows_fetched < 50);
+
+	CHECK(first_visible_row() == 0);
+	CHECK(cell_text(0) == "row0");
+
+	// Scroll far down, the rows are recycled for the new part of the table.
+	grid->SetScrollTop(20.f * 50000.f);
+	update();
+
+	const int first_row = first_visible_row();
+	CHECK(first_row >= 49990);
+	CHECK(first_row <= 50000);
+	CHECK(cell_text(first_row) == CreateString(32, "row%d", first_row));
+	CHECK(body->GetNumChildren() < 20);
+	CHECK(data_source.num_rows_fetched < 100);
+
+	// Scroll by a couple of rows, only the new rows should be fetched.
+	data_source.num_rows_fetched = 0;
+	grid->SetScrollTop(grid->GetScrollTop() + 40.f);
+	update();
+
+	CHECK(first_visible_row() == first_row + 2);
+	CHECK(cell_text(first_row + 2) == CreateString(32, "row%d", first_row + 2));
+	CHECK(data_source.num_rows_fetched == 2);
+
+	// Scroll back up, the rows are kept in document order.
+	data_source.num_rows_fetched = 0;
+	grid->SetScrollTop(grid->GetScrollTop() - 60.f);
+	update();
+
+	CHECK(first_visible_row() == first_row - 1);
+	CHECK(data_source.num_rows_fetched == 3);
+	for (int i = 0; i < 3; i++)
+	{
+		ElementDataGridRow* row = grid->GetRow(first_row - 1 + i);
+		REQUIRE(row);
+		CHECK(body->GetChild(i + 1) == row);
+		CHECK(cell_text(first_row - 1 + i) == CreateString(32, "row%d", first_row - 1 + i));
+	}
+
+	// Changes to rows outside the view should not fetch anything.
+	data_source.num_rows_fetched = 0;
+	data_source.NotifyRowChange("items", 10, 5);
+	update();
+	CHECK(data_source.num_rows_fetched == 0);
+
+	data_source.NotifyRowChange("items", first_row + 1, 1);
+	update();
+	CHECK(data_source.num_rows_fetched == 1);
+
+	// Changing the whole table is also reported to listeners.
+	RowChangeListener listener;
+	grid->AddEventListener(EventId::Rowchange, &listener);
+
+	data_source.num_rows = 1000;
+	data_source.NotifyRowChange("items");
+	update();
+	CHECK(listener.num_events == 1);
+	CHECK(listener.first_row_changed == 0);
+	CHECK(listener.num_rows_changed == 1000);
+	CHECK(grid->GetNumRows() == 1000);
+
+	grid->RemoveEventListener(EventId::Rowchange, &listener);
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
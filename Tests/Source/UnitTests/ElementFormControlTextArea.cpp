@@ -0,0 +1,255 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include "../../../Source/Core/GeometryDatabase.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControlTextArea.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String textarea_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		textarea {
+			display: block;
+			width: 200px;
+			height: 100px;
+		}
+		scrollbarvertical {
+			width: 10px;
+		}
+		scrollbarhorizontal {
+			height: 10px;
+		}
+	</style>
+</head>
+<body>
+<textarea id="edited"/>
+<textarea id="reference"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("form.textarea.incremental_format")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(textarea_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto edited = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("edited"));
+	auto reference = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("reference"));
+	REQUIRE(edited);
+	REQUIRE(reference);
+
+	String value;
+	for (int i = 0; i < 40; i++)
+		value += (i % 7 == 6 ? "lorem ipsum\n" : "lorem ipsum dolor  sit ");
+
+	edited->SetValue(value);
+	context->Update();
+	context->Render();
+
+	static const char* insertions[] = { "a", " ", "\n", "consectetur ", "  ", "adipiscing\nelit", "sed do eiusmod tempor incididunt ut labore" };
+
+	// Apply a sequence of edits which are formatted incrementally, and compare the result to a text area formatted from scratch.
+	unsigned int seed = 1;
+	auto random = [&seed](int range) -> int {
+		seed = seed * 1103515245u + 12345u;
+		return int((seed >> 16) % (unsigned int)range);
+	};
+
+	for (int i = 0; i < 200; i++)
+	{
+		const size_t position = (size_t)random((int)value.size() + 1);
+		if (random(3) == 0 && position < value.size())
+			value.erase(position, (size_t)random(20) + 1);
+		else
+			value.insert(position, insertions[random((int)(sizeof(insertions) / sizeof(insertions[0])))]);
+
+		edited->SetValue(value);
+		reference->SetValue("");
+		reference->SetValue(value);
+
+		context->Update();
+		context->Render();
+
+		CHECK(edited->GetValue() == value);
+		CHECK(edited->GetScrollHeight() == reference->GetScrollHeight());
+		CHECK(edited->GetScrollWidth() == reference->GetScrollWidth());
+	}
+
+	// Removing the beginning of a wrapped word may allow the rest of it to move up onto the previous line.
+	const String endlines(10, '\n');
+	String word = "y";
+	reference->SetValue(endlines + "aaa " + word);
+	context->Update();
+	const float unwrapped_height = reference->GetScrollHeight();
+
+	while (reference->GetScrollHeight() == unwrapped_height)
+	{
+		word += "y";
+		REQUIRE(word.size() < 100);
+		reference->SetValue(endlines + "aaa " + word);
+		context->Update();
+	}
+
+	edited->SetValue(endlines + "aaa " + word);
+	context->Update();
+	CHECK(edited->GetScrollHeight() == reference->GetScrollHeight());
+
+	edited->SetValue(endlines + "aaa y");
+	context->Update();
+	CHECK(edited->GetScrollHeight() == unwrapped_height);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("form.textarea.incremental_geometry")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	if (!render_interface)
+		return;
+
+	ElementDocument* document = context->LoadDocumentFromMemory(textarea_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto edited = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("edited"));
+	auto reference = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("reference"));
+	REQUIRE(edited);
+	REQUIRE(reference);
+
+	// Make all the lines visible, so that the geometry of every line is generated and rendered.
+	edited->SetProperty("height", "350px");
+	reference->SetProperty("height", "350px");
+
+	// Visibility does not affect layout, so we can render the text areas one at a time without reformatting them.
+	auto GetRenderedVertices = [&](ElementFormControlTextArea* visible, ElementFormControlTextArea* hidden) -> size_t {
+		visible->RemoveProperty(PropertyId::Visibility);
+		hidden->SetProperty(PropertyId::Visibility, Style::Visibility::Hidden);
+		context->Update();
+		render_interface->ResetCounters();
+		context->Render();
+		hidden->RemoveProperty(PropertyId::Visibility);
+		return render_interface->GetCounters().vertices;
+	};
+
+	String value = "lorem ipsum dolor sit amet\nconsectetur adipiscing elit sed do eiusmod tempor incididunt ut labore";
+	edited->SetValue(value);
+	context->Update();
+	context->Render();
+
+	// The text element keeps the lines which are unchanged by each edit, its geometry should match a text area formatted from scratch.
+	static const char* insertions[] = { "a", " ", "\n", "magna ", "aliqua\nut enim", "quis nostrud exercitation ullamco" };
+
+	unsigned int seed = 7;
+	auto random = [&seed](int range) -> int {
+		seed = seed * 1103515245u + 12345u;
+		return int((seed >> 16) % (unsigned int)range);
+	};
+
+	for (int i = 0; i < 50; i++)
+	{
+		const size_t position = (size_t)random((int)value.size() + 1);
+		if ((random(3) == 0 || value.size() > 300) && position < value.size())
+			value.erase(position, (size_t)random(20) + 1);
+		else
+			value.insert(position, insertions[random((int)(sizeof(insertions) / sizeof(insertions[0])))]);
+
+		edited->SetValue(value);
+		reference->SetValue("");
+		reference->SetValue(value);
+		context->Update();
+
+		REQUIRE(edited->GetScrollHeight() <= edited->GetClientHeight());
+		CHECK(GetRenderedVertices(edited, reference) == GetRenderedVertices(reference, edited));
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("form.textarea.visible_geometry")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(textarea_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	auto textarea = rmlui_dynamic_cast<ElementFormControlTextArea*>(document->GetElementById("edited"));
+	REQUIRE(textarea);
+
+	// Only the lines near the visible part of the text area should have their geometry generated.
+	auto GetGeometryBufferSize = [&](int num_lines, float scroll_top) -> size_t {
+		String value;
+		for (int i = 0; i < num_lines; i++)
+			value += "lorem ipsum dolor sit\n";
+
+		textarea->SetValue(value);
+		context->Update();
+		textarea->SetScrollTop(scroll_top);
+		context->Update();
+		context->Render();
+
+		size_t buffer_size = 0;
+		GeometryDatabase::GetNumGeometries(buffer_size);
+		return buffer_size;
+	};
+
+	const size_t small_buffer_size = GetGeometryBufferSize(50, 0.f);
+	const size_t large_buffer_size = GetGeometryBufferSize(5000, 0.f);
+	const size_t large_scrolled_buffer_size = GetGeometryBufferSize(5000, 40000.f);
+
+	// The size should be independent of the number of lines, while generating all the lines would take a hundred times more.
+	CHECK(textarea->GetScrollTop() > 0.f);
+	CHECK(large_buffer_size < 3 * small_buffer_size);
+	CHECK(large_scrolled_buffer_size < 3 * small_buffer_size);
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -27,6 +27,7 @@
  */
 
 #include "../Common/TestsShell.h"
+#include "../../../Source/Core/ElementDefinition.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
@@ -85,3 +86,110 @@ TEST_CASE("elementstyle.inline_decorator_images")
 
 	TestsShell::ShutdownShell();
 }
+
+static const String document_transition_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		div {
+			width: 100px;
+			height: 100px;
+			transition: width 10s;
+		}
+		div.wide {
+			width: 200px;
+			height: 200px;
+		}
+		p {
+			width: 100px;
+			transition: all 10s;
+		}
+		p.wide {
+			width: 200px;
+		}
+	</style>
+</head>
+
+<body>
+<div id="div"/>
+<p id="p"/>
+<div id="inline" style="transition: none"/>
+</body>
+</rml>
+)";
+
+TEST_CASE("elementstyle.transition_definition_change")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_transition_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+
+	Element* div = document->GetElementById("div");
+	Element* p = document->GetElementById("p");
+	REQUIRE(div);
+	REQUIRE(p);
+
+	// Toggle back and forth a few times, which should reuse the cached changes between the two definitions.
+	for (int i = 0; i < 3; i++)
+	{
+		const bool wide = (i % 2 == 0);
+		const float target = (wide ? 200.f : 100.f);
+
+		div->SetClass("wide", wide);
+		p->SetClass("wide", wide);
+		context->Update();
+
+		// Only the listed property is transitioned.
+		CHECK(div->GetProperty<float>("width") != target);
+		CHECK(div->GetProperty<float>("height") == target);
+
+		CHECK(p->GetProperty<float>("width") != target);
+	}
+
+	// An inline transition property takes precedence over the one from the style sheet.
+	Element* inline_element = document->GetElementById("inline");
+	REQUIRE(inline_element);
+	inline_element->SetClass("wide", true);
+	context->Update();
+	CHECK(inline_element->GetProperty<float>("width") == 200.f);
+
+	document->Close();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("Element.style.definition_change_cache")
+{
+	const Vector<const StyleSheetNode*> no_nodes;
+	ElementDefinition definition(no_nodes);
+
+	// Switch to many short-lived definitions, as when an element cycles through classes that are never seen again.
+	const int num_definitions = 1000;
+	for (int i = 0; i < num_definitions; i++)
+	{
+		auto new_definition = MakeShared<ElementDefinition>(no_nodes);
+		definition.GetChange(new_definition);
+	}
+
+	// Entries of destroyed definitions are pruned as new ones are added.
+	CHECK(definition.GetNumCachedChanges() < 64);
+
+	// Live definitions are kept, and their changes reused.
+	Vector<SharedPtr<ElementDefinition>> live_definitions;
+	for (int i = 0; i < num_definitions; i++)
+	{
+		live_definitions.push_back(MakeShared<ElementDefinition>(no_nodes));
+		definition.GetChange(live_definitions.back());
+	}
+	CHECK(definition.GetNumCachedChanges() >= size_t(num_definitions));
+	CHECK(definition.GetNumCachedChanges() < size_t(2 * num_definitions));
+
+	const SharedPtr<const ElementDefinition::Change> change = definition.GetChange(live_definitions.front());
+	CHECK(change.get() == definition.GetChange(live_definitions.front()).get());
+}
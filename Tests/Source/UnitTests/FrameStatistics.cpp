@@ -0,0 +1,381 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/FrameStatistics.h>
+#include <RmlUi/Core/SystemInterface.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String statistics_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		div {
+			display: block;
+			height: 50px;
+			background-color: #f00;
+		}
+		div.large {
+			height: 100px;
+		}
+	</style>
+</head>
+<body>
+<div id="a">Hello</div>
+<div id="b">World</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("context.frame_statistics")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(statistics_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	{
+		// Showing the document already formatted it, only rendering remains for the first frame.
+		const FrameStatistics& statistics = context->GetFrameStatistics();
+		CHECK(statistics.geometry_regenerations > 0);
+		CHECK(statistics.draw_calls >= 4);
+		CHECK(statistics.vertices >= 4 * statistics.draw_calls);
+		CHECK(statistics.texture_binds >= 1);
+		CHECK(statistics.update_time >= 0.0);
+		CHECK(statistics.render_time >= 0.0);
+	}
+
+	// Nothing changed, so nothing but rendering should take place.
+	context->Update();
+	context->Render();
+
+	const int num_draw_calls = context->GetFrameStatistics().draw_calls;
+	{
+		const FrameStatistics& statistics = context->GetFrameStatistics();
+		CHECK(statistics.layout_passes == 0);
+		CHECK(statistics.formatted_elements == 0);
+		CHECK(statistics.definition_updates == 0);
+		CHECK(statistics.computed_values_updates == 0);
+		CHECK(statistics.geometry_regenerations == 0);
+		CHECK(statistics.hit_tests == 0);
+		CHECK(statistics.element_updates == 0);
+		CHECK(statistics.events_dispatched == 0);
+		CHECK(num_draw_calls >= 4);
+	}
+
+	// Input events between frames are recorded in the next frame.
+	context->ProcessMouseMove(10, 10, 0);
+	document->GetElementById("b")->SetClass("large", true);
+	context->Update();
+	context->Render();
+
+	{
+		const FrameStatistics& statistics = context->GetFrameStatistics();
+		CHECK(statistics.hit_tests >= 1);
+		CHECK(statistics.events_dispatched >= 1);
+		CHECK(statistics.definition_updates >= 1);
+		CHECK(statistics.computed_values_updates >= 1);
+		CHECK(statistics.layout_passes == 1);
+		CHECK(statistics.formatted_elements >= 3);
+		CHECK(statistics.geometry_regenerations > 0);
+		CHECK(statistics.draw_calls == num_draw_calls);
+	}
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+// An application clock which never advances, as during input replay.
+class FrozenClockSystemInterface : public SystemInterface {
+public:
+	FrozenClockSystemInterface(SystemInterface* system_interface) : system_interface(system_interface) {}
+	double GetElapsedTime() override { return 1.0; }
+	bool LogMessage(Log::Type type, const String& message) override { return system_interface->LogMessage(type, message); }
+
+private:
+	SystemInterface* system_interface;
+};
+
+TEST_CASE("context.frame_statistics.frozen_clock")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(statistics_document_rml);
+	REQUIRE(document);
+	document->Show();
+	context->Update();
+	context->Render();
+
+	// Work is timed independently of the application's clock.
+	SystemInterface* tests_system_interface = GetSystemInterface();
+	FrozenClockSystemInterface system_interface(tests_system_interface);
+	SetSystemInterface(&system_interface);
+
+	document->GetElementById("b")->SetClass("large", true);
+	context->Update();
+	context->Render();
+
+	SetSystemInterface(tests_system_interface);
+
+	const FrameStatistics& statistics = context->GetFrameStatistics();
+	CHECK(statistics.layout_passes == 1);
+	CHECK(statistics.update_time > 0.0);
+	CHECK(statistics.layout_time > 0.0);
+	CHECK(statistics.render_time > 0.0);
+	CHECK(statistics.layout_time <= statistics.update_time);
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.frame_statistics.script_time")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(statistics_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	// Stands in for a scripting plugin running an event handler.
+	struct ScriptListener : EventListener {
+		void ProcessEvent(Event& /*event*/) override { RecordScriptTime(0.25); }
+	} listener;
+	document->AddEventListener(EventId::Mousemove, &listener);
+
+	context->Update();
+	context->Render();
+	CHECK(context->GetFrameStatistics().script_time == 0.0);
+	CHECK(context->GetFrameStatistics().script_calls == 0);
+
+	// Script time outside of any context work is not recorded.
+	RecordScriptTime(1.0);
+
+	context->ProcessMouseMove(10, 10, 0);
+	context->Update();
+	context->Render();
+	{
+		const FrameStatistics& statistics = context->GetFrameStatistics();
+		CHECK(statistics.script_time == doctest::Approx(0.25));
+		CHECK(statistics.script_calls == 1);
+	}
+
+	context->Update();
+	context->Render();
+	CHECK(context->GetFrameStatistics().script_calls == 0);
+
+	// The per-handler statistics are provided by the scripting plugin's profiler, if any.
+	CHECK(GetScriptHandlerStatistics().empty());
+	SetScriptHandlerStatisticsFunction([]() { return ScriptHandlerStatisticsList{ ScriptHandlerStatistics{ "onmousemove", 1, 0.25 } }; });
+	{
+		const ScriptHandlerStatisticsList handlers = GetScriptHandlerStatistics();
+		REQUIRE(handlers.size() == 1);
+		CHECK(handlers[0].name == "onmousemove");
+		CHECK(handlers[0].calls == 1);
+	}
+	SetScriptHandlerStatisticsFunction(nullptr);
+	CHECK(GetScriptHandlerStatistics().empty());
+
+	document->RemoveEventListener(EventId::Mousemove, &listener);
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.element_statistics")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(statistics_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	// Nothing is recorded unless enabled.
+	CHECK(!context->IsElementStatisticsEnabled());
+	CHECK(context->GetElementStatistics().empty());
+
+	context->SetElementStatisticsEnabled(true);
+	CHECK(context->IsElementStatisticsEnabled());
+
+	Element* element_a = document->GetElementById("a");
+	Element* element_b = document->GetElementById("b");
+
+	auto find_statistics = [context](Element* element) -> const ElementStatistics* {
+		for (const ElementStatistics& statistics : context->GetElementStatistics())
+		{
+			if (statistics.element == element)
+				return &statistics;
+		}
+		return nullptr;
+	};
+
+	// Nothing changed, elements are only updated and rendered.
+	context->Update();
+	context->Render();
+
+	{
+		const ElementStatistics* statistics = find_statistics(element_a);
+		REQUIRE(statistics);
+		CHECK(statistics->flags == 0);
+		CHECK(statistics->update_time >= 0.0);
+		CHECK(statistics->render_time >= 0.0);
+
+		const ElementStatistics* document_statistics = find_statistics(document);
+		REQUIRE(document_statistics);
+		CHECK(document_statistics->flags == 0);
+	}
+
+	// Changing a class invalidates the definition and layout of the element, and formats the whole document.
+	element_b->SetClass("large", true);
+	context->Update();
+	context->Render();
+
+	{
+		const ElementStatistics* statistics_b = find_statistics(element_b);
+		REQUIRE(statistics_b);
+		CHECK((statistics_b->flags & ElementStatistics::DefinitionUpdated));
+		CHECK((statistics_b->flags & ElementStatistics::LayoutDirtied));
+		CHECK((statistics_b->flags & ElementStatistics::Formatted));
+		CHECK((statistics_b->flags & ElementStatistics::GeometryRegenerated));
+
+		const ElementStatistics* statistics_a = find_statistics(element_a);
+		REQUIRE(statistics_a);
+		CHECK(!(statistics_a->flags & ElementStatistics::DefinitionUpdated));
+		CHECK(!(statistics_a->flags & ElementStatistics::LayoutDirtied));
+		CHECK((statistics_a->flags & ElementStatistics::Formatted));
+
+		// Exclusive times of the elements can not exceed the total times of the frame.
+		double total_update_time = 0;
+		for (const ElementStatistics& statistics : context->GetElementStatistics())
+			total_update_time += statistics.update_time;
+		CHECK(total_update_time <= context->GetFrameStatistics().update_time + 1e-6);
+	}
+
+	// The statistics observe the elements, destroyed elements are reported as null.
+	context->Update();
+	context->Render();
+	CHECK(find_statistics(element_b));
+	document->RemoveChild(element_b);
+	bool found_destroyed = false;
+	context->Update();
+	for (const ElementStatistics& statistics : context->GetElementStatistics())
+		found_destroyed |= !statistics.element;
+	CHECK(found_destroyed);
+
+	context->SetElementStatisticsEnabled(false);
+	CHECK(context->GetElementStatistics().empty());
+
+	document->Close();
+	context->Update();
+
+	TestsShell::ShutdownShell();
+}
+
+TEST_CASE("context.frame_statistics.render_interface")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	TestsRenderInterface* render_interface = TestsShell::GetTestsRenderInterface();
+	REQUIRE(render_interface);
+
+	for (bool compiled_geometry : {false, true})
+	{
+		render_interface->EnableCompiledGeometry(compiled_geometry);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(statistics_document_rml);
+		REQUIRE(document);
+		document->Show();
+
+		for (int i = 0; i < 2; i++)
+		{
+			render_interface->ResetCounters();
+			context->Update();
+			context->Render();
+
+			// The draw calls seen by the render interface should match the recorded frame statistics.
+			const TestsRenderInterface::Counters& counters = render_interface->GetCounters();
+			const FrameStatistics& statistics = context->GetFrameStatistics();
+			CHECK(counters.render_calls == (size_t)statistics.draw_calls);
+			CHECK(counters.vertices == (size_t)statistics.vertices);
+			CHECK(counters.indices >= counters.vertices);
+			CHECK(counters.texture_binds == (size_t)statistics.texture_binds);
+
+			if (compiled_geometry)
+			{
+				CHECK(counters.render_compiled_geometry == counters.render_calls);
+				CHECK(counters.compile_geometry == (i == 0 ? counters.render_calls : 0));
+			}
+			else
+			{
+				CHECK(counters.render_compiled_geometry == 0);
+				CHECK(counters.compile_geometry == 0);
+			}
+		}
+
+		CHECK(render_interface->GetNumLiveCompiledGeometries() == (compiled_geometry ? (int)render_interface->GetCounters().render_calls : 0));
+
+		document->Close();
+		context->Update();
+
+		CHECK(render_interface->GetNumLiveCompiledGeometries() == 0);
+	}
+
+	render_interface->EnableCompiledGeometry(false);
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,196 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/Elements/ElementFormControl.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/InputRecording.h>
+#include <RmlUi/Core/SystemInterface.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String recording_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		div {
+			display: block;
+			height: 50px;
+		}
+		input {
+			display: block;
+			width: 200px;
+		}
+	</style>
+</head>
+<body>
+<div id="a"/>
+<input id="text" type="text"/>
+</body>
+</rml>
+)";
+
+// Records the events received by the document, with the context time at which they were received.
+class EventLog : public EventListener {
+public:
+	void ProcessEvent(Event& event) override
+	{
+		Element* target = event.GetTargetElement();
+		log += CreateString(128, "%.3f %s %s\n", target->GetContext()->GetElapsedTime(), event.GetType().c_str(), target->GetId().c_str());
+	}
+
+	String log;
+};
+
+static String PlaySession(Context* context, const String& recording, String& out_recording)
+{
+	ElementDocument* document = context->LoadDocumentFromMemory(recording_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	EventLog event_log;
+	for (const char* event : {"mouseover", "mouseout", "click", "dblclick", "keydown", "textinput", "resize"})
+		document->AddEventListener(event, &event_log, true);
+
+	if (recording.empty())
+	{
+		// Drive the time of the recorded context so that the recording doesn't depend on the speed of the machine.
+		context->SetTimeOverride(100.0);
+		InputRecorder recorder(context);
+
+		context->Update();
+		context->SetTimeOverride(100.1);
+		context->ProcessMouseMove(50, 20, 0);
+		context->Update();
+		context->SetTimeOverride(100.2);
+		context->ProcessMouseMove(50, 60, 0);
+		context->ProcessMouseButtonDown(0, 0);
+		context->ProcessMouseButtonUp(0, 0);
+		context->SetTimeOverride(100.3);
+		context->ProcessMouseButtonDown(0, 0);
+		context->ProcessMouseButtonUp(0, 0);
+		context->Update();
+		context->SetTimeOverride(101.0);
+		context->ProcessKeyDown(Input::KI_A, Input::KM_SHIFT);
+		context->ProcessTextInput("A\xc3\xa6 b");
+		context->ProcessKeyUp(Input::KI_A, Input::KM_SHIFT);
+		context->ProcessMouseWheel(-1.5f, 0);
+		context->SetTimeOverride(101.5);
+		context->SetDimensions(Vector2i(800, 600));
+		context->Update();
+
+		out_recording = recorder.GetRecording();
+		context->ClearTimeOverride();
+	}
+	else
+	{
+		InputReplayer replayer(context, recording);
+		CHECK(replayer.IsValid());
+		CHECK(replayer.GetNumFrames() == 4);
+
+		SystemInterface* system_interface = GetSystemInterface();
+		Context* other_context = TestsShell::GetContext();
+
+		int num_frames = 0;
+		while (replayer.NextFrame())
+		{
+			// Only the replayed context runs on the recorded time, global interfaces are left alone.
+			CHECK(context->GetElapsedTime() == replayer.GetTime());
+			CHECK(other_context->GetElapsedTime() != replayer.GetTime());
+			CHECK(GetSystemInterface() == system_interface);
+
+			context->Update();
+			num_frames += 1;
+		}
+		CHECK(num_frames == 4);
+		CHECK(replayer.GetTime() == doctest::Approx(101.5));
+	}
+
+	const String result = rmlui_dynamic_cast<ElementFormControl*>(document->GetElementById("text"))->GetValue() + "\n" + event_log.log;
+
+	for (const char* event : {"mouseover", "mouseout", "click", "dblclick", "keydown", "textinput", "resize"})
+		document->RemoveEventListener(event, &event_log, true);
+	document->Close();
+	context->Update();
+
+	return result;
+}
+
+TEST_CASE("context.input_recording")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+	const Vector2i dimensions = context->GetDimensions();
+
+	String recording;
+	const String recorded_session = PlaySession(context, String(), recording);
+
+	CHECK(recording.find("mousemove 50 60 0") != String::npos);
+	CHECK(recording.find("keydown") != String::npos);
+	CHECK(recording.find("wheel -1.5 0") != String::npos);
+	CHECK(recording.find("dimensions 800 600") != String::npos);
+
+	// Replaying the session into a new context should reproduce the same events with the same times.
+	Context* replay_context = CreateContext("replay", dimensions);
+	REQUIRE(replay_context);
+
+	String unused;
+	const String replayed_session = PlaySession(replay_context, recording, unused);
+
+	CHECK(recorded_session.find("A\xc3\xa6 b") == 0);
+	CHECK(recorded_session.find("100.200 click text") != String::npos);
+	CHECK(recorded_session.find("100.300 dblclick text") != String::npos);
+	CHECK(replayed_session == recorded_session);
+
+	// The time override is cleared after replaying.
+	CHECK(replay_context->GetElapsedTime() > 0.0);
+	CHECK(replay_context->GetElapsedTime() != doctest::Approx(101.5));
+
+	{
+		TestsShell::SetNumExpectedWarnings(1);
+		InputReplayer replayer(context, "rmlui-input-recording 1\n0.5 update\n0.6 unknown 1 2\n");
+		CHECK(!replayer.IsValid());
+		CHECK(!replayer.NextFrame());
+	}
+
+	RemoveContext("replay");
+	context->SetDimensions(dimensions);
+
+	TestsShell::ShutdownShell();
+}
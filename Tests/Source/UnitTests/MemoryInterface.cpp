@@ -0,0 +1,261 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Decorator.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/MemoryInterface.h>
+#include <doctest.h>
+#include <unordered_map>
+
+using namespace Rml;
+
+static const String memory_interface_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		div {
+			display: block;
+		}
+	</style>
+</head>
+<body>
+<div data-model="allocations">
+	<div data-for="items">{{ it }}</div>
+</div>
+</body>
+</rml>
+)";
+
+class TrackingMemoryInterface : public MemoryInterface {
+public:
+	void* Allocate(size_t size, size_t alignment, MemoryCategory category) override
+	{
+		CHECK(alignment <= alignof(std::max_align_t));
+		void* ptr = ::operator new(size);
+		live_allocations[ptr] = size;
+		allocated_bytes[(int)category] += size;
+		return ptr;
+	}
+
+	void Deallocate(void* ptr, size_t size, size_t /*alignment*/, MemoryCategory category) override
+	{
+		auto it = live_allocations.find(ptr);
+		if (it == live_allocations.end())
+		{
+			// Allocated from the global heap before the interface was installed.
+			num_foreign_deallocations += 1;
+		}
+		else
+		{
+			CHECK(it->second == size);
+			live_allocations.erase(it);
+			allocated_bytes[(int)category] -= size;
+		}
+		::operator delete(ptr);
+	}
+
+	size_t GetAllocatedBytes(MemoryCategory category) const { return allocated_bytes[(int)category]; }
+
+	// Not an Rml container, which may itself allocate through the memory interface.
+	std::unordered_map<void*, size_t> live_allocations;
+	size_t allocated_bytes[(int)MemoryCategory::DataBinding + 1] = {};
+	int num_foreign_deallocations = 0;
+};
+
+TEST_CASE("core.memory_interface")
+{
+	// The interface must be installed while RmlUi is shut down, and outlive all memory allocated through it.
+	TestsShell::ShutdownShell();
+
+	static TrackingMemoryInterface memory_interface;
+	SetMemoryInterface(&memory_interface);
+	CHECK(GetMemoryInterface() == &memory_interface);
+
+	{
+		Context* context = TestsShell::GetContext();
+		REQUIRE(context);
+
+		// Type definitions are kept by the context until it is destroyed, register the array type up front.
+		{
+			DataModelConstructor constructor = context->CreateDataModel("types");
+			REQUIRE(bool(constructor));
+			constructor.RegisterArray<Vector<int>>();
+			context->RemoveDataModel("types");
+		}
+		const size_t type_register_bytes = memory_interface.GetAllocatedBytes(MemoryCategory::DataBinding);
+		CHECK(type_register_bytes > 0);
+
+		Vector<int> items(100);
+		{
+			DataModelConstructor constructor = context->CreateDataModel("allocations");
+			REQUIRE(bool(constructor));
+			constructor.RegisterArray<Vector<int>>();
+			constructor.Bind("items", &items);
+		}
+
+		ElementDocument* document = context->LoadDocumentFromMemory(memory_interface_document_rml);
+		REQUIRE(document);
+		document->Show();
+
+		context->Update();
+		context->Render();
+
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Element) > 100 * sizeof(Element));
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Style) > 0);
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Layout) > 0);
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Font) > 0);
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::DataBinding) > type_register_bytes);
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::General) > 0);
+
+		document->Close();
+		context->RemoveDataModel("allocations");
+		context->Update();
+
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::DataBinding) == type_register_bytes);
+	}
+
+	TestsShell::ShutdownShell();
+
+	// All memory owned by the library has been returned on shutdown.
+	CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Element) == 0);
+	CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Style) == 0);
+	CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Layout) == 0);
+	CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Font) == 0);
+	CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Texture) == 0);
+	CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::DataBinding) == 0);
+#ifndef RMLUI_MEMORY_INTERFACE_CONTAINERS
+	// With containers on the interface, containers kept by the library across shutdowns may have been allocated by
+	// earlier tests before the interface was installed.
+	CHECK(memory_interface.num_foreign_deallocations == 0);
+#endif
+
+	SetMemoryInterface(nullptr);
+}
+
+TEST_CASE("core.memory_interface.allocator")
+{
+	static TrackingMemoryInterface memory_interface;
+	SetMemoryInterface(&memory_interface);
+
+	{
+		std::vector<int, Allocator<int, MemoryCategory::Layout>> values;
+		values.resize(1000);
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Layout) == 1000 * sizeof(int));
+
+		SharedPtr<String> shared = MakeShared<String>("shared");
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::General) > 0);
+
+#ifdef RMLUI_MEMORY_INTERFACE_CONTAINERS
+		const size_t general_bytes = memory_interface.GetAllocatedBytes(MemoryCategory::General);
+		String string(1000, 'x');
+		Vector<int> vector(1000);
+		UnorderedMap<String, int> map = {{string, 1}};
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::General) > general_bytes + 2000 + sizeof(int) * 1000);
+#endif
+	}
+
+	CHECK(memory_interface.live_allocations.empty());
+
+	SetMemoryInterface(nullptr);
+}
+
+class EmptyDecorator : public Decorator {
+public:
+	DecoratorDataHandle GenerateElementData(Element* /*element*/) const override { return Decorator::INVALID_DECORATORDATAHANDLE; }
+	void ReleaseElementData(DecoratorDataHandle /*element_data*/) const override {}
+	void RenderElement(Element* /*element*/, DecoratorDataHandle /*element_data*/) const override {}
+};
+
+TEST_CASE("core.memory_interface.tagged_types")
+{
+	static TrackingMemoryInterface memory_interface;
+	SetMemoryInterface(&memory_interface);
+
+	{
+		// Instancers and decorators made by the application, or by the factory, go through the interface.
+		UniquePtr<ElementInstancer> instancer = MakeUnique<ElementInstancerGeneric<Element>>();
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::General) == sizeof(ElementInstancerGeneric<Element>));
+
+		UniquePtr<Decorator> decorator = MakeUnique<EmptyDecorator>();
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Style) == sizeof(EmptyDecorator));
+
+		SharedPtr<Decorator> shared_decorator = MakeShared<EmptyDecorator>();
+		CHECK(memory_interface.GetAllocatedBytes(MemoryCategory::Style) > 2 * sizeof(EmptyDecorator));
+	}
+
+	CHECK(memory_interface.live_allocations.empty());
+
+	SetMemoryInterface(nullptr);
+}
+
+#ifdef __cpp_aligned_new
+struct alignas(64) OverAlignedObject : public Allocated<MemoryCategory::Layout> {
+	char data[64];
+};
+
+class AlignedMemoryInterface : public MemoryInterface {
+public:
+	void* Allocate(size_t size, size_t alignment, MemoryCategory /*category*/) override
+	{
+		last_alignment = alignment;
+		return ::operator new(size, std::align_val_t(alignment));
+	}
+	void Deallocate(void* ptr, size_t /*size*/, size_t alignment, MemoryCategory /*category*/) override
+	{
+		CHECK(alignment == last_alignment);
+		::operator delete(ptr, std::align_val_t(alignment));
+	}
+
+	size_t last_alignment = 0;
+};
+
+TEST_CASE("core.memory_interface.over_aligned")
+{
+	static AlignedMemoryInterface memory_interface;
+	SetMemoryInterface(&memory_interface);
+
+	UniquePtr<OverAlignedObject> object = MakeUnique<OverAlignedObject>();
+	CHECK(memory_interface.last_alignment == 64);
+	CHECK(reinterpret_cast<uintptr_t>(object.get()) % 64 == 0);
+	object.reset();
+
+	SetMemoryInterface(nullptr);
+}
+#endif
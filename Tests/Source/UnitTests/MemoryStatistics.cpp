@@ -0,0 +1,142 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/MemoryStatistics.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String memory_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		div {
+			display: block;
+			background-color: #f00;
+		}
+		div:hover {
+			background-color: #0f0;
+		}
+	</style>
+</head>
+<body>
+<div data-model="memory">
+	<div data-for="items">{{ it }}</div>
+</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("core.memory_statistics")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	const MemoryStatistics before = GetMemoryStatistics();
+
+	Vector<int> items(100);
+	{
+		DataModelConstructor constructor = context->CreateDataModel("memory");
+		REQUIRE(bool(constructor));
+		constructor.RegisterArray<Vector<int>>();
+		constructor.Bind("items", &items);
+	}
+
+	ElementDocument* document = context->LoadDocumentFromMemory(memory_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	context->Update();
+	context->Render();
+
+	const MemoryStatistics during = GetMemoryStatistics();
+
+	CHECK(during.elements.count >= before.elements.count + 200);
+	CHECK(during.elements.bytes > before.elements.bytes);
+	CHECK(during.element_meta.count == during.elements.count);
+	CHECK(during.computed_values.count == during.elements.count);
+	CHECK(during.element_meta.bytes >= during.computed_values.bytes);
+
+	CHECK(during.style_sheets.count > 0);
+	CHECK(during.style_sheet_nodes.count > 0);
+	CHECK(during.element_definitions.count > 0);
+	CHECK(during.element_definitions.bytes > 0);
+
+	CHECK(during.geometry.count > before.geometry.count);
+	CHECK(during.geometry.bytes > before.geometry.bytes);
+
+	CHECK(during.data_models.count == before.data_models.count + 1);
+	CHECK(during.data_views.count > before.data_views.count + 100);
+
+	CHECK(during.layout_chunks.bytes > 0);
+
+	REQUIRE(!during.font_atlases.empty());
+	bool found_font = false;
+	for (const MemoryStatistics::FontAtlas& atlas : during.font_atlases)
+	{
+		if (atlas.family == "latolatin" && atlas.size == 15 && atlas.style == Style::FontStyle::Normal && atlas.weight == Style::FontWeight::Normal)
+		{
+			found_font = true;
+			CHECK(atlas.num_textures >= 1);
+			CHECK(atlas.bytes > 0);
+		}
+	}
+	CHECK(found_font);
+
+	// The font atlas is loaded as a texture.
+	REQUIRE(!during.textures.empty());
+	for (const MemoryStatistics::TextureGroup& group : during.textures)
+	{
+		CHECK(group.count > 0);
+		CHECK(group.bytes == size_t(group.count * group.dimensions.x * group.dimensions.y * 4));
+	}
+
+	document->Close();
+	context->RemoveDataModel("memory");
+	context->Update();
+
+	const MemoryStatistics after = GetMemoryStatistics();
+	CHECK(after.elements.count == before.elements.count);
+	CHECK(after.data_models.count == before.data_models.count);
+	CHECK(after.data_views.count == before.data_views.count);
+	CHECK(after.geometry.count <= before.geometry.count + 10);
+
+	TestsShell::ShutdownShell();
+}
@@ -27,10 +27,12 @@
  */
 
 #include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
 #include <RmlUi/Core/Context.h>
 #include <RmlUi/Core/Core.h>
 #include <RmlUi/Core/Element.h>
 #include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/FrameStatistics.h>
 #include <RmlUi/Core/Types.h>
 #include <doctest.h>
 
@@ -124,6 +126,41 @@ static const Vector<ClosestSelector> closest_selectors =
 	{ "D1",  "div:nth-child(4)", "P" },
 };
 
+static const String structural_doc_end = R"(
+		body { font-family: LatoLatin; }
+	</style>
+</head>
+<body>
+	<div id="P">
+		<p    id="A"/>
+		<p    id="B"/>
+		<span id="C"/>
+		<p    id="D"/>
+	</div>
+</body>
+</rml>
+)";
+
+struct StructuralChange {
+	String selector;
+	void (*change)(Element* parent);
+	String expected_ids;
+};
+static const Vector<StructuralChange> structural_changes =
+{
+	{ "#P > :nth-child(odd)",   [](Element* P) { P->InsertBefore(P->GetOwnerDocument()->CreateElement("p"), P->GetChild(1))->SetId("N"); }, "A B D" },
+	{ "#P > :nth-child(odd)",   [](Element* P) { P->RemoveChild(P->GetChild(0)); },                 "B D" },
+	{ "#P > :nth-child(odd)",   [](Element* P) { P->GetChild(1)->SetProperty("display", "none"); }, "A D" },
+	{ "#P > :first-child",      [](Element* P) { P->RemoveChild(P->GetChild(0)); },                 "B" },
+	{ "#P > :last-child",       [](Element* P) { P->AppendChild(P->GetOwnerDocument()->CreateElement("span"))->SetId("E"); }, "E" },
+	{ "#P > :last-child",       [](Element* P) { P->GetChild(3)->SetProperty("display", "none"); }, "C D" },
+	{ "#P > p:nth-of-type(2)",  [](Element* P) { P->InsertBefore(P->GetOwnerDocument()->CreateElement("p"), P->GetChild(1))->SetId("N"); }, "N" },
+	{ "#P > p:last-of-type",    [](Element* P) { P->AppendChild(P->GetOwnerDocument()->CreateElement("p"))->SetId("E"); }, "E" },
+	{ "#P > :only-child",       [](Element* P) { P->SetInnerRML(R"(Hello <span id="S"/> world)"); }, "S" },
+	{ "#P > :only-of-type",     [](Element* P) { P->RemoveChild(P->GetChild(0)); P->RemoveChild(P->GetChild(0)); }, "C D" },
+	{ "#P > :empty",            [](Element* P) { P->GetChild(0)->AppendChild(P->GetOwnerDocument()->CreateElement("span")); }, "B C D" },
+};
+
 
 // Recursively iterate through 'element' and all of its descendants to find all
 // elements matching a particular property used to tag matching selectors.
@@ -239,3 +276,90 @@ TEST_CASE("Selectors")
 
 	Rml::Shutdown();
 }
+
+TEST_CASE("Selectors.structural_changes")
+{
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	SUBCASE("Matching")
+	{
+		for (const StructuralChange& structural_change : structural_changes)
+		{
+			const String selector_css = structural_change.selector + " { drag: drag; } ";
+			ElementDocument* document = context->LoadDocumentFromMemory(doc_begin + selector_css + structural_doc_end);
+			REQUIRE(document);
+			document->Show();
+			context->Update();
+
+			structural_change.change(document->GetElementById("P"));
+
+			// Changes to the display property are only applied to the siblings in the next update.
+			context->Update();
+			context->Update();
+
+			String matching_ids;
+			GetMatchingIds(matching_ids, document);
+			if (!matching_ids.empty())
+				matching_ids.pop_back();
+
+			CHECK_MESSAGE(matching_ids == structural_change.expected_ids, "Selector: " << structural_change.selector);
+
+			ElementList elements;
+			document->QuerySelectorAll(elements, structural_change.selector);
+			CHECK_MESSAGE(ElementListToIds(elements) == structural_change.expected_ids, "QuerySelectorAll: " << structural_change.selector);
+
+			document->Close();
+			context->Update();
+		}
+	}
+
+	SUBCASE("Definition updates")
+	{
+		const int num_rows = 20;
+		String rows_rml;
+		for (int i = 0; i < num_rows; i++)
+			rows_rml += "<p/>";
+
+		auto LoadDocument = [&](const String& selector) {
+			ElementDocument* document = context->LoadDocumentFromMemory(doc_begin + selector + " { drag: drag; }" + structural_doc_end);
+			REQUIRE(document);
+			document->GetElementById("P")->SetInnerRML(rows_rml);
+			document->Show();
+			context->Update();
+			context->Render();
+			context->Update();
+			context->Render();
+			CHECK(context->GetFrameStatistics().definition_updates == 0);
+			return document;
+		};
+
+		// Appending a row only shifts the positions counted from the end, only the new row should be matched.
+		ElementDocument* document = LoadDocument("p:nth-child(odd)");
+		Element* P = document->GetElementById("P");
+		P->AppendChild(document->CreateElement("p"));
+		context->Update();
+		context->Render();
+		CHECK(context->GetFrameStatistics().definition_updates == 1);
+
+		// Inserting a row at the front shifts every other row.
+		P->InsertBefore(document->CreateElement("p"), P->GetFirstChild());
+		context->Update();
+		context->Render();
+		CHECK(context->GetFrameStatistics().definition_updates == num_rows + 2);
+		document->Close();
+		context->Update();
+
+		// Positions counted from the end are shifted by appending a row.
+		document = LoadDocument("p:nth-last-child(odd)");
+		P = document->GetElementById("P");
+		P->AppendChild(document->CreateElement("p"));
+		context->Update();
+		context->Render();
+		CHECK(context->GetFrameStatistics().definition_updates == num_rows + 1);
+		document->Close();
+		context->Update();
+	}
+
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,219 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+ 
+
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/ElementInstancer.h>
+#include <RmlUi/Core/Factory.h>
+#include <doctest.h>
+
+using namespace Rml;
+
+static const String document_stacking_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 15px;
+		}
+		log {
+			display: block;
+			width: 10px;
+			height: 10px;
+		}
+		.inline { display: inline-block; }
+		.float { float: left; }
+		.relative { position: relative; }
+		.absolute { position: absolute; }
+		.above { z-index: 2; }
+		.below { z-index: -1; }
+		.hidden { display: none; }
+	</style>
+</head>
+
+<body>
+<log id="a"><log id="a1" class="inline"/><log id="a2"/></log>
+<log id="b" class="relative"><log id="b1" class="float"/><log id="b2"/></log>
+<log id="c" class="above"><log id="c1"/></log>
+<log id="d" class="float"><log id="d1" class="absolute"/><log id="d2" class="below"/></log>
+<log id="e" class="inline"/>
+<log id="f"><log id="f1"/><log id="f2" class="relative"/></log>
+</body>
+</rml>
+)";
+
+// Logs the order in which the elements of each document are rendered.
+static UnorderedMap<ElementDocument*, String> render_log;
+
+class ElementLogRender : public Element
+{
+public:
+	ElementLogRender(const String& tag) : Element(tag) {}
+
+protected:
+	void OnRender() override
+	{
+		String& log = render_log[GetOwnerDocument()];
+		log += GetId();
+		log += ' ';
+	}
+};
+
+// Renders the context and returns the render order of the elements in the document.
+static String GetRenderOrder(Context* context, ElementDocument* document)
+{
+	render_log.clear();
+	context->Update();
+	context->Render();
+	return render_log[document];
+}
+
+// Returns the render order of a newly loaded document with the same contents, which always builds its stacking contexts from scratch.
+static String GetRebuiltRenderOrder(Context* context, ElementDocument* document)
+{
+	String rml = document_stacking_rml;
+	const size_t body_begin = rml.find("<body>") + 6;
+	const size_t body_end = rml.find("</body>");
+	rml.replace(body_begin, body_end - body_begin, document->GetInnerRML());
+
+	ElementDocument* rebuilt_document = context->LoadDocumentFromMemory(rml);
+	rebuilt_document->Show();
+	const String result = GetRenderOrder(context, rebuilt_document);
+	rebuilt_document->Close();
+	context->Update();
+
+	return result;
+}
+
+TEST_CASE("Element.stacking_context")
+{
+	static ElementInstancerGeneric<ElementLogRender> instancer;
+	Factory::RegisterElementInstancer("log", &instancer);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_stacking_rml);
+	REQUIRE(document);
+	document->Show();
+
+	const String initial_order = GetRenderOrder(context, document);
+	CHECK(initial_order == "d2 a a2 a1 f f1 f2 e d d1 b b2 b1 c c1 ");
+	CHECK(GetRebuiltRenderOrder(context, document) == initial_order);
+
+	SUBCASE("Append")
+	{
+		ElementPtr toast = document->CreateElement("log");
+		toast->SetId("toast");
+		toast->SetAttribute("class", "absolute");
+		toast->SetInnerRML(R"(<log id="toast1" class="float"/><log id="toast2" class="above"/><log id="toast3" class="below"/>)");
+		document->AppendChild(std::move(toast));
+
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+	}
+
+	SUBCASE("InsertBefore")
+	{
+		Element* f = document->GetElementById("f");
+		ElementPtr inserted = document->CreateElement("log");
+		inserted->SetId("g");
+		inserted->SetAttribute("class", "float");
+		inserted->SetInnerRML(R"(<log id="g1"/><log id="g2" class="inline"/>)");
+		f->InsertBefore(std::move(inserted), document->GetElementById("f2"));
+
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+	}
+
+	SUBCASE("Remove")
+	{
+		document->GetElementById("b")->GetParentNode()->RemoveChild(document->GetElementById("b"));
+		const String order = GetRenderOrder(context, document);
+		CHECK(order.find('b') == String::npos);
+		CHECK(order == GetRebuiltRenderOrder(context, document));
+	}
+
+	SUBCASE("RemoveMany")
+	{
+		// Clearing a long list falls back to rebuilding the stacking context after a number of removals.
+		Element* f = document->GetElementById("f");
+		String list_rml;
+		const char* classes[] = { "", "float", "inline", "relative", "above", "below" };
+		for (int i = 0; i < 40; i++)
+			list_rml += CreateString(64, R"(<log id="l%d" class="%s"><log id="l%dc"/></log>)", i, classes[i % 6], i);
+		f->SetInnerRML(list_rml);
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+
+		// Remove a few elements, staying below the limit, then clear all remaining ones.
+		for (int i = 0; i < 4; i++)
+			f->RemoveChild(document->GetElementById(CreateString(16, "l%d", i * 3)));
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+
+		f->SetInnerRML("");
+		const String order = GetRenderOrder(context, document);
+		CHECK(order.find('l') == String::npos);
+		CHECK(order == GetRebuiltRenderOrder(context, document));
+	}
+
+	SUBCASE("Visibility")
+	{
+		document->GetElementById("a")->SetAttribute("class", "hidden");
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+
+		document->GetElementById("a")->SetAttribute("class", "");
+		CHECK(GetRenderOrder(context, document) == initial_order);
+	}
+
+	SUBCASE("RenderOrder")
+	{
+		document->GetElementById("a")->SetAttribute("class", "relative");
+		document->GetElementById("d")->SetAttribute("class", "");
+		document->GetElementById("f1")->SetAttribute("class", "inline");
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+	}
+
+	SUBCASE("ZIndex")
+	{
+		document->GetElementById("c")->SetAttribute("style", "z-index: -2");
+		document->GetElementById("d2")->SetAttribute("style", "z-index: 3");
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+
+		// Elements becoming or no longer being stacking contexts move their descendants between stacking contexts.
+		document->GetElementById("a")->SetAttribute("style", "z-index: 1");
+		document->GetElementById("c")->SetAttribute("style", "z-index: auto");
+		CHECK(GetRenderOrder(context, document) == GetRebuiltRenderOrder(context, document));
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+}
@@ -0,0 +1,350 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/TaskInterface.h>
+#include <doctest.h>
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+using namespace Rml;
+
+// Runs each submitted task on its own thread.
+class ThreadedTaskInterface : public TaskInterface {
+public:
+	ThreadedTaskInterface(int concurrency) : concurrency(concurrency) {}
+
+	int GetConcurrency() override { return concurrency; }
+
+	TaskHandle Submit(Function<void()> task) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		const TaskHandle handle = ++previous_handle;
+		threads.emplace(handle, std::thread([this, task]() {
+			num_tasks_run += 1;
+			task();
+		}));
+		return handle;
+	}
+
+	void Wait(TaskHandle handle) override
+	{
+		std::thread thread;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			auto it = threads.find(handle);
+			REQUIRE(it != threads.end());
+			thread = std::move(it->second);
+			threads.erase(it);
+		}
+		thread.join();
+	}
+
+	std::atomic<int> num_tasks_run{0};
+
+private:
+	int concurrency;
+	std::mutex mutex;
+	TaskHandle previous_handle = 0;
+	UnorderedMap<TaskHandle, std::thread> threads;
+};
+
+// Hashes the data of all generated textures.
+class HashingRenderInterface : public TestsRenderInterface {
+public:
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions) override
+	{
+		for (int i = 0; i < source_dimensions.x * source_dimensions.y * 4; i++)
+			hash = (hash ^ source[i]) * 1099511628211ull;
+		num_textures += 1;
+		return TestsRenderInterface::GenerateTexture(texture_handle, source, source_dimensions);
+	}
+
+	uint64_t hash = 14695981039346656037ull;
+	int num_textures = 0;
+};
+
+static const String font_effects_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 20px;
+		}
+		div {
+			display: block;
+		}
+		#blur { font-effect: blur(4px #f00); }
+		#glow { font-effect: glow(2px 4px 2px 3px #0f0); }
+		#outline { font-effect: outline(2px #00f); }
+		#shadow { font-effect: shadow(2px 2px #000); }
+	</style>
+</head>
+<body>
+<div id="plain">The quick brown fox jumps over the lazy dog 0123456789.</div>
+<div id="blur">The quick brown fox jumps over the lazy dog 0123456789.</div>
+<div id="glow">The quick brown fox jumps over the lazy dog 0123456789.</div>
+<div id="outline">The quick brown fox jumps over the lazy dog 0123456789.</div>
+<div id="shadow">The quick brown fox jumps over the lazy dog 0123456789.</div>
+</body>
+</rml>
+)";
+
+TEST_CASE("task_interface.parallel_for")
+{
+	TaskInterface serial_interface;
+	ThreadedTaskInterface threaded_interface(4);
+
+	for (TaskInterface* task_interface : {&serial_interface, static_cast<TaskInterface*>(&threaded_interface)})
+	{
+		for (int num_indices : {0, 1, 7, 100, 1001})
+		{
+			for (int grain_size : {0, 1, 16, 2000})
+			{
+				Vector<std::atomic<int>> visits(num_indices);
+				std::atomic<int> num_chunks{0};
+
+				task_interface->ParallelFor(10, 10 + num_indices, grain_size, [&](int begin, int end) {
+					CHECK(begin < end);
+					num_chunks += 1;
+					for (int i = begin; i < end; i++)
+						visits[i - 10] += 1;
+				});
+
+				CHECK(std::all_of(visits.begin(), visits.end(), [](const std::atomic<int>& count) { return count == 1; }));
+				CHECK(num_chunks <= task_interface->GetConcurrency());
+				if (task_interface == &serial_interface || grain_size >= num_indices)
+					CHECK(num_chunks == (num_indices > 0 ? 1 : 0));
+			}
+		}
+	}
+
+	// Only the chunks beyond the first one are submitted, the first one runs on the calling thread.
+	threaded_interface.num_tasks_run = 0;
+	threaded_interface.ParallelFor(0, 100, 10, [](int, int) {});
+	CHECK(threaded_interface.num_tasks_run == 3);
+}
+
+TEST_CASE("task_interface.font_effects")
+{
+	HashingRenderInterface render_interface_serial, render_interface_threaded;
+
+	ThreadedTaskInterface threaded_interface(4);
+
+	// Generate the same text and font effects using the default serial task interface, and then on several threads.
+	for (HashingRenderInterface* render_interface : {&render_interface_serial, &render_interface_threaded})
+	{
+		TestsShell::ShutdownShell();
+
+		const bool threaded = (render_interface == &render_interface_threaded);
+		SetTaskInterface(threaded ? &threaded_interface : nullptr);
+
+		TestsShell::GetContext();
+		CHECK(GetTaskInterface());
+		CHECK(GetTaskInterface()->GetConcurrency() == (threaded ? 4 : 1));
+
+		Context* context = CreateContext("task_interface", Vector2i(1500, 800), render_interface);
+		REQUIRE(context);
+
+		ElementDocument* document = context->LoadDocumentFromMemory(font_effects_document_rml);
+		REQUIRE(document);
+		document->Show();
+
+		context->Update();
+		context->Render();
+
+		document->Close();
+		RemoveContext("task_interface");
+	}
+
+	TestsShell::ShutdownShell();
+	SetTaskInterface(nullptr);
+
+	CHECK(threaded_interface.num_tasks_run > 0);
+	CHECK(render_interface_serial.num_textures >= 4);
+	CHECK(render_interface_serial.num_textures == render_interface_threaded.num_textures);
+	CHECK(render_interface_serial.hash == render_interface_threaded.hash);
+}
+
+TEST_CASE("task_interface.style_sheet_parsing")
+{
+	ThreadedTaskInterface threaded_interface(4);
+
+	// Generate a style sheet with enough rules to be parsed in several tasks.
+	const int num_rules = 1000;
+	String rcss;
+	String rml;
+	for (int i = 0; i < num_rules; i++)
+	{
+		rcss += CreateString(128, ".rule%d { /* Rule %d */ width: %dpx; height: 5px; }\n", i, i, i);
+		if (i % 100 == 0)
+			rml += CreateString(64, "<div id=\"element%d\" class=\"rule%d\"/>", i, i);
+	}
+
+	// Several linked style sheets are also parsed in parallel, missing sheets should only be reported once.
+	const String links_rml = "<link type='text/rcss' href='/assets/rml.rcss'/>"
+		"<link type='text/rcss' href='/../Tests/Data/style.rcss'/>";
+	const String linked_document_rml = "<rml><head>" + links_rml +
+		"<link type='text/rcss' href='/assets/missing.rcss'/></head><body/></rml>";
+	const String document_rml = "<rml><head>" + links_rml + "<style>" + rcss + "</style></head><body>" + rml + "</body></rml>";
+
+	for (bool threaded : {false, true})
+	{
+		TestsShell::ShutdownShell();
+		SetTaskInterface(threaded ? &threaded_interface : nullptr);
+		threaded_interface.num_tasks_run = 0;
+
+		Context* context = TestsShell::GetContext();
+		REQUIRE(context);
+
+		INFO("Expected warnings: Unable to open file, failed to load style sheet.");
+		TestsShell::SetNumExpectedWarnings(2);
+		ElementDocument* linked_document = context->LoadDocumentFromMemory(linked_document_rml);
+		TestsShell::SetNumExpectedWarnings(0);
+		REQUIRE(linked_document);
+
+		// Without an inline sheet, tasks are only run when preloading the linked sheets.
+		CHECK((threaded_interface.num_tasks_run > 0) == threaded);
+		CHECK(linked_document->GetProperty<float>("padding-left") == 8.f);
+		linked_document->Close();
+		threaded_interface.num_tasks_run = 0;
+
+		ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+		REQUIRE(document);
+		document->Show();
+		context->Update();
+
+		CHECK(document->GetProperty<float>("padding-left") == 8.f);
+
+		for (int i = 0; i < num_rules; i += 100)
+		{
+			Element* element = document->GetElementById(CreateString(32, "element%d", i));
+			REQUIRE(element);
+			CHECK(element->GetProperty<float>("width") == float(i));
+			CHECK(element->GetProperty<float>("height") == 5.f);
+			CHECK(element->GetDisplay() == Style::Display::Block);
+		}
+
+		CHECK((threaded_interface.num_tasks_run > 0) == threaded);
+
+		document->Close();
+		TestsShell::ShutdownShell();
+	}
+
+	SetTaskInterface(nullptr);
+}
+
+// Records the logged messages and the threads they were logged from, otherwise forwards to the given interface.
+class RecordingSystemInterface : public SystemInterface {
+public:
+	RecordingSystemInterface(SystemInterface* system_interface) : system_interface(system_interface) {}
+
+	double GetElapsedTime() override { return system_interface->GetElapsedTime(); }
+
+	bool LogMessage(Log::Type type, const String& message) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		messages.push_back(message);
+		thread_ids.push_back(std::this_thread::get_id());
+		return SystemInterface::LogMessage(type, message);
+	}
+
+	StringList messages;
+	Vector<std::thread::id> thread_ids;
+
+private:
+	SystemInterface* system_interface;
+	std::mutex mutex;
+};
+
+TEST_CASE("task_interface.style_sheet_parsing_warnings")
+{
+	ThreadedTaskInterface threaded_interface(4);
+
+	// Mix warnings from the properties of rules, which are parsed in parallel, with warnings found while scanning the sheet.
+	const int num_rules = 600;
+	String rcss;
+	StringList expected_messages;
+	for (int i = 0; i < num_rules; i++)
+	{
+		if (i % 200 == 100)
+		{
+			rcss += "}\n";
+			expected_messages.push_back("Invalid character '}'");
+		}
+		if (i % 200 == 50 || i == num_rules - 1)
+		{
+			rcss += CreateString(128, ".rule%d { width: invalid%d; }\n", i, i);
+			expected_messages.push_back(CreateString(32, "invalid%d", i));
+		}
+		else
+		{
+			rcss += CreateString(128, ".rule%d { width: %dpx; }\n", i, i);
+		}
+	}
+
+	const String document_rml = "<rml><head><style>" + rcss + "</style></head><body/></rml>";
+
+	TestsShell::ShutdownShell();
+	SetTaskInterface(&threaded_interface);
+
+	Context* context = TestsShell::GetContext();
+	REQUIRE(context);
+
+	SystemInterface* tests_system_interface = GetSystemInterface();
+	RecordingSystemInterface system_interface(tests_system_interface);
+	SetSystemInterface(&system_interface);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(document_rml);
+
+	SetSystemInterface(tests_system_interface);
+	REQUIRE(document);
+	CHECK(threaded_interface.num_tasks_run > 0);
+
+	// All messages are logged on the calling thread, in source order.
+	REQUIRE(system_interface.messages.size() == expected_messages.size());
+	for (size_t i = 0; i < expected_messages.size(); i++)
+	{
+		CHECK_MESSAGE(system_interface.messages[i].find(expected_messages[i]) != String::npos, system_interface.messages[i]);
+		const bool logged_on_calling_thread = (system_interface.thread_ids[i] == std::this_thread::get_id());
+		CHECK(logged_on_calling_thread);
+	}
+
+	document->Close();
+	TestsShell::ShutdownShell();
+	SetTaskInterface(nullptr);
+}
@@ -0,0 +1,345 @@
+/*
+ * This source file is part of RmlUi, the HTML/CSS Interface Middleware
+ *
+ * For the latest information, see http://github.com/mikke89/RmlUi
+ *
+ * Copyright (c) 2008-2010 CodePoint Ltd, Shift Technology Ltd
+ * Copyright (c) 2019 The RmlUi Team, and contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ */
+
+#include "../Common/TestsInterface.h"
+#include "../Common/TestsShell.h"
+#include "../../../Source/Core/FontEngineDefault/FontProvider.h"
+#include <RmlUi/Core/Context.h>
+#include <RmlUi/Core/Core.h>
+#include <RmlUi/Core/DataModelHandle.h>
+#include <RmlUi/Core/Element.h>
+#include <RmlUi/Core/ElementDocument.h>
+#include <RmlUi/Core/EventListener.h>
+#include <RmlUi/Core/StringUtilities.h>
+#include <doctest.h>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Rml;
+
+static const String threading_document_rml = R"(
+<rml>
+<head>
+	<title>Test</title>
+	<link type="text/rcss" href="/assets/rml.rcss"/>
+	<style>
+		body {
+			font-family: LatoLatin;
+			font-size: 18px;
+			width: 600px;
+		}
+		div {
+			display: block;
+			padding: 5px;
+			decorator: gradient(vertical #f00 #00f);
+		}
+		div.active {
+			padding: 10px;
+			font-effect: outline(1px #000);
+		}
+		p:nth-child(odd) {
+			font-size: 20px;
+		}
+		img {
+			width: 32px;
+			height: 32px;
+		}
+	</style>
+</head>
+<body>
+<div data-model="model">
+	<div id="counter">Frame {{frame}}</div>
+	<p data-for="item : items">Item {{item}}</p>
+	<div id="glyphs"/>
+	<img src="/assets/high_scores_alien_1.tga"/>
+</div>
+</body>
+</rml>
+)";
+
+// Uses only a single linked style sheet, which is parsed once and then shared from the style sheet cache, along with
+// its element definitions.
+static const String shared_sheet_document_rml = R"(
+<rml>
+<head>
+	<title>Shared</title>
+	<link type="text/rcss" href="/../Tests/Data/UnitTests/Threading.rcss"/>
+</head>
+<body style="font-family: LatoLatin;">
+<h1>Shared style sheet</h1>
+<p>The quick brown fox jumps over the lazy dog.</p>
+<div class="item">A</div>
+<div class="item">B</div>
+<div class="item">C</div>
+<div class="item">D</div>
+</body>
+</rml>
+)";
+
+// Textures shared between contexts may be released from any thread.
+class ThreadSafeRenderInterface : public TestsRenderInterface {
+public:
+	bool LoadTexture(TextureHandle& texture_handle, Vector2i& texture_dimensions, const String& source) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return TestsRenderInterface::LoadTexture(texture_handle, texture_dimensions, source);
+	}
+	bool GenerateTexture(TextureHandle& texture_handle, const byte* source, const Vector2i& source_dimensions) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		return TestsRenderInterface::GenerateTexture(texture_handle, source, source_dimensions);
+	}
+	void ReleaseTexture(TextureHandle texture_handle) override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		TestsRenderInterface::ReleaseTexture(texture_handle);
+	}
+
+private:
+	std::mutex mutex;
+};
+
+class CountingEventListener : public EventListener {
+public:
+	void ProcessEvent(Event& /*event*/) override { num_events += 1; }
+	int num_events = 0;
+};
+
+struct ContextResult {
+	bool success = false;
+	size_t layout_hash = 0;
+	size_t vertices = 0;
+	size_t render_calls = 0;
+	int num_events = 0;
+};
+
+static void HashLayout(Element* element, size_t& seed)
+{
+	const Vector2f offset = element->GetAbsoluteOffset();
+	const Vector2f size = element->GetBox().GetSize();
+	seed = seed * 31 + std::hash<float>()(offset.x);
+	seed = seed * 31 + std::hash<float>()(offset.y);
+	seed = seed * 31 + std::hash<float>()(size.x);
+	seed = seed * 31 + std::hash<float>()(size.y);
+
+	for (int i = 0; i < element->GetNumChildren(); i++)
+		HashLayout(element->GetChild(i), seed);
+}
+
+// Creates a context, and runs a number of frames with changing content. Only deterministic results are returned, so
+// that they can be compared between serial and concurrent runs.
+static ContextResult RunContext(int index, int num_frames, ThreadSafeRenderInterface* render_interface)
+{
+	ContextResult result;
+
+	const String name = CreateString(32, "threading_%d", index);
+	Context* context = CreateContext(name, Vector2i(800, 600), render_interface);
+	if (!context)
+		return result;
+
+	int frame = 0;
+	Vector<int> items;
+
+	DataModelConstructor constructor = context->CreateDataModel("model");
+	constructor.RegisterArray<Vector<int>>();
+	constructor.Bind("frame", &frame);
+	constructor.Bind("items", &items);
+	DataModelHandle model = constructor.GetModelHandle();
+
+	ElementDocument* document = context->LoadDocumentFromMemory(threading_document_rml);
+	ElementDocument* shared_sheet_document = context->LoadDocumentFromMemory(shared_sheet_document_rml);
+	if (!document || !shared_sheet_document)
+		return result;
+	document->Show();
+	shared_sheet_document->Show();
+
+	CountingEventListener listener;
+	Element* counter = document->GetElementById("counter");
+	Element* glyphs = document->GetElementById("glyphs");
+	ElementList shared_items;
+	shared_sheet_document->GetElementsByClassName(shared_items, "item");
+	for (int i = 0; i < 4; i++)
+		counter->AddEventListener(CreateString(32, "threading_event_%d", i), &listener);
+
+	for (frame = 0; frame < num_frames; frame++)
+	{
+		items.resize(frame % 7);
+		for (size_t i = 0; i < items.size(); i++)
+			items[i] = frame + (int)i;
+		model.DirtyVariable("frame");
+		model.DirtyVariable("items");
+
+		counter->SetClass("active", frame % 3 == 0);
+
+		// Switch between the definitions of the shared style sheet, whose changes are cached on the shared definitions.
+		for (int i = 0; i < (int)shared_items.size(); i++)
+		{
+			shared_items[i]->SetClass("wide", (frame + i) % 2 == 0);
+			shared_items[i]->SetClass("highlight", (frame + i + index) % 3 == 0);
+			shared_items[i]->SetClass("large", (frame / 2 + i) % 4 == 0);
+		}
+		counter->DispatchEvent(CreateString(32, "threading_event_%d", frame % 4), Dictionary());
+
+		// Introduce glyphs unique to this context, so that the shared font face handle is regenerated while other
+		// contexts render text using it.
+		if (frame % 10 == 0)
+		{
+			String text;
+			for (int i = 0; i < 3; i++)
+				text += StringUtilities::ToUTF8(Character(0x100 + (index * 16 + frame / 10 * 3 + i) % 0x80));
+			glyphs->SetInnerRML(text);
+		}
+
+		context->Update();
+		context->Render();
+	}
+
+	HashLayout(document, result.layout_hash);
+	HashLayout(shared_sheet_document, result.layout_hash);
+	result.vertices = render_interface->GetCounters().vertices;
+	result.render_calls = render_interface->GetCounters().render_calls;
+	result.num_events = listener.num_events;
+	result.success = true;
+
+	for (int i = 0; i < 4; i++)
+		counter->RemoveEventListener(CreateString(32, "threading_event_%d", i), &listener);
+	document->Close();
+	shared_sheet_document->Close();
+	RemoveContext(name);
+
+	return result;
+}
+
+TEST_CASE("threading.contexts")
+{
+	constexpr int num_contexts = 8;
+	constexpr int num_frames = 60;
+
+	REQUIRE(TestsShell::GetContext());
+
+	Vector<ThreadSafeRenderInterface> render_interfaces_serial(num_contexts);
+	Vector<ThreadSafeRenderInterface> render_interfaces_threaded(num_contexts);
+	Vector<ContextResult> results_serial(num_contexts);
+	Vector<ContextResult> results_threaded(num_contexts);
+
+	for (int i = 0; i < num_contexts; i++)
+		results_serial[i] = RunContext(i, num_frames, &render_interfaces_serial[i]);
+
+	// Release all the textures of the serial run, so that the threaded run starts from the same state.
+	ReleaseTextures();
+	TestsShell::ShutdownShell();
+	REQUIRE(TestsShell::GetContext());
+
+	// Now run all the contexts concurrently, including their creation and destruction.
+	Vector<std::thread> threads;
+	for (int i = 0; i < num_contexts; i++)
+		threads.emplace_back([&, i]() { results_threaded[i] = RunContext(i, num_frames, &render_interfaces_threaded[i]); });
+	for (std::thread& thread : threads)
+		thread.join();
+
+	CHECK(GetNumContexts() == 1);
+
+	for (int i = 0; i < num_contexts; i++)
+	{
+		const ContextResult& serial = results_serial[i];
+		const ContextResult& threaded = results_threaded[i];
+		REQUIRE(serial.success);
+		REQUIRE(threaded.success);
+
+		CHECK(serial.num_events == num_frames);
+		CHECK(threaded.num_events == serial.num_events);
+		CHECK(threaded.layout_hash == serial.layout_hash);
+		CHECK(threaded.render_calls == serial.render_calls);
+		CHECK(threaded.vertices == serial.vertices);
+	}
+
+	TestsShell::ShutdownShell();
+
+	// All textures should have been released by their respective contexts or on shutdown.
+	for (int i = 0; i < num_contexts; i++)
+	{
+		CHECK(render_interfaces_serial[i].GetNumLiveTextures() == 0);
+		CHECK(render_interfaces_threaded[i].GetNumLiveTextures() == 0);
+	}
+}
+
+#ifndef RMLUI_NO_FONT_INTERFACE_DEFAULT
+// Records whether any textured geometry is rendered while the font lock is held.
+class FontLockRenderInterface : public TestsRenderInterface {
+public:
+	void RenderGeometry(Vertex* vertices, int num_vertices, int* indices, int num_indices, TextureHandle texture, const Vector2f& translation) override
+	{
+		if (texture)
+		{
+			// The lock is recursive, so it has to be tried from another thread.
+			const bool font_locked = !std::async(std::launch::async, []() {
+				std::unique_lock<std::recursive_mutex> lock(FontProvider::GetMutex(), std::try_to_lock);
+				return lock.owns_lock();
+			}).get();
+
+			num_textured_calls += 1;
+			num_font_locked_calls += (font_locked ? 1 : 0);
+		}
+		TestsRenderInterface::RenderGeometry(vertices, num_vertices, indices, num_indices, texture, translation);
+	}
+
+	int num_textured_calls = 0;
+	int num_font_locked_calls = 0;
+};
+
+TEST_CASE("threading.render_text_without_font_lock")
+{
+	// Text is rendered without holding the font lock, so that contexts on other threads can render at the same time.
+	REQUIRE(TestsShell::GetContext());
+
+	FontLockRenderInterface render_interface;
+	Context* context = CreateContext("font_lock", Vector2i(800, 600), &render_interface);
+	REQUIRE(context);
+
+	ElementDocument* document = context->LoadDocumentFromMemory(shared_sheet_document_rml);
+	REQUIRE(document);
+	document->Show();
+
+	for (int i = 0; i < 2; i++)
+	{
+		context->Update();
+		context->Render();
+	}
+
+	CHECK(render_interface.num_textured_calls > 0);
+	CHECK(render_interface.num_font_locked_calls == 0);
+
+	document->Close();
+	context->Update();
+	RemoveContext("font_lock");
+	ReleaseTextures();
+
+	TestsShell::ShutdownShell();
+}
+#endif